@@ -0,0 +1,235 @@
+#include "bench_util.h"
+
+#include "app_config.h"
+#include "signal_generator.h"
+#include "stft_client.h"
+#include "stft_client_storage.h"
+#include "thread_util.h"
+#include "wav_file.h"
+#include "work_client.h"
+#include "work_pool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace cistft;
+
+namespace {
+static const char* USAGE =
+"usage: cistft-bench-batching [options]\n"
+"  per hop cost of one STFT request per hop against batches of consecutive hops\n"
+"  --signal <name>        white, pink, linear_chirp, log_chirp, tone_comb or impulses (default white)\n"
+"  --signal-seconds <s>   length of the signal (default 30)\n"
+"  --channels <count>     (default 1)\n"
+"  --sample-rate <hz>     (default 44100)\n"
+"  --threads <count>      worker threads, 0 is one per CPU (default 0)\n";
+
+//! the batch sizes AudioNodes::update picks from, 1 is unbatched
+static const std::size_t BATCH_SIZES[] = { 1, 2, 4, 8, 16, 32 };
+//! runs per batch size
+static const std::size_t NUM_ROUNDS = 3;
+
+/*!
+ * \class HopRequest
+ * \brief a range of consecutive hops, the headless twin of stft::Request.
+ */
+class HopRequest : public work::Request
+{
+public:
+	HopRequest(std::size_t first_hop, std::size_t num_hops) : mFirstHop(first_hop), mNumHops(num_hops) {}
+
+	std::size_t		mFirstHop;
+	std::size_t		mNumHops;
+};
+
+thread_local static stft::ClientStorage* _storage = nullptr;
+
+/*!
+ * \class HopClient
+ * \brief windows and transforms every hop of a request, like stft::Client::handle
+ * does without the renderer. With transforms off only the dispatch is left.
+ */
+class HopClient : public work::Client
+{
+public:
+	HopClient(work::Manager& manager, const AppConfig* config = nullptr, const stft::Client::Format& fmt = stft::Client::Format(), const audio::SampleView& input = audio::SampleView(), std::size_t hop_size = 1)
+		: work::Client(manager)
+		, mFormat(fmt)
+		, mConfig(*config)
+		, mInput(input)
+		, mHopSize(hop_size)
+		, mTransform(true)
+		, mPending(0)
+	{}
+
+	void handle(work::RequestRef req) override
+	{
+		auto request_ptr = static_cast<HopRequest*>(req.get());
+
+		if (mTransform)
+		{
+			auto& storage = getStorage();
+			for (auto hop = request_ptr->mFirstHop; hop < request_ptr->mFirstHop + request_ptr->mNumHops; ++hop)
+			{
+				stft::windowInterleavedHop(storage, mInput.getFrames(hop * mHopSize), mInput.mEncoding);
+				stft::transformHop(storage, false);
+			}
+		}
+
+		//! the request goes back to the pool before the main thread is woken up
+		req.reset();
+		if (mPending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			std::lock_guard<std::mutex> _lock(mDoneLock);
+			mDone.notify_all();
+		}
+	}
+
+	//! \brief posts num_hops hops in requests of batch_size hops, lockstep waits for each request.
+	void run(std::size_t num_hops, std::size_t batch_size, bool lockstep)
+	{
+		for (std::size_t first_hop = 0; first_hop < num_hops; first_hop += batch_size)
+		{
+			auto request = mPool.acquire(first_hop, std::min(batch_size, num_hops - first_hop));
+			mPending.fetch_add(1, std::memory_order_relaxed);
+			this->request(request);
+
+			if (lockstep) wait();
+		}
+		wait();
+	}
+
+	void			setTransform(bool transform) { mTransform = transform; }
+
+private:
+	void wait()
+	{
+		std::unique_lock<std::mutex> _lock(mDoneLock);
+		mDone.wait(_lock, [this] { return mPending.load(std::memory_order_acquire) == 0; });
+	}
+
+	stft::ClientStorage& getStorage()
+	{
+		if (!_storage)
+		{
+			std::lock_guard<std::mutex> _lock(mStorageLock);
+			mStorage.push_back(std::make_unique<stft::ClientStorage>(mFormat, mConfig));
+			_storage = mStorage.back().get();
+		}
+		return *_storage;
+	}
+
+private:
+	stft::Client::Format	mFormat;
+	const AppConfig&		mConfig;
+	audio::SampleView		mInput;
+	std::size_t				mHopSize;
+	bool					mTransform;
+	work::RequestPool<HopRequest>
+							mPool;
+	std::atomic<std::size_t>
+							mPending;
+	std::mutex				mDoneLock;
+	std::condition_variable	mDone;
+	std::mutex				mStorageLock;
+	std::vector<std::unique_ptr<stft::ClientStorage>>
+							mStorage;
+};
+
+//! prints wall and CPU nanoseconds per hop of every batch size
+static void _run_table(HopClient& client, std::size_t num_hops, bool lockstep)
+{
+	const auto _num_sizes = sizeof(BATCH_SIZES) / sizeof(BATCH_SIZES[0]);
+	std::vector<double> _wall(_num_sizes), _cpu(_num_sizes);
+
+	for (std::size_t i = 0; i < _num_sizes; ++i)
+	{
+		client.run(num_hops, BATCH_SIZES[i], lockstep); // warms the pool and the storages up
+
+		// the best of a few runs, the one least disturbed by the rest of the machine
+		for (std::size_t round = 0; round < NUM_ROUNDS; ++round)
+		{
+			const auto _wall_start = work::getTimestamp();
+			const auto _cpu_start = work::getProcessCpuTime();
+			client.run(num_hops, BATCH_SIZES[i], lockstep);
+			const auto _wall_time = static_cast<double>(work::getTimestamp() - _wall_start) / num_hops;
+			const auto _cpu_time = static_cast<double>(work::getProcessCpuTime() - _cpu_start) / num_hops;
+
+			if (round == 0 || _cpu_time < _cpu[i]) { _wall[i] = _wall_time; _cpu[i] = _cpu_time; }
+		}
+	}
+
+	// the largest batch is as close to free dispatch as it gets, overhead is measured against it
+	std::printf("%-6s %12s %12s %16s\n", "batch", "wall ns/hop", "cpu ns/hop", "cpu overhead/hop");
+	for (std::size_t i = 0; i < _num_sizes; ++i)
+	{
+		std::printf("%-6zu %12.0f %12.0f %16.0f\n", BATCH_SIZES[i], _wall[i], _cpu[i], _cpu[i] - _cpu.back());
+	}
+	std::printf("\n");
+}
+} //!namespace
+
+int main(int argc, char** argv)
+{
+	if (bench::hasArg(argc, argv, "--help"))
+	{
+		std::fputs(USAGE, stderr);
+		return 1;
+	}
+
+	audio::SignalType _type = audio::SignalType::WhiteNoise;
+	if (!audio::SignalGenerator::parseSignalName(bench::getArg(argc, argv, "--signal", "white"), _type))
+	{
+		std::fputs(USAGE, stderr);
+		return 1;
+	}
+
+	const auto _signal = audio::SignalGenerator::Format()
+		.signal(_type)
+		.channels(std::atoi(bench::getArg(argc, argv, "--channels", "1")))
+		.sampleRate(std::atoi(bench::getArg(argc, argv, "--sample-rate", "44100")));
+	const auto _seconds = std::atof(bench::getArg(argc, argv, "--signal-seconds", "30"));
+
+	audio::SignalGenerator _generator(_signal);
+	const auto _frames = static_cast<std::size_t>(std::max(_seconds, 1.0) * _signal.getSampleRate());
+	std::vector<float> _samples(_frames * _signal.getChannelSize());
+	_generator.generateInterleaved(_samples.data(), _frames);
+	const audio::SampleView _input(_samples.data(), _frames, _signal.getChannelSize(), audio::SampleEncoding::Float32);
+
+	AppConfig _config;
+	_config.fftBackend(fft::BackendType::Portable);
+	_config.workerThreads(std::atoi(bench::getArg(argc, argv, "--threads", "0")));
+	_config.sampleRate(_signal.getSampleRate());
+	_config.setup();
+
+	const auto _format = stft::Client::Format()
+		.channels(_signal.getChannelSize())
+		.fftSize(_config.getCalculatedFftSize())
+		.windowSize(_config.getWindowDurationInSamples())
+		.decimation(_config.getDecimationFactor());
+	const auto _hop_size = static_cast<std::size_t>(std::max(_config.getHopDurationInSamples(), 1));
+	const auto _num_hops = (_frames - _format.getWindowSize()) / _hop_size + 1;
+
+	work::Manager _manager(_config.getNumWorkerThreadsToSpawn());
+	auto _client = std::static_pointer_cast<HopClient>(work::make_client<HopClient>(_manager, &_config, _format, _input, _hop_size));
+
+	std::printf("%s, %zu channels, %zu hops of %zu samples, FFT %d, %zu threads\n\n",
+		audio::SignalGenerator::getSignalName(_type), _signal.getChannelSize(), _num_hops, _hop_size, _config.getCalculatedFftSize(), _manager.getNumThreads());
+
+	for (int transform = 0; transform < 2; ++transform)
+	{
+		_client->setTransform(transform != 0);
+		for (int lockstep = 0; lockstep < 2; ++lockstep)
+		{
+			std::printf("%s, %s\n",
+				transform ? "window and transform" : "dispatch only",
+				lockstep ? "one request in flight (a worker wakes up per request)" : "all requests posted at once");
+			_run_table(*_client, _num_hops, lockstep != 0);
+		}
+	}
+
+	return 0;
+}
\ No newline at end of file
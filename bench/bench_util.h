@@ -0,0 +1,87 @@
+#ifndef CISTFT_BENCH_BENCH_UTIL_H_
+#define CISTFT_BENCH_BENCH_UTIL_H_
+
+#include "work_metrics.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace cistft {
+namespace bench {
+
+/*!
+ * \brief answers the nanoseconds one call of fn takes, the best of
+ * num_rounds rounds of num_calls calls each.
+ * \note the best round is the one least disturbed by the rest of the machine.
+ */
+template<class F>
+static double measure(F fn, std::size_t num_calls, std::size_t num_rounds = 5)
+{
+	double _best = 0.0;
+	for (std::size_t round = 0; round < num_rounds; ++round)
+	{
+		const auto _started = work::getTimestamp();
+		for (std::size_t call = 0; call < num_calls; ++call) fn();
+		const auto _elapsed = static_cast<double>(work::getTimestamp() - _started) / num_calls;
+
+		if (round == 0 || _elapsed < _best) _best = _elapsed;
+	}
+	return _best;
+}
+
+//! \brief answers how many calls of roughly ns_per_call fill a round of about 50 ms, at least one.
+inline std::size_t getNumCalls(double ns_per_call)
+{
+	const auto _calls = ns_per_call > 0.0 ? 5.0e7 / ns_per_call : 1.0;
+	return static_cast<std::size_t>(std::max(_calls, 1.0));
+}
+
+//! \brief answers the nanoseconds per call of fn, rounds sized by a first timing.
+template<class F>
+static double measure(F fn)
+{
+	return measure(fn, getNumCalls(measure(fn, 1, 1)));
+}
+
+//! \brief answers where keep() stores, a volatile pointer the compiler has to write.
+inline const void* volatile& getSink()
+{
+	static const void* volatile _sink = nullptr;
+	return _sink;
+}
+
+/*!
+ * \brief keeps the compiler from optimizing a result away.
+ */
+inline void keep(const void* ptr)
+{
+	getSink() = ptr;
+}
+
+//! \brief answers the value after name in argv, or fallback.
+inline const char* getArg(int argc, char** argv, const char* name, const char* fallback)
+{
+	for (int i = 1; i + 1 < argc; ++i)
+	{
+		if (std::strcmp(argv[i], name) == 0) return argv[i + 1];
+	}
+	return fallback;
+}
+
+//! \brief answers true if name is on the command line.
+inline bool hasArg(int argc, char** argv, const char* name)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], name) == 0) return true;
+	}
+	return false;
+}
+
+}} // !namespace cistft::bench
+
+#endif // !CISTFT_BENCH_BENCH_UTIL_H_
\ No newline at end of file
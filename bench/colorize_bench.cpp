@@ -0,0 +1,138 @@
+#include "bench_util.h"
+
+#include "color_pallete.h"
+#include "palette_manager.h"
+#include "palette_table.h"
+
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace cistft;
+
+namespace {
+static const char* USAGE =
+"usage: cistft-bench-colorize\n"
+"  colorizes a 1024 bins x 50 rows surface, the old per pixel palette call\n"
+"  against the precomputed color table, linear and in decibels\n";
+
+static const std::size_t NUM_BINS = 1024;
+static const std::size_t NUM_ROWS = 50;
+
+/*!
+ * \class LegacyPalette
+ * \brief what palette::Manager::getActivePaletteColor did before color tables:
+ * atomic settings, an optional linearToDecibel and a std::function call per pixel.
+ */
+class LegacyPalette
+{
+public:
+	LegacyPalette()
+		: mLinearCoefficient(1024.0f)
+		, mDbDivisor(100.0f)
+		, mMinThreshold(0.0f)
+		, mMaxThreshold(1.0f)
+		, mConvertToDb(false)
+		, mColorProvider([](float v, float min, float max)->const palette::Color&{ return palette::getColor<palette::MatlabJet>(v, min, max); })
+	{}
+
+	void setConvertToDb(bool convert) { mConvertToDb = convert; }
+
+	const palette::Color& getActivePaletteColor(float value)
+	{
+		const float _min = mMinThreshold;
+		const float _max = mMaxThreshold;
+		const float _value = mConvertToDb ? linearToDecibel(value) / mDbDivisor : mLinearCoefficient * value;
+
+		// the provider was swapped under a lock, readers called it without one
+		return mColorProvider(_value, _min, _max);
+	}
+
+	//! ci::audio::linearToDecibel
+	static float linearToDecibel(float gain) { return gain < 1e-5f ? 0.0f : 20.0f * std::log10(gain) + 100.0f; }
+
+private:
+	std::atomic<float>	mLinearCoefficient;
+	std::atomic<float>	mDbDivisor;
+	std::atomic<float>	mMinThreshold;
+	std::atomic<float>	mMaxThreshold;
+	std::atomic<bool>	mConvertToDb;
+	std::function<const palette::Color&(float, float, float)>
+						mColorProvider;
+};
+
+//! StftSurface::processRow before color tables, into a ci::Surface32f sized RGB float surface
+static void _colorize_legacy(LegacyPalette& palette, const std::vector<float>& spectrum, std::vector<float>& surface)
+{
+	for (std::size_t row = 0; row < NUM_ROWS; ++row)
+	{
+		const float* in = spectrum.data() + row * NUM_BINS;
+		float* out = surface.data() + row * NUM_BINS * 3;
+		for (std::size_t x = 0; x < NUM_BINS; ++x)
+		{
+			const auto& c = palette.getActivePaletteColor(in[x]);
+			out[x * 3 + 0] = c.r;
+			out[x * 3 + 1] = c.g;
+			out[x * 3 + 2] = c.b;
+		}
+	}
+}
+
+//! what the STFT client does now, one pinned table per row
+static void _colorize_table(const std::vector<float>& spectrum, std::vector<std::uint32_t>& surface)
+{
+	for (std::size_t row = 0; row < NUM_ROWS; ++row)
+	{
+		const palette::Manager::TableGuard table;
+		table->colorize(spectrum.data() + row * NUM_BINS, surface.data() + row * NUM_BINS, NUM_BINS);
+	}
+}
+} //!namespace
+
+int main(int argc, char** argv)
+{
+	if (bench::hasArg(argc, argv, "--help"))
+	{
+		std::fputs(USAGE, stderr);
+		return 1;
+	}
+
+	// normalized magnitudes, mostly quiet with a few loud bins, like a real spectrum
+	std::mt19937 _random(1);
+	std::exponential_distribution<float> _magnitude(2000.0f);
+	std::vector<float> _linear(NUM_BINS * NUM_ROWS), _decibel(NUM_BINS * NUM_ROWS);
+	for (std::size_t i = 0; i < _linear.size(); ++i)
+	{
+		_linear[i] = _magnitude(_random);
+		_decibel[i] = LegacyPalette::linearToDecibel(_linear[i]); // dsp::powerSmoothDecibel hands the table decibels
+	}
+
+	std::vector<float> _legacy_surface(NUM_BINS * NUM_ROWS * 3);
+	std::vector<std::uint32_t> _table_surface(NUM_BINS * NUM_ROWS);
+	LegacyPalette _legacy;
+
+	std::printf("%zu bins x %zu rows, times are per surface\n\n", NUM_BINS, NUM_ROWS);
+	std::printf("%-8s %14s %14s %8s\n", "mode", "per pixel", "color table", "speedup");
+
+	for (int decibel = 0; decibel < 2; ++decibel)
+	{
+		_legacy.setConvertToDb(decibel != 0);
+		palette::Manager::instance().setConvertToDb(decibel != 0);
+
+		const auto _legacy_time = bench::measure([&] {
+			_colorize_legacy(_legacy, _linear, _legacy_surface);
+			bench::keep(_legacy_surface.data());
+		});
+		const auto _table_time = bench::measure([&] {
+			_colorize_table(decibel ? _decibel : _linear, _table_surface);
+			bench::keep(_table_surface.data());
+		});
+
+		std::printf("%-8s %11.1f us %11.1f us %7.1fx\n", decibel ? "dB" : "linear",
+			_legacy_time * 1e-3, _table_time * 1e-3, _legacy_time / _table_time);
+	}
+
+	return 0;
+}
\ No newline at end of file
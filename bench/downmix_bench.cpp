@@ -0,0 +1,103 @@
+#include "bench_util.h"
+
+#include "spectrum_kernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace cistft;
+
+namespace {
+static const char* USAGE =
+"usage: cistft-bench-downmix\n"
+"  averages and windows a 40 ms hop at 44.1 kHz into a 4096 point FFT buffer,\n"
+"  the old zero, accumulate and window passes against dsp::downmixWindow,\n"
+"  at 1, 2, 8 and 32 channels\n";
+
+static const std::size_t WINDOW_SIZE = 1764;
+static const std::size_t FFT_SIZE = 4096;
+static const std::size_t CHANNEL_COUNTS[] = { 1, 2, 8, 32 };
+
+//! stft::windowHop before the fused kernel, one side of the ring wrap
+static void _downmix_legacy(const float* const* channels, std::size_t num_channels, const float* window, float scale, float* input)
+{
+	std::fill(input, input + FFT_SIZE, 0.0f);
+
+	if (num_channels > 1)
+	{
+		for (std::size_t ch = 0; ch < num_channels; ch++)
+		{
+			for (std::size_t i = 0; i < WINDOW_SIZE; i++)
+			{
+				input[i] += channels[ch][i] * scale;
+			}
+		}
+
+		for (std::size_t i = 0; i < WINDOW_SIZE; i++)
+		{
+			input[i] *= window[i];
+		}
+	}
+	else
+	{
+		for (std::size_t i = 0; i < WINDOW_SIZE; i++)
+		{
+			input[i] = channels[0][i] * window[i];
+		}
+	}
+}
+
+//! what stft::windowHop does now
+static void _downmix_fused(const float* const* channels, std::size_t num_channels, const float* window, float scale, float* input)
+{
+	dsp::downmixWindow(channels, num_channels, WINDOW_SIZE, window, scale, input);
+	std::fill(input + WINDOW_SIZE, input + FFT_SIZE, 0.0f);
+}
+} //!namespace
+
+int main(int argc, char** argv)
+{
+	if (bench::hasArg(argc, argv, "--help"))
+	{
+		std::fputs(USAGE, stderr);
+		return 1;
+	}
+
+	std::vector<float> _window(WINDOW_SIZE);
+	for (std::size_t i = 0; i < WINDOW_SIZE; ++i) _window[i] = 0.5f - 0.5f * std::cos(6.2831853f * i / (WINDOW_SIZE - 1));
+
+	std::vector<float> _legacy_input(FFT_SIZE), _fused_input(FFT_SIZE);
+
+	std::printf("%zu samples into %zu, %s kernels, times are per hop\n\n", WINDOW_SIZE, FFT_SIZE, dsp::getKernelIsaName());
+	std::printf("%-8s %12s %12s %8s %10s\n", "channels", "three pass", "fused", "speedup", "max diff");
+
+	for (auto num_channels : CHANNEL_COUNTS)
+	{
+		std::vector<std::vector<float>> _samples(num_channels, std::vector<float>(WINDOW_SIZE));
+		std::vector<const float*> _channels(num_channels);
+		for (std::size_t ch = 0; ch < num_channels; ++ch)
+		{
+			for (std::size_t i = 0; i < WINDOW_SIZE; ++i) _samples[ch][i] = std::sin(0.01f * i * (ch + 1));
+			_channels[ch] = _samples[ch].data();
+		}
+		const float _scale = num_channels > 1 ? 1.0f / num_channels : 1.0f;
+
+		const auto _legacy_time = bench::measure([&] {
+			_downmix_legacy(_channels.data(), num_channels, _window.data(), _scale, _legacy_input.data());
+			bench::keep(_legacy_input.data());
+		});
+		const auto _fused_time = bench::measure([&] {
+			_downmix_fused(_channels.data(), num_channels, _window.data(), _scale, _fused_input.data());
+			bench::keep(_fused_input.data());
+		});
+
+		float _diff = 0.0f;
+		for (std::size_t i = 0; i < FFT_SIZE; ++i) _diff = std::max(_diff, std::fabs(_legacy_input[i] - _fused_input[i]));
+
+		std::printf("%-8zu %9.2f us %9.2f us %7.1fx %10g\n", num_channels,
+			_legacy_time * 1e-3, _fused_time * 1e-3, _legacy_time / _fused_time, _diff);
+	}
+
+	return 0;
+}
\ No newline at end of file
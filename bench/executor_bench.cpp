@@ -0,0 +1,239 @@
+#include "bench_util.h"
+
+#include "work_client.h"
+#include "work_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#if defined(CISTFT_BENCH_ASIO)
+#	include <boost/asio/io_service.hpp>
+#	include <boost/asio/post.hpp>
+#endif
+
+using namespace cistft;
+
+namespace {
+static const char* USAGE =
+"usage: cistft-bench-executor [options]\n"
+"  dispatch throughput and wait latency of work::Manager, 1 to 32 workers,\n"
+"  against the Boost.Asio pool it replaced (when Boost was found at configure time).\n"
+"  every run checks each request was handled exactly once, exits 1 if not.\n"
+"  --requests <count>     requests per run (default 500000)\n"
+"  --max-workers <count>  (default 32)\n"
+"  --spin <count>         busy loop iterations per request (default 100)\n";
+
+//! in flight per worker while latency is measured, a busy pool without a backlog
+static const std::size_t WAVE_PER_WORKER = 4;
+
+/*!
+ * \class CountedRequest
+ * \brief knows its index in the run and when it was posted.
+ */
+class CountedRequest : public work::Request
+{
+public:
+	CountedRequest(std::size_t index, std::uint64_t post_time) : mIndex(index), mPostTime(post_time) {}
+
+	std::size_t		mIndex;
+	std::uint64_t	mPostTime;
+};
+
+/*!
+ * \class CountingClient
+ * \brief marks every handled request, keeps its wait time and spins a little.
+ */
+class CountingClient : public work::Client
+{
+public:
+	CountingClient(work::Manager& manager, std::size_t num_requests = 0, std::size_t spin = 0)
+		: work::Client(manager)
+		, mHandled(num_requests)
+		, mWaitTime(num_requests)
+		, mSpin(spin)
+		, mNumHandled(0)
+	{}
+
+	void handle(work::RequestRef req) override
+	{
+		const auto _started = work::getTimestamp();
+		auto request_ptr = static_cast<CountedRequest*>(req.get());
+
+		mHandled[request_ptr->mIndex].fetch_add(1, std::memory_order_relaxed);
+		mWaitTime[request_ptr->mIndex] = _started - request_ptr->mPostTime;
+
+		volatile std::size_t _sink = 0;
+		for (std::size_t i = 0; i < mSpin; ++i) _sink = _sink + i;
+
+		req.reset();
+		mNumHandled.fetch_add(1, std::memory_order_release);
+	}
+
+	//! \brief forgets every request of the last run.
+	void reset()
+	{
+		for (auto& handled : mHandled) handled.store(0, std::memory_order_relaxed);
+		mNumHandled.store(0, std::memory_order_relaxed);
+	}
+
+	//! \brief spins until count requests are handled.
+	void waitFor(std::size_t count) const
+	{
+		while (mNumHandled.load(std::memory_order_acquire) < count) std::this_thread::yield();
+	}
+
+	//! \brief answers true if every request was handled exactly once.
+	bool isExactlyOnce() const
+	{
+		return std::all_of(mHandled.begin(), mHandled.end(), [](const std::atomic<std::uint8_t>& handled) { return handled.load() == 1; });
+	}
+
+	//! \brief answers the wait time at a percentile, in nanoseconds. Sorts the wait times.
+	std::uint64_t getWaitTime(double percentile)
+	{
+		std::sort(mWaitTime.begin(), mWaitTime.end());
+		const auto _index = static_cast<std::size_t>(percentile / 100.0 * (mWaitTime.size() - 1));
+		return mWaitTime[_index];
+	}
+
+	work::RequestPool<CountedRequest>	mPool;
+
+private:
+	std::vector<std::atomic<std::uint8_t>>
+										mHandled;
+	std::vector<std::uint64_t>			mWaitTime;
+	std::size_t							mSpin;
+	std::atomic<std::size_t>			mNumHandled;
+};
+
+#if defined(CISTFT_BENCH_ASIO)
+/*!
+ * \class AsioPool
+ * \brief work::Manager before the work-stealing executor: one io_service
+ * run by every thread, a heap request and a heap handler per post.
+ */
+class AsioPool
+{
+public:
+	explicit AsioPool(std::size_t num_threads)
+		: mWorker(mIoService)
+	{
+		for (auto count = num_threads; count > 0; --count)
+		{
+			mThreads.emplace_back([this] { mIoService.run(); });
+		}
+	}
+
+	~AsioPool()
+	{
+		mIoService.stop();
+		for (auto& thread : mThreads) thread.join();
+	}
+
+	void post(const work::ClientRef& requester, work::RequestRef& request)
+	{
+		// the old code bound the request with std::bind, newer Asio wants a movable handler instead
+		if (requester && request)
+			boost::asio::post(mIoService, [requester, w = std::move(request)]() mutable { requester->handle(std::move(w)); });
+	}
+
+private:
+	boost::asio::io_service			mIoService;
+	boost::asio::io_service::work	mWorker;
+	std::vector<std::thread>		mThreads;
+};
+#endif // CISTFT_BENCH_ASIO
+
+/*!
+ * \brief posts num_requests requests from this thread, all at once or in waves
+ * of wave_size, and answers the nanoseconds per request.
+ * \param make_request builds the index-th request, post hands it to the pool
+ */
+template<class MakeRequest, class Post>
+static double _run(CountingClient& client, std::size_t num_requests, std::size_t wave_size, MakeRequest make_request, Post post)
+{
+	client.reset();
+	const auto _started = work::getTimestamp();
+
+	for (std::size_t index = 0; index < num_requests; ++index)
+	{
+		auto request = make_request(index);
+		post(request);
+
+		if ((index + 1) % wave_size == 0) client.waitFor(index + 1);
+	}
+	client.waitFor(num_requests);
+
+	return static_cast<double>(work::getTimestamp() - _started) / num_requests;
+}
+
+//! prints one row, answers false if a request was lost or handled twice
+template<class MakeRequest, class Post>
+static bool _run_row(const char* name, std::size_t num_workers, CountingClient& client, std::size_t num_requests, MakeRequest make_request, Post post)
+{
+	const auto _burst = _run(client, num_requests, num_requests, make_request, post);
+	bool _exact = client.isExactlyOnce();
+
+	_run(client, num_requests, num_workers * WAVE_PER_WORKER, make_request, post);
+	_exact = _exact && client.isExactlyOnce();
+
+	std::printf("%-9s %7zu %12.2f %10.1f %10.1f %10.1f %10.1f%s\n", name, num_workers, 1e3 / _burst,
+		client.getWaitTime(50) * 1e-3, client.getWaitTime(99) * 1e-3, client.getWaitTime(99.9) * 1e-3, client.getWaitTime(100) * 1e-3,
+		_exact ? "" : "  NOT EXACTLY ONCE");
+	return _exact;
+}
+} //!namespace
+
+int main(int argc, char** argv)
+{
+	if (bench::hasArg(argc, argv, "--help"))
+	{
+		std::fputs(USAGE, stderr);
+		return 1;
+	}
+
+	const auto _num_requests = static_cast<std::size_t>(std::atoi(bench::getArg(argc, argv, "--requests", "500000")));
+	const auto _max_workers = static_cast<std::size_t>(std::atoi(bench::getArg(argc, argv, "--max-workers", "32")));
+	const auto _spin = static_cast<std::size_t>(std::atoi(bench::getArg(argc, argv, "--spin", "100")));
+
+	std::printf("%zu requests per run, %zu spins each. throughput with every request posted at once,\n"
+				"wait times (posted to started) with %zu requests per worker in flight\n\n", _num_requests, _spin, WAVE_PER_WORKER);
+	std::printf("%-9s %7s %12s %10s %10s %10s %10s\n", "pool", "workers", "Mreq/s", "p50 us", "p99 us", "p99.9 us", "max us");
+
+	bool _exact = true;
+	for (std::size_t workers = 1; workers <= std::max<std::size_t>(_max_workers, 1); workers *= 2)
+	{
+		{
+			work::Manager _manager(workers);
+			auto _client = std::static_pointer_cast<CountingClient>(work::make_client<CountingClient>(_manager, _num_requests, _spin));
+			work::ClientRef _ref = _client;
+
+			_exact = _run_row("stealing", workers, *_client, _num_requests,
+				[&](std::size_t index) { return _client->mPool.acquire(index, work::getTimestamp()); },
+				[&](work::RequestRef& request) { _ref->request(request); }) && _exact;
+		}
+
+#if defined(CISTFT_BENCH_ASIO)
+		{
+			// clients need a manager, this one never gets a request
+			work::Manager _unused(1);
+			AsioPool _pool(workers);
+			auto _client = std::static_pointer_cast<CountingClient>(work::make_client<CountingClient>(_unused, _num_requests, _spin));
+			work::ClientRef _ref = _client;
+
+			_exact = _run_row("asio", workers, *_client, _num_requests,
+				[&](std::size_t index) { return work::make_request<CountedRequest>(index, work::getTimestamp()); },
+				[&](work::RequestRef& request) { _pool.post(_ref, request); }) && _exact;
+		}
+#endif // CISTFT_BENCH_ASIO
+	}
+
+#if !defined(CISTFT_BENCH_ASIO)
+	std::fprintf(stderr, "Boost.Asio was not found at configure time, the asio rows are missing\n");
+#endif
+
+	return _exact ? 0 : 1;
+}
\ No newline at end of file
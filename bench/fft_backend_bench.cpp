@@ -0,0 +1,97 @@
+#include "bench_util.h"
+
+#include "fft_backend.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace cistft;
+
+namespace {
+static const char* USAGE =
+"usage: cistft-bench-fft_backend [options]\n"
+"  forward transform time of every FFT backend built in, per power of two size\n"
+"  --min-size <n>         smallest size (default 1024, the smallest buildBandPass picks)\n"
+"  --max-size <n>         largest size (default 65536)\n";
+
+/*!
+ * \brief answers the largest difference between two backends' bins,
+ * relative to the largest magnitude of the reference.
+ */
+static double _get_error(fft::Backend& reference, fft::Backend& backend)
+{
+	double _peak = 0.0, _error = 0.0;
+	for (std::size_t i = 0; i < reference.getSize() / 2; ++i)
+	{
+		_peak = std::max(_peak, std::hypot(static_cast<double>(reference.getReal()[i]), static_cast<double>(reference.getImag()[i])));
+		_error = std::max(_error, std::hypot(static_cast<double>(reference.getReal()[i]) - backend.getReal()[i],
+											 static_cast<double>(reference.getImag()[i]) - backend.getImag()[i]));
+	}
+	return _peak > 0.0 ? _error / _peak : _error;
+}
+} //!namespace
+
+int main(int argc, char** argv)
+{
+	if (bench::hasArg(argc, argv, "--help"))
+	{
+		std::fputs(USAGE, stderr);
+		return 1;
+	}
+
+	const auto _min_size = static_cast<std::size_t>(std::atoi(bench::getArg(argc, argv, "--min-size", "1024")));
+	const auto _max_size = static_cast<std::size_t>(std::atoi(bench::getArg(argc, argv, "--max-size", "65536")));
+
+	// FFTW plans once per size, keep the wisdom out of the working directory of the app
+	fft::setWisdomFilename("cistft-bench.wisdom");
+
+	std::vector<fft::BackendType> _types;
+	std::printf("%-8s", "size");
+	for (int index = 0; index < static_cast<int>(fft::BackendType::Count); ++index)
+	{
+		const auto _type = static_cast<fft::BackendType>(index);
+		if (!fft::isBackendAvailable(_type))
+		{
+			std::fprintf(stderr, "%s is not built in, skipped\n", fft::getBackendName(_type));
+			continue;
+		}
+		_types.push_back(_type);
+		std::printf(" %14s %9s", fft::getBackendName(_type), "error");
+	}
+	std::printf("\n");
+
+	std::mt19937 _random(1);
+	std::uniform_real_distribution<float> _value(-1.0f, 1.0f);
+
+	for (auto size = std::max<std::size_t>(_min_size, 2); size <= _max_size; size *= 2)
+	{
+		std::vector<float> _signal(size);
+		for (auto& sample : _signal) sample = _value(_random);
+
+		// the portable backend is always there, the others are checked against it
+		auto _reference = fft::make_backend(fft::BackendType::Portable, size);
+		std::memcpy(_reference->getInput(), _signal.data(), size * sizeof(float));
+		_reference->forward();
+
+		std::printf("%-8zu", size);
+		for (const auto type : _types)
+		{
+			auto _backend = fft::make_backend(type, size);
+
+			// the input is undefined after a transform, refilling it is part of every hop anyway
+			const auto _time = bench::measure([&] {
+				std::memcpy(_backend->getInput(), _signal.data(), size * sizeof(float));
+				_backend->forward();
+				bench::keep(_backend->getReal());
+			});
+
+			std::printf(" %11.2f us %9.1e", _time * 1e-3, _get_error(*_reference, *_backend));
+		}
+		std::printf("\n");
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "bench_util.h"
+
+#include "spectrum_kernel.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace cistft;
+
+namespace {
+static const char* USAGE =
+"usage: cistft-bench-spectrum\n"
+"  magnitude and smoothing of FFT sizes 1024 to 65536, the scalar loop the\n"
+"  STFT client used to run against dsp::magnitudeSmooth and dsp::powerSmoothDecibel\n";
+
+static const std::size_t MIN_FFT_SIZE = 1024;
+static const std::size_t MAX_FFT_SIZE = 65536;
+static const float SMOOTHING = 0.5f;
+
+//! the loop stft::Client::handle ran before the kernels
+static void _magnitude_smooth_reference(const float* real, const float* imag, float* out, std::size_t size, float scale, float smoothing)
+{
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		const float& re = real[i];
+		const float& im = imag[i];
+		out[i] = out[i] * smoothing + std::sqrt(re * re + im * im) * scale * (1 - smoothing);
+	}
+}
+
+//! ci::audio::linearToDecibel, which the surface called for every pixel in dB mode
+static float _linear_to_decibel(float gain)
+{
+	return gain < 1e-5f ? 0.0f : 20.0f * std::log10(gain) + 100.0f;
+}
+
+static void _decibel_reference(const float* real, const float* imag, float* magnitude, float* decibel, std::size_t size, float scale, float smoothing)
+{
+	_magnitude_smooth_reference(real, imag, magnitude, size, scale, smoothing);
+	for (std::size_t i = 0; i < size; ++i) decibel[i] = _linear_to_decibel(magnitude[i]);
+}
+} //!namespace
+
+int main(int argc, char** argv)
+{
+	if (bench::hasArg(argc, argv, "--help"))
+	{
+		std::fputs(USAGE, stderr);
+		return 1;
+	}
+
+	std::printf("kernels: %s, times are per spectrum of fft_size / 2 bins\n\n", dsp::getKernelIsaName());
+	std::printf("%-8s %12s %12s %8s %12s %12s %8s\n", "fft", "linear old", "linear new", "speedup", "dB old", "dB new", "speedup");
+
+	std::mt19937 _random(1);
+	for (auto fft_size = MIN_FFT_SIZE; fft_size <= MAX_FFT_SIZE; fft_size *= 2)
+	{
+		const auto _bins = fft_size / 2;
+		const auto _scale = 1.0f / fft_size;
+
+		// spectra of a full scale signal peak around fft_size / 2, most bins are far below
+		std::uniform_real_distribution<float> _value(-0.5f * fft_size, 0.5f * fft_size);
+		std::vector<float> _real(_bins), _imag(_bins);
+		for (std::size_t i = 0; i < _bins; ++i)
+		{
+			const auto _attenuation = std::pow(10.0f, -5.0f * i / _bins);
+			_real[i] = _value(_random) * _attenuation;
+			_imag[i] = _value(_random) * _attenuation;
+		}
+
+		std::vector<float> _magnitude(_bins, 0.0f), _power(_bins, 0.0f), _decibel(_bins, 0.0f);
+
+		const auto _linear_old = bench::measure([&] {
+			_magnitude_smooth_reference(_real.data(), _imag.data(), _magnitude.data(), _bins, _scale, SMOOTHING);
+			bench::keep(_magnitude.data());
+		});
+		const auto _linear_new = bench::measure([&] {
+			dsp::magnitudeSmooth(_real.data(), _imag.data(), _magnitude.data(), _bins, _scale, SMOOTHING);
+			bench::keep(_magnitude.data());
+		});
+		const auto _decibel_old = bench::measure([&] {
+			_decibel_reference(_real.data(), _imag.data(), _magnitude.data(), _decibel.data(), _bins, _scale, SMOOTHING);
+			bench::keep(_decibel.data());
+		});
+		const auto _decibel_new = bench::measure([&] {
+			dsp::powerSmoothDecibel(_real.data(), _imag.data(), _power.data(), _decibel.data(), _bins, _scale, SMOOTHING);
+			bench::keep(_decibel.data());
+		});
+
+		std::printf("%-8zu %9.2f us %9.2f us %7.1fx %9.2f us %9.2f us %7.1fx\n", fft_size,
+			_linear_old * 1e-3, _linear_new * 1e-3, _linear_old / _linear_new,
+			_decibel_old * 1e-3, _decibel_new * 1e-3, _decibel_old / _decibel_new);
+	}
+
+	return 0;
+}
\ No newline at end of file
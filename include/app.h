@@ -11,6 +11,7 @@
 #include "stft_renderer.h"
 #include "monitor_renderer.h"
 #include "grid_renderer.h"
+#include "metrics_panel.h"
 
 namespace cistft
 {
@@ -39,11 +40,26 @@ public:
 	void			mouseDown(ci::app::MouseEvent event) override final;
 	//! gets fired on keyboard click
 	void			keyDown(ci::app::KeyEvent event) override final;
+	//! the events below only wake the render loop up, see paceFrameRate
+	void			mouseUp(ci::app::MouseEvent event) override final;
+	void			mouseMove(ci::app::MouseEvent event) override final;
+	void			mouseDrag(ci::app::MouseEvent event) override final;
+	void			mouseWheel(ci::app::MouseEvent event) override final;
+	void			keyUp(ci::app::KeyEvent event) override final;
+	void			resize() override final;
 	//! sets up the GUI for the time before user hits Start
 	void			setupPreLaunchGUI();
 	//! sets up the GUI for the time after user hits Start
 	void			setupPostLaunchGUI();
 
+private:
+	//! draws at the full refresh rate for a moment, called on user input
+	void			requestRedraw();
+	//! picks the frame rate of the next frames. with event driven redraw on,
+	//! full rate while the user interacts, the hop rate while rows arrive and
+	//! a slow idle rate otherwise. \see AppConfig::isEventDrivenRedraw
+	void			paceFrameRate();
+
 private:
 	//! all user configurable parameters
 	AppConfig		mAppConfig;
@@ -59,9 +75,16 @@ private:
 	MonitorRenderer	mMonitorRenderer;
 	//! simple grid renderer
 	GridRenderer	mGridRenderer;
+	//! work manager and STFT instrumentation
+	MetricsPanel	mMetricsPanel;
 	//! ciUI instance
 	ci::params::InterfaceGlRef
 					mGuiInstance;
+	//! elapsed seconds at the last user input and the last new rows
+	double			mLastInputTime;
+	double			mLastRowsTime;
+	//! the GUI swallows the events it handles, a moving cursor counts as input too
+	ci::Vec2i		mLastMousePos;
 };
 
 } //!cistft
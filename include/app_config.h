@@ -3,10 +3,14 @@
 
 #include <string>
 #include <fstream>
+#include <vector>
 
+#if !defined(CISTFT_HEADLESS)
 #include <Cinder/Color.h>
+#endif
 
 #include "audio_nodes.h"
+#include "fft_backend.h"
 
 namespace cinder {
 namespace params {
@@ -21,7 +25,6 @@ public:
 	AppConfig();
 	~AppConfig();
 
-	AppConfig&		recordDuration(float val);
 	AppConfig&		timeRange(float val);
 	AppConfig&		windowDuration(float val);
 	AppConfig&		hopDuration(float val);
@@ -29,8 +32,21 @@ public:
 	AppConfig&		minimumViewableBins(int val);
 	AppConfig&		lowPassFrequency(float val);
 	AppConfig&		highPassFrequency(float val);
+	AppConfig&		fftBackend(fft::BackendType type);
+	AppConfig&		maxWorkerLag(float val);
+	AppConfig&		workerThreads(int val);
+	AppConfig&		decimation(int factor);
+	AppConfig&		workerAffinity(const std::vector<int>& cpus);
+	AppConfig&		audioCpu(int cpu);
+	AppConfig&		inputSource(const std::string& source);
+	AppConfig&		maxRefreshRate(float fps);
+	AppConfig&		eventDrivenRedraw(bool enabled);
+	AppConfig&		monitorDuration(float val);
+#if defined(CISTFT_HEADLESS)
+	//! headless builds have no audio device, the sample rate comes from the input file
+	AppConfig&		sampleRate(int val);
+#endif
 
-	float			getRecordDuration() const;
 	float			getTimeRange() const;
 	float			getWindowDuration() const;
 	float			getHopDuration() const;
@@ -38,6 +54,34 @@ public:
 	int				getMinimumViewableBins() const;
 	float			getLowPassFrequency() const;
 	float			getHighPassFrequency() const;
+	fft::BackendType
+					getFftBackend() const;
+	float			getMaxWorkerLag() const;
+	//! answers the configured decimation factor, 0 means auto and 1 means off
+	int				getDecimation() const;
+	bool			isDecimationAuto() const;
+	//! answers the factor the recorded signal is decimated by before the transform, auto resolved
+	int				getDecimationFactor() const;
+	//! answers the configured number of workers, 0 means auto
+	int				getWorkerThreads() const;
+	bool			isWorkerThreadsAuto() const;
+	//! answers the number of worker threads to start, auto resolved
+	int				getNumWorkerThreadsToSpawn() const;
+	//! answers the CPUs workers are pinned to, empty means no pinning. never contains the audio CPU.
+	std::vector<int>
+					getWorkerAffinity() const;
+	//! answers the CPU kept free of workers for the audio callback, -1 keeps none free.
+	//! \note the audio thread belongs to the backend and is never pinned, only workers are
+	int				getAudioCpu() const;
+	//! answers "device" for the microphone, or the name of a generated signal (see audio::SignalGenerator)
+	const std::string&
+					getInputSource() const;
+	//! answers the highest number of frames drawn per second
+	float			getMaxRefreshRate() const;
+	//! answers true if frames are only drawn at full rate while rows or input events arrive
+	bool			isEventDrivenRedraw() const;
+	//! answers the length, in seconds, of the waveform shown before launch
+	float			getMonitorDuration() const;
 
 	int				getActualViewableBins() const;
 	float			getActualLowPassFrequency() const;
@@ -51,18 +95,23 @@ public:
 	void			performLaunch();
 	bool			shouldLaunch() const;
 
-	int				getRecordDurationInSamples() const;
 	int				getTimeSpanInSamples() const;
 	int				getHopDurationInSamples() const;
 	int				getWindowDurationInSamples() const;
+	int				getMaxWorkerLagInSamples() const;
+	int				getMonitorDurationInSamples() const;
 
+#if !defined(CISTFT_HEADLESS)
 	void			setupPreLaunchGUI(cinder::params::InterfaceGl* const);
 	void			setupPostLaunchGUI(cinder::params::InterfaceGl* const);
+#endif
 
 	void			setup() const;
 
 private:
+#if !defined(CISTFT_HEADLESS)
 	std::string		generateConfig() const;
+#endif
 	std::fstream	mConfigFile;
 	bool			mPreparedForLaunch;
 
@@ -72,13 +121,23 @@ private:
 	void			checkDirty() const;
 
 private:
-	float			mRecordDuration;
 	float			mTimeRange;
 	float			mWindowDuration;
 	float			mHopDuration;
 	int				mMinimumViewableBins;
 	float			mLowPassFrequency;
 	float			mHighPassFrequency;
+	int				mFftBackend;
+	float			mMaxWorkerLag;
+	int				mWorkerThreads;
+	int				mDecimation;
+	std::vector<int>
+					mWorkerAffinity;
+	int				mAudioCpu;
+	std::string		mInputSource;
+	float			mMaxRefreshRate;
+	bool			mEventDrivenRedraw;
+	float			mMonitorDuration;
 
 	mutable int		mSamplesCacheSize;
 	mutable int		mActualViewableBins;
@@ -86,6 +145,7 @@ private:
 	mutable float	mActualHighPassFrequency;
 	mutable int		mCalculatedFftSize;
 	mutable int		mMagnitudeIndexStart;
+	mutable int		mDecimationFactor;
 	mutable int		mSampleRate;
 	mutable bool	mDirty;
 };
@@ -1,20 +1,25 @@
 #ifndef CISTFT_INCLUDE_AUDIO_NODES_H_
 #define CISTFT_INCLUDE_AUDIO_NODES_H_
 
+#include <cstdint>
 #include <memory>
+#include <string>
 
 #include "work_manager.h"
 
 namespace cinder {
 namespace audio {
-class InputDeviceNode;
-class MonitorNode;
+class InputNode;
 }} //!ci::audio
 
 namespace cistft {
 namespace audio {
 class RecorderNode;
+class WaveformNode;
 } //!cistft::audio
+namespace stft {
+class Client;
+} //!cistft::stft
 class AppGlobals;
 
 /*!
@@ -33,6 +38,7 @@ public:
 	AudioNodes(AppGlobals&);
 
 	// \brief initializes nodes and connect them together
+	// \note falls back to a generated signal if there is no microphone
 	void												setupInput();
 	void												setupRecorder();
 	void												setupMonitor();
@@ -48,27 +54,40 @@ public:
 	bool												isInputReady() const;
 	bool												isRecorderReady() const;
 	bool												isMonitorReady() const;
+	// \brief returns true while reading from input
+	bool												isInputEnabled() const;
 
 	// \brief returns a pointer to the node which is recording audio
 	cistft::audio::RecorderNode* const					getBufferRecorderNode();
-	// \brief returns a pointer to the node which is having raw data in it
-	cinder::audio::MonitorNode* const					getMonitorNode();
+	// \brief returns a pointer to the node which keeps the envelope of the raw input
+	cistft::audio::WaveformNode* const					getMonitorNode();
+	// \brief returns a pointer to the STFT client, null before the recorder is set up
+	stft::Client* const									getStftClient();
 
 private:
-	std::shared_ptr<cinder::audio::InputDeviceNode>		mInputDeviceNode;
+	// \brief replaces the microphone by a generated signal, answers false if the name is unknown
+	bool												setupGenerator(const std::string& signal_name);
+	// \brief answers number of hops each STFT request carries, based on the backlog
+	std::size_t											calculateBatchSize() const;
+	// \brief answers every how many hops one is transformed, 1 unless the workers lag behind
+	std::size_t											calculateStride() const;
+	//! \brief sizes the active worker pool from the measured cost of a hop
+	void												adaptConcurrency();
+
+private:
+	std::shared_ptr<cinder::audio::InputNode>			mInputNode;		// the microphone, or a GeneratorNode
 	std::shared_ptr<cistft::audio::RecorderNode>		mBufferRecorderNode;
-	std::shared_ptr<cinder::audio::MonitorNode>			mMonitorNode;
+	std::shared_ptr<cistft::audio::WaveformNode>		mMonitorNode;
 
 private:
 	AppGlobals&											mGlobals;
-	work::ClientRef										mStftClient;
+	std::shared_ptr<stft::Client>						mStftClient;
 
 private: //state
 	bool												mIsInputReady;
 	bool												mIsRecorderReady;
 	bool												mIsMonitorReady;
 	bool												mIsEnabled;
-	std::size_t											mQueryPosition;
 };
 
 } //!cistft
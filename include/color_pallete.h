@@ -3,28 +3,41 @@
 
 #include <array>
 
+#if !defined(CISTFT_HEADLESS)
 #include <cinder/Color.h>
+#endif
 
 namespace cistft {
 namespace palette {
 
-struct MatlabJet			{ static const std::array<const ci::Color, 64> palette; };
-struct MatlabHot			{ static const std::array<const ci::Color, 64> palette; };
-struct MPLSummer			{ static const std::array<const ci::Color, 128> palette; };
-struct MPLPaired			{ static const std::array<const ci::Color, 128> palette; };
-struct MPLOcean				{ static const std::array<const ci::Color, 128> palette; };
-struct MPLWinter			{ static const std::array<const ci::Color, 128> palette; };
-struct OceanLakeLandSnow	{ static const std::array<const ci::Color, 254> palette; };
-struct SVGBhw322			{ static const std::array<const ci::Color, 220> palette; };
-struct MPLGnuplot			{ static const std::array<const ci::Color, 128> palette; };
-struct MPLFlag				{ static const std::array<const ci::Color, 128> palette; };
-struct NCVManga				{ static const std::array<const ci::Color, 256> palette; };
-struct MPLPrism				{ static const std::array<const ci::Color, 128> palette; };
-struct SVGLindaa07			{ static const std::array<const ci::Color, 220> palette; };
-struct SVGGallet13			{ static const std::array<const ci::Color, 220> palette; };
+#if defined(CISTFT_HEADLESS)
+//! \brief headless builds have no Cinder, palettes only need the three channels
+struct Color
+{
+	Color(float red, float green, float blue) : r(red), g(green), b(blue) {}
+	float r, g, b;
+};
+#else
+typedef ci::Color Color;
+#endif
+
+struct MatlabJet			{ static const std::array<const Color, 64> palette; };
+struct MatlabHot			{ static const std::array<const Color, 64> palette; };
+struct MPLSummer			{ static const std::array<const Color, 128> palette; };
+struct MPLPaired			{ static const std::array<const Color, 128> palette; };
+struct MPLOcean				{ static const std::array<const Color, 128> palette; };
+struct MPLWinter			{ static const std::array<const Color, 128> palette; };
+struct OceanLakeLandSnow	{ static const std::array<const Color, 254> palette; };
+struct SVGBhw322			{ static const std::array<const Color, 220> palette; };
+struct MPLGnuplot			{ static const std::array<const Color, 128> palette; };
+struct MPLFlag				{ static const std::array<const Color, 128> palette; };
+struct NCVManga				{ static const std::array<const Color, 256> palette; };
+struct MPLPrism				{ static const std::array<const Color, 128> palette; };
+struct SVGLindaa07			{ static const std::array<const Color, 220> palette; };
+struct SVGGallet13			{ static const std::array<const Color, 220> palette; };
 
 template<typename T>
-inline static const ci::Color& getColor(float value, float vmin, float vmax)
+inline static const Color& getColor(float value, float vmin, float vmax)
 {
 	float vd = vmax - vmin;
 
@@ -0,0 +1,65 @@
+#ifndef CISTFT_INCLUDE_FFT_BACKEND_H_
+#define CISTFT_INCLUDE_FFT_BACKEND_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace cistft {
+namespace fft {
+
+//! \brief all real-FFT engines the STFT client knows about.
+enum class BackendType
+{
+	Ooura = 0,	// Cinder's ci::audio::dsp::Fft
+	Portable,	// in-tree radix-2 implementation, always available
+	Fftw,		// FFTW3 single precision, needs CISTFT_WITH_FFTW
+	PocketFft,	// pocketfft header-only, needs CISTFT_WITH_POCKETFFT
+	Count
+};
+
+/*!
+ * \class Backend
+ * \namespace cistft::fft
+ * \brief a forward real FFT of a fixed power of two size.
+ * \note backends own their buffers. Fill getInput() with getSize() samples,
+ * call forward() and read getSize() / 2 bins from getReal() and getImag().
+ * \note imag[0] is always zero, the Nyquist bin is not reported.
+ * \note input contents are undefined after forward(), refill before every call.
+ * \note NOT thread safe. One backend per thread.
+ */
+class Backend
+{
+public:
+	virtual ~Backend() {}
+
+	virtual void			forward() = 0;
+	virtual const char*		getName() const = 0;
+
+	virtual float*			getInput() = 0;
+	virtual float*			getReal() = 0;
+	virtual float*			getImag() = 0;
+	std::size_t				getSize() const { return mSize; }
+
+protected:
+	Backend(std::size_t size) : mSize(size) {}
+
+	std::size_t				mSize;
+};
+
+typedef std::unique_ptr<Backend> BackendRef;
+
+//! \brief constructs a backend, falls back to the portable one if type is not compiled in.
+BackendRef					make_backend(BackendType type, std::size_t size);
+//! \brief answers true if type was compiled into this build.
+bool						isBackendAvailable(BackendType type);
+//! \brief answers the configuration name of a backend type. e.g. "ooura"
+const char*					getBackendName(BackendType type);
+//! \brief parses a configuration name. answers false if name is unknown.
+bool						parseBackendName(const std::string& name, BackendType& type);
+//! \brief where FFTW keeps its wisdom between runs.
+void						setWisdomFilename(const std::string& filename);
+
+}} // !namespace cistft::fft
+
+#endif // !CISTFT_INCLUDE_FFT_BACKEND_H_
\ No newline at end of file
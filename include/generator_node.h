@@ -0,0 +1,37 @@
+#ifndef CISTFT_INCLUDE_GENERATOR_NODE_H_
+#define CISTFT_INCLUDE_GENERATOR_NODE_H_
+
+#include <cinder/audio/InputNode.h>
+
+#include "signal_generator.h"
+
+namespace cistft {
+namespace audio {
+
+/*!
+ * \class GeneratorNode
+ * \namespace cistft::audio
+ * \brief stands in for the input device node, feeds the graph with a
+ * reproducible test signal instead of the microphone.
+ * \note the signal runs at the context's sample rate, whatever the
+ * format says. It restarts from the first sample on every initialize.
+ */
+class GeneratorNode : public ci::audio::InputNode
+{
+public:
+	GeneratorNode(const SignalGenerator::Format& fmt);
+
+	const SignalGenerator::Format&	getSignalFormat() const { return mSignalFormat; }
+
+protected:
+	void							initialize() override;
+	void							process(ci::audio::Buffer* buffer) override;
+
+private:
+	SignalGenerator::Format			mSignalFormat;
+	SignalGenerator					mGenerator;
+};
+
+}} // !namespace cistft::audio
+
+#endif // !CISTFT_INCLUDE_GENERATOR_NODE_H_
\ No newline at end of file
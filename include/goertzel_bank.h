@@ -0,0 +1,46 @@
+#ifndef CISTFT_INCLUDE_GOERTZEL_BANK_H_
+#define CISTFT_INCLUDE_GOERTZEL_BANK_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace cistft {
+namespace dsp {
+
+/*!
+ * \class GoertzelBank
+ * \namespace cistft::dsp
+ * \brief evaluates a contiguous range of DFT bins with one Goertzel
+ * resonator per bin. Cheaper than a full FFT when only a handful of
+ * bins are visible.
+ * \note output is written in the same real / imaginary layout an FFT
+ * would produce (unscaled), so the spectrum kernels apply unchanged.
+ * \note only the non-zero part of a zero padded frame has to be fed in,
+ * the resonator energy does not change over trailing zeros.
+ */
+class GoertzelBank
+{
+public:
+	GoertzelBank(std::size_t fft_size, std::size_t bin_start, std::size_t bin_count);
+
+	//! runs all resonators over input and writes bin_count complex bins into real / imag
+	void					process(const float* input, std::size_t input_size, float* real, float* imag) const;
+
+	std::size_t				getBinStart() const { return mBinStart; }
+	std::size_t				getBinCount() const { return mBinCount; }
+
+	//! answers true if a Goertzel bank is estimated to beat a real FFT of fft_size
+	static bool				isCheaperThanFft(std::size_t bin_count, std::size_t input_size, std::size_t fft_size);
+
+private:
+	std::size_t				mFftSize;
+	std::size_t				mBinStart;
+	std::size_t				mBinCount;
+	std::vector<double>		mCoefficients;	// 2 * cos(w)
+	std::vector<double>		mCosines;		// cos(w)
+	std::vector<double>		mSines;			// sin(w)
+};
+
+}} // !namespace cistft::dsp
+
+#endif // !CISTFT_INCLUDE_GOERTZEL_BANK_H_
\ No newline at end of file
@@ -1,7 +1,11 @@
 #ifndef CISTFT_INCLUDE_GRID_RENDERER_H_
 #define CISTFT_INCLUDE_GRID_RENDERER_H_
 
+#include <string>
+#include <vector>
+
 #include <cinder/Color.h>
+#include <cinder/gl/Texture.h>
 
 namespace cinder {
 namespace params {
@@ -12,6 +16,14 @@ namespace cistft {
 
 class AppGlobals;
 
+/*!
+ * \class GridRenderer
+ * \namespace cistft
+ * \brief draws the grid lines and the axis labels over the spectrogram.
+ * \note labels are drawn out of a glyph atlas rasterized once, lines
+ * and glyph quads are each drawn in a single call. Their geometry is
+ * only rebuilt when a tick value, a unit or the layout changes.
+ */
 class GridRenderer
 {
 public:
@@ -28,6 +40,20 @@ public:
 	void			setHorizontalUnit(const std::string& str);
 	void			setVerticalUnit(const std::string& str);
 
+private:
+	//! one printable ASCII character in the atlas, sizes in pixels
+	struct Glyph
+	{
+		float		mU0, mV0, mU1, mV1;
+		float		mWidth, mHeight;
+	};
+
+	void			buildAtlas();
+	bool			isGeometryStale() const;
+	void			buildGeometry();
+	//! appends the quads of a label centered on x, baseline at y. rotated labels read bottom up.
+	void			appendLabel(const std::string& text, float x, float y, bool rotated);
+
 private:
 	AppGlobals&		mGlobals;
 
@@ -47,6 +73,24 @@ private:
 	std::string		mVerticalUnitTextToDraw;
 	std::string		mHorizontalUnit;
 	std::string		mHorizontalUnitTextToDraw;
+
+private: // cached drawing state
+	ci::gl::TextureRef
+					mAtlas;
+	std::vector<Glyph>
+					mGlyphs;
+	float			mAscent;
+	std::vector<float>
+					mLineVertices;	// x, y
+	std::vector<float>
+					mLabelVertices;	// x, y, u, v
+	bool			mGeometryDirty;
+	int				mBuiltWidth;
+	int				mBuiltHeight;
+	int				mBuiltStepX;
+	int				mBuiltStepY;
+	int				mBuiltLabelFrequency;
+	float			mBuiltLabelMargin;
 };
 
 } // !namespace cistft
@@ -0,0 +1,86 @@
+#ifndef CISTFT_INCLUDE_INDEX_FREE_LIST_H_
+#define CISTFT_INCLUDE_INDEX_FREE_LIST_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace cistft {
+namespace work {
+
+/*!
+ * \class IndexFreeList
+ * \namespace cistft::work
+ *
+ * \brief a lock-free stack of free slots in a preallocated array.
+ * Owners keep the objects, the list only hands out their indices.
+ *
+ * \note push and pop may be called from any thread. The head carries a
+ * tag bumped on every change, a pop racing a pop-push-pop of the same
+ * index fails its compare exchange instead of corrupting the list (ABA).
+ */
+class IndexFreeList
+{
+public:
+	IndexFreeList() : mHead(0), mCapacity(0) {}
+
+	/*!
+	 * \brief sizes the list and marks every index in [0, capacity) free.
+	 * \note not thread safe, call it before any push or pop.
+	 */
+	void reset(std::uint32_t capacity)
+	{
+		mNext.reset(new std::atomic<std::uint32_t>[capacity]);
+		for (std::uint32_t index = 0; index < capacity; ++index)
+		{
+			// links are index + 1, 0 ends the list
+			mNext[index].store(index + 1 < capacity ? index + 2 : 0, std::memory_order_relaxed);
+		}
+		mCapacity = capacity;
+		mHead.store(capacity > 0 ? 1 : 0, std::memory_order_release);
+	}
+
+	//! \brief takes a free index. Answers false if every index is in use.
+	bool pop(std::uint32_t& index)
+	{
+		auto head = mHead.load(std::memory_order_acquire);
+		for (;;)
+		{
+			const auto link = static_cast<std::uint32_t>(head);
+			if (link == 0) return false;
+
+			const auto next = mNext[link - 1].load(std::memory_order_relaxed);
+			if (mHead.compare_exchange_weak(head, pack(getTag(head) + 1, next),
+					std::memory_order_acquire, std::memory_order_acquire))
+			{
+				index = link - 1;
+				return true;
+			}
+		}
+	}
+
+	//! \brief gives an index taken by pop back.
+	void push(std::uint32_t index)
+	{
+		auto head = mHead.load(std::memory_order_relaxed);
+		do
+		{
+			mNext[index].store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+		} while (!mHead.compare_exchange_weak(head, pack(getTag(head) + 1, index + 1),
+					std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	std::uint32_t getCapacity() const { return mCapacity; }
+
+private:
+	static std::uint64_t pack(std::uint32_t tag, std::uint32_t link) { return (static_cast<std::uint64_t>(tag) << 32) | link; }
+	static std::uint32_t getTag(std::uint64_t head) { return static_cast<std::uint32_t>(head >> 32); }
+
+	std::atomic<std::uint64_t>							mHead; //!< tag << 32 | (top index + 1)
+	std::unique_ptr<std::atomic<std::uint32_t>[]>		mNext; //!< per index, the next free index + 1
+	std::uint32_t										mCapacity;
+};
+
+}} // !namespace cistft::work
+
+#endif // !CISTFT_INCLUDE_INDEX_FREE_LIST_H_
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef CISTFT_INCLUDE_METRICS_PANEL_H_
+#define CISTFT_INCLUDE_METRICS_PANEL_H_
+
+#include "work_manager.h"
+#include "stft_client.h"
+#include "stft_renderer.h"
+
+#include <string>
+
+namespace cinder {
+namespace params {
+class InterfaceGl;
+}} //!ci::params
+
+namespace cistft {
+
+class AppGlobals;
+
+/*!
+ * \class MetricsPanel
+ * \namespace cistft
+ * \brief shows the work manager, STFT and renderer instrumentation in the GUI.
+ * \note distributions cover the last refresh interval, counters are totals.
+ * Durations are shown as p50 / p99 / max in milliseconds.
+ * \note CPU usage covers the whole process, 100% is one core fully busy.
+ * Power is not measured, an idle view shows up as low usage and frame rate.
+ */
+class MetricsPanel
+{
+public:
+	MetricsPanel(AppGlobals&);
+
+	void					setupPostLaunchGUI(cinder::params::InterfaceGl* const);
+	//! takes new snapshots a few times a second, a no-op in between
+	void					update();
+
+private:
+	AppGlobals&				mGlobals;
+	double					mLastRefresh;
+
+	work::Manager::Metrics	mWorkMetrics;
+	stft::Client::Metrics	mStftMetrics;
+	work::HistogramSnapshot	mLastWaitTime;
+	work::HistogramSnapshot	mLastServiceTime;
+	work::HistogramSnapshot	mLastTransformTime;
+	work::HistogramSnapshot	mLastColorizeTime;
+	StftRenderer::Metrics	mRenderMetrics;
+	StftRenderer::Metrics	mLastRenderMetrics;
+	std::uint64_t			mLastCpuTime;
+	std::uint64_t			mLastCpuTimestamp;
+
+private: // shown in the GUI, read only
+	std::string				mQueueText;
+	std::string				mBusyText;
+	std::string				mWaitText;
+	std::string				mServiceText;
+	std::string				mTransformText;
+	std::string				mColorizeText;
+	std::string				mHopsText;
+	std::string				mFrameText;
+	std::string				mUploadText;
+	std::string				mCpuText;
+};
+
+} // !namespace cistft
+
+#endif // !CISTFT_INCLUDE_METRICS_PANEL_H_
\ No newline at end of file
@@ -1,18 +1,40 @@
 #ifndef CISTFT_INCLUDE_MONITOR_RENDERER_H_
 #define CISTFT_INCLUDE_MONITOR_RENDERER_H_
 
+#include <cstddef>
+#include <vector>
+
+#include <cinder/gl/Vbo.h>
+
 namespace cistft {
 
 class AppGlobals;
 
+/*!
+ * \class MonitorRenderer
+ * \namespace cistft
+ * \brief draws the pre-launch waveform, one band per channel.
+ * \note every pixel column is a vertical line from the minimum to the
+ * maximum of the samples under it, streamed into one vertex buffer and
+ * drawn in a single call. The cost follows the window width, not the
+ * monitor duration. \see audio::WaveformNode
+ */
 class MonitorRenderer
 {
 public:
 	MonitorRenderer(AppGlobals&);
-	void			draw();
+	void				draw();
+
+private:
+	//! writes two vertices per column and channel, answers the vertex count
+	std::size_t			fillVertices(float* vertices, std::size_t columns, std::size_t channels) const;
 
 private:
-	AppGlobals&		mGlobals;
+	AppGlobals&			mGlobals;
+	ci::gl::Vbo			mVertexBuffer;
+	bool				mHasVertexBuffer;
+	std::vector<float>	mMins;
+	std::vector<float>	mMaxs;
 };
 
 } // !namespace cistft
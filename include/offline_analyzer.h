@@ -0,0 +1,88 @@
+#ifndef CISTFT_INCLUDE_OFFLINE_ANALYZER_H_
+#define CISTFT_INCLUDE_OFFLINE_ANALYZER_H_
+
+#include "work_client.h"
+#include "stft_client.h"
+#include "wav_file.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace cistft {
+class AppConfig;
+namespace stft {
+struct ClientStorage;
+
+/*!
+ * \class OfflineAnalyzer
+ * \namespace cistft::stft
+ * \brief runs a whole recording through the same windowing, transform and
+ * band pass as the live STFT client, as fast as the worker pool allows.
+ * \note hops are posted in batches. Every batch forgets the smoothing history
+ * and warms up on a few hops before its first one, so the output does not
+ * depend on how batches were spread across workers.
+ * \note samples are windowed straight out of the input view, a mapped
+ * file is never loaded up front. Memory use does not grow with the recording.
+ * \note Cinder-free, used by the headless command line tool.
+ */
+class OfflineAnalyzer
+{
+public:
+	//! \note the samples behind input must outlive the analyzer, e.g. WavFile::getView
+	OfflineAnalyzer(work::Manager&, const AppConfig&, const audio::SampleView& input, dsp::WindowType = dsp::WindowType::Blackman);
+	~OfflineAnalyzer();
+
+	//! answers the number of hops whose window fits in the recording
+	std::size_t		getNumHops() const { return mNumHops; }
+	//! answers the number of visible bins, one value per bin per hop
+	std::size_t		getNumBins() const;
+	std::size_t		getHopSize() const { return mHopSize; }
+
+	/*!
+	 * \brief starts analyzing num_hops hops from first_hop on and returns immediately.
+	 * \param magnitudes num_hops * getNumBins() values, in dB if the active palette is. may be null
+	 * \param colors num_hops * getNumBins() packed RGBA8 pixels of the active palette, may be null
+	 * \note buffers must stay untouched until wait() returns.
+	 */
+	void			post(std::size_t first_hop, std::size_t num_hops, float* magnitudes, std::uint32_t* colors);
+	//! \brief blocks until every posted hop is done.
+	void			wait();
+
+private:
+	class Worker;
+	friend class Worker;
+
+	//! answers the calling thread's storage, built on first use
+	ClientStorage&	getStorage();
+	//! transforms a batch, called from the pool
+	void			process(std::size_t first_hop, std::size_t num_hops, float* magnitudes, std::uint32_t* colors);
+
+private:
+	audio::SampleView
+					mInput;
+	const AppConfig&
+					mConfig;
+	std::uint64_t	mId;			// tells thread storages of analyzers apart
+	Client::Format	mFormat;
+	std::size_t		mHopSize;
+	std::size_t		mNumHops;
+	work::ClientRef	mClient;
+
+	std::mutex		mStorageLock;
+	std::vector<std::unique_ptr<ClientStorage>>
+					mStorage;
+
+	std::atomic<std::size_t>
+					mPendingBatches;
+	std::mutex		mDoneLock;
+	std::condition_variable
+					mDone;
+};
+
+}} // !namespace cistft::stft
+
+#endif // !CISTFT_INCLUDE_OFFLINE_ANALYZER_H_
\ No newline at end of file
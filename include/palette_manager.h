@@ -2,10 +2,14 @@
 #define CISTFT_INCLUDE_PALETTE_MANAGER_H_
 
 #include "color_pallete.h"
+#include "palette_table.h"
 
-#include <functional>
 #include <atomic>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 namespace cinder {
 namespace params {
@@ -15,10 +19,37 @@ class InterfaceGl;
 namespace cistft {
 namespace palette {
 
+//! a reader's announcement of the epoch it is reading in, one per thread
+struct ReaderSlot;
+
 class Manager
 {
+public:
+	/*!
+	 * \class TableGuard
+	 * \brief pins the color table built from the current settings for as long as it lives. Lock-free.
+	 * \note the table stays valid while the guard lives even if the GUI swaps in a new one.
+	 * Keep guards short, replaced tables are freed once no guard from before the swap is left.
+	 */
+	class TableGuard
+	{
+	public:
+		TableGuard();
+		~TableGuard();
+
+		const ColorTable&	operator*() const { return *mTable; }
+		const ColorTable*	operator->() const { return mTable; }
+
+	private:
+		TableGuard(const TableGuard&); // = delete
+		TableGuard& operator=(const TableGuard&); // = delete
+
+		const ColorTable*	mTable;
+	};
+
 public:
 	static Manager&		instance();
+	~Manager();
 
 	void				setActivePalette(int palette_index);
 	int					getActivePalette() const { return mActivePalette; }
@@ -38,10 +69,10 @@ public:
 	void				setConvertToDb(bool convert);
 	bool				getConvertToDb() const { return mConvertToDb; }
 
-	const ci::Color&	getActivePaletteColor(float FFT_value);
-
+#if !defined(CISTFT_HEADLESS)
 	void				setupPreLaunchGUI(cinder::params::InterfaceGl* const);
 	void				setupPostLaunchGUI(cinder::params::InterfaceGl* const);
+#endif
 
 private:
 	Manager();
@@ -53,9 +84,30 @@ private:
 	std::atomic<bool>	mConvertToDb;
 
 private:
-	std::mutex			mColorProviderLock;
-	std::function < const ci::Color&(float, float, float) >
-						mColorProvider;
+	//! builds a table from the current settings, swaps it in and retires the old one
+	void				publishTable();
+	//! frees the retired tables no pinned reader can still see. Under mPublishLock.
+	void				reclaimTables();
+
+	//! announces the calling thread reads in the current epoch, answers the active table
+	const ColorTable*	pin();
+	void				unpin();
+	ReaderSlot&			getReaderSlot();
+
+	std::mutex			mPublishLock;
+	std::atomic<const ColorTable*>
+						mActiveTable;
+	std::unique_ptr<const ColorTable>
+						mOwnedTable;
+	//! bumped by every publish, 0 is never used so a zero slot means "not reading"
+	std::atomic<std::uint64_t>
+						mEpoch;
+	//! every slot ever handed out, a push-only list. slots of exited threads are reused.
+	std::atomic<ReaderSlot*>
+						mReaders;
+	//! replaced tables and the epoch they were replaced in
+	std::vector<std::pair<std::uint64_t, std::unique_ptr<const ColorTable>>>
+						mRetiredTables;
 };
 
 }} // !namespace cistft::palette
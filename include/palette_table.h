@@ -0,0 +1,74 @@
+#ifndef CISTFT_INCLUDE_PALETTE_TABLE_H_
+#define CISTFT_INCLUDE_PALETTE_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cistft {
+namespace palette {
+
+/*!
+ * \class ColorTable
+ * \namespace cistft::palette
+ * \brief an immutable, precomputed color lookup table. Thresholds, the linear
+ * coefficient and the dB divisor are folded into a scale and an offset so a
+ * spectrum row is colorized with one multiply-add and one load per bin.
+ * \note colors are packed RGBA8, R in the lowest byte. On little endian
+ * machines that is R, G, B, A in memory.
+ * \note does not depend on Cinder, so it can be used headless.
+ */
+class ColorTable
+{
+public:
+	//! number of entries in every table
+	static const std::size_t SIZE = 4096;
+
+	/*!
+	 * \struct Mapping
+	 * \brief how spectrum values map to the [0, 1] range of a palette.
+	 * Same semantics as the palette settings of palette::Manager.
+	 */
+	struct Mapping
+	{
+		Mapping()
+			: mConvertToDb(false)
+			, mLinearCoefficient(1024.0f)
+			, mDbDivisor(100.0f)
+			, mMinThreshold(0.0f)
+			, mMaxThreshold(1.0f)
+		{}
+
+		bool	mConvertToDb;
+		float	mLinearCoefficient;
+		float	mDbDivisor;
+		float	mMinThreshold;
+		float	mMaxThreshold;
+	};
+
+	//! builds the table from a palette of packed RGBA8 colors.
+	ColorTable(const std::uint32_t* palette, std::size_t palette_size, const Mapping& mapping);
+
+	//! colorizes size values of a spectrum row into packed RGBA8 pixels.
+	void				colorize(const float* spectrum, std::uint32_t* out, std::size_t size) const;
+	//! answers the packed color of a single spectrum value.
+	std::uint32_t		lookup(float value) const;
+	//! answers true if this table expects decibels (see dsp::powerSmoothDecibel).
+	bool				isDecibel() const { return mMapping.mConvertToDb; }
+	//! answers the mapping this table was built with.
+	const Mapping&		getMapping() const { return mMapping; }
+
+	//! packs a [0, 1] RGB color into RGBA8 with full alpha.
+	static std::uint32_t
+						packColor(float r, float g, float b);
+
+private:
+	Mapping						mMapping;
+	float						mScale;
+	float						mOffset;
+	std::vector<std::uint32_t>	mTable;
+};
+
+}} // !namespace cistft::palette
+
+#endif // !CISTFT_INCLUDE_PALETTE_TABLE_H_
\ No newline at end of file
@@ -0,0 +1,51 @@
+#ifndef CISTFT_INCLUDE_POLYPHASE_DECIMATOR_H_
+#define CISTFT_INCLUDE_POLYPHASE_DECIMATOR_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace cistft {
+namespace dsp {
+
+/*!
+ * \class PolyphaseDecimator
+ * \namespace cistft::dsp
+ * \brief an anti-aliased, integer factor decimator for one analysis window.
+ * A linear phase, Blackman windowed sinc low pass only evaluated at every
+ * factor-th sample, so the filter costs taps / factor per input sample.
+ * \note stateless, every window is filtered on its own. Input has to be
+ * padded with getPadding() samples on both sides (zeros at the window edges,
+ * the analysis window tapers them anyway).
+ * \note everything below PASSBAND times the output Nyquist frequency passes
+ * flat, anything that would alias into it is attenuated by about 74 dB.
+ */
+class PolyphaseDecimator
+{
+public:
+	//! fraction of the decimated Nyquist frequency that is usable
+	static const float		PASSBAND;
+
+	PolyphaseDecimator(std::size_t factor);
+
+	/*!
+	 * \brief filters and decimates, out[k] = window[k] * (h * in)[k * factor].
+	 * \param padded_input getPadding() + num_outputs * factor + getPadding() samples
+	 * \param window num_outputs window coefficients, applied on the way out
+	 */
+	void					process(const float* padded_input, float* out, std::size_t num_outputs, const float* window) const;
+
+	std::size_t				getFactor() const { return mFactor; }
+	//! answers the number of samples needed on each side of the window
+	std::size_t				getPadding() const { return mCoefficients.size() / 2; }
+
+	//! \brief answers the largest factor that keeps frequencies up to max_frequency unharmed. [1, max_factor]
+	static std::size_t		calculateFactor(float sample_rate, float max_frequency, std::size_t max_factor);
+
+private:
+	std::size_t				mFactor;
+	std::vector<float>		mCoefficients;	// odd length, symmetric, unity DC gain
+};
+
+}} // !namespace cistft::dsp
+
+#endif // !CISTFT_INCLUDE_POLYPHASE_DECIMATOR_H_
\ No newline at end of file
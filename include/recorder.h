@@ -0,0 +1,82 @@
+#ifndef CISTFT_INCLUDE_RECORDER_H_
+#define CISTFT_INCLUDE_RECORDER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "ring_buffer.h"
+
+namespace cistft {
+class AppConfig;
+namespace audio {
+
+//! a ring held by a reader, it outlives the recorder dropping it
+typedef std::shared_ptr<const RingBuffer> RingBufferRef;
+
+/*!
+ * \class Recorder
+ * \namespace cistft::audio
+ * \brief records audio into a lock-free ring buffer (RingBuffer) and keeps
+ * track of where the main thread last left off asking for hops.
+ *
+ * \note All positions are 64-bit sample indices counted from the moment
+ * the recorder got initialized. They never wrap, so windows straddle the end
+ * of the ring like any other window and no hop is lost or repeated.
+ * The ring only holds window + hop + the worst case worker lag worth
+ * of samples.
+ *
+ * \note workers hold a RingBufferRef from acquire to release. uninitialize
+ * only drops the recorder's reference, the ring goes away with the last reader.
+ *
+ * \note Cinder-free. RecorderNode runs it in the audio graph, the soak and
+ * allocation tests drive it directly.
+ */
+class Recorder
+{
+public:
+	//! Constructs a Recorder sized by the window, hop and worker lag of config.
+	explicit Recorder(const AppConfig& config);
+
+	//! allocates the ring and restarts the timeline at 0. Not while write runs.
+	void							initialize(std::size_t num_channels);
+	//! lets go of the ring, readers still holding it finish first. Not while write runs.
+	void							uninitialize();
+	//! records frames frames of planar samples, channel_stride apart. Audio thread only.
+	void							write(const float* data, std::size_t frames, std::size_t channel_stride);
+
+	//! answers the current window size set for returned sample via pop operation
+	std::size_t						getWindowSize() const;
+	//! answers the current hop size set for returned sample via pop operation
+	std::size_t						getHopSize() const;
+	//! answers the number of frames the ring is asked to hold, before rounding
+	std::size_t						getRingCapacity() const;
+	//! answers the number of samples recorded so far. Thread safe.
+	std::uint64_t					getWritePosition() const;
+	//! pops up to max_pops window size chunks and moves the internal pointer, hop size forward for each.
+	//! query_pos is the first one. answers how many. Not thread safe.
+	std::size_t						popBufferWindows(std::uint64_t& query_pos, std::size_t max_pops);
+	//! moves the internal pointer past pending windows without popping them. Not thread safe.
+	void							skipBufferWindows(std::size_t count);
+	//! answers how many pop operations are ready to be performed right now.
+	std::size_t						getNumPendingPops() const;
+	//! answers how many windows have been fully recorded so far, popped or not. Thread safe.
+	std::uint64_t					getNumRecordedPops() const;
+	//! answers index of operation by write position
+	std::uint64_t					getQueryIndexByQueryPos(std::uint64_t pos) const;
+	//! answers the ring buffer, null before initialize and after uninitialize. Thread safe.
+	//! \note keep it until every window acquired from it is released, see RingBuffer::acquire
+	RingBufferRef					getRingBuffer() const;
+
+private:
+	std::size_t						mWindowSize;
+	std::size_t						mHopSize;
+	std::size_t						mRingCapacity;
+
+	std::uint64_t					mLastQueried;
+	std::shared_ptr<RingBuffer>		mRingBuffer;	// swapped with std::atomic_store, readers std::atomic_load it
+};
+
+}} // !namespace cistft::audio
+
+#endif // !CISTFT_INCLUDE_RECORDER_H_
\ No newline at end of file
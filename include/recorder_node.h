@@ -1,7 +1,9 @@
 #ifndef CISTFT_INCLUDE_RECORDER_NODE_H_
 #define CISTFT_INCLUDE_RECORDER_NODE_H_
 
-#include <cinder/audio/SampleRecorderNode.h>
+#include <cinder/audio/Node.h>
+
+#include "recorder.h"
 
 namespace cistft {
 class AppGlobals;
@@ -10,53 +12,39 @@ namespace audio {
 /*!
  * \class RecorderNode
  * \namespace cistft::audio
- * \brief This class is a direct subclass of Cinder's BufferRecorder.
- * It keeps track of where the record position is, also it keeps the
+ * \brief runs a Recorder in the audio graph. The recorder keeps the
  * original window size and the original user specified hop size.
  * 
- * \note ONLY main thread uses this class to ask for samples to be
- * sent to worker FFT threads.
+ * \note ONLY main thread uses the recorder to ask for samples to be
+ * sent to worker FFT threads. Workers read their windows in place.
  *
- * \note Two main tasks are performed within this class:
+ * \note Two main tasks are performed by the recorder:
  * 1 - Audio recording and keeping track of recorder position
  * 2 - Keeping track of Where main thread last left off asking for samples
+ * \see Recorder
  */
-class RecorderNode : public ci::audio::BufferRecorderNode
+class RecorderNode : public ci::audio::NodeAutoPullable
 {
 public:
-	//! Constructs a RecorderNode and initializes its buffer to be large enough to hold \a numFrames frames.
+	//! Constructs a RecorderNode, the ring is allocated when the node is initialized.
 	RecorderNode(AppGlobals&);
 
-	//! answers the raw internal recording buffer. Not thread safe.
-	ci::audio::BufferDynamic&		getBufferRaw();
-	//! answers the current window size set for returned sample via pop operation
-	size_t							getWindowSize() const;
-	//! answers the current hop size set for returned sample via pop operation
-	size_t							getHopSize() const;
-	//! copies a chunk of the recording buffer inside another buffer. Not thread safe.
-	void							getBufferChunk(size_t start, size_t len, ci::audio::Buffer& other);
-	//! copies a chunk (window size) of the recording buffer inside another buffer. Not thread safe.
-	void							getBufferChunk(size_t start, ci::audio::Buffer& other);
-	//! pops a window size chunk and moves the internal pointer, hop size to the forward. Not thread safe.
-	void							queryBufferWindow(ci::audio::Buffer& other, size_t query_pos);
-	bool							popBufferWindow(size_t& query_pos);
-	//! answers if there's more pop operations left to do.
-	bool							isRecording() const;
-	//! resets the internal state
-	void							reset();
-	//! answers maximum possible number of processing operations
-	size_t							getMaxPossiblePops() const;
-	//! answers index of operation by write position
-	size_t							getQueryIndexByQueryPos(size_t pos);
+	//! answers the recorder, its ring is not available before the node is initialized.
+	Recorder&						getRecorder();
+	const Recorder&					getRecorder() const;
+	//! starts recording
+	void							start();
+
+protected:
+	void							initialize() override;
+	void							uninitialize() override;
+	void							process(ci::audio::Buffer* buffer) override;
 
 protected:
-	size_t	mWindowSize;
-	size_t	mHopSize;
-	size_t	mLastQueried;
-	size_t	mMaxPopsPossible;
+	Recorder						mRecorder;
 
 private:
-	using inherited = ci::audio::BufferRecorderNode;
+	using inherited = ci::audio::NodeAutoPullable;
 };
 
 }} // !namespace cistft
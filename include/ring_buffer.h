@@ -0,0 +1,93 @@
+#ifndef CISTFT_INCLUDE_RING_BUFFER_H_
+#define CISTFT_INCLUDE_RING_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cistft {
+namespace audio {
+
+/*!
+ * \class RingBuffer
+ * \namespace cistft::audio
+ * \brief lock-free, single producer, multi channel sample ring.
+ * The audio thread is the only writer. Any number of threads can read
+ * windows out of it, in place, without copying.
+ *
+ * \note positions are absolute 64 bit frame indices since construction.
+ * a window is readable as long as the producer did not lap it.
+ * \note the producer never waits. Readers acquire a window, read it and
+ * release it, release answers false if the producer overwrote the window
+ * in the meantime (the reader fell more than a capacity behind).
+ */
+class RingBuffer
+{
+public:
+	/*!
+	 * \class Window
+	 * \brief a read-only view of a range of frames. Because of wrap around
+	 * a window is made out of two spans, the second one may be empty.
+	 */
+	class Window
+	{
+	public:
+		Window() : mRing(nullptr), mPosition(0), mOffset(0), mFirstSize(0), mSecondSize(0) {}
+
+		const float*		getFirst(std::size_t channel) const;
+		const float*		getSecond(std::size_t channel) const;
+		std::size_t			getFirstSize() const { return mFirstSize; }
+		std::size_t			getSecondSize() const { return mSecondSize; }
+		std::size_t			getSize() const { return mFirstSize + mSecondSize; }
+		std::uint64_t		getPosition() const { return mPosition; }
+
+	private:
+		friend class RingBuffer;
+		const RingBuffer*	mRing;
+		std::uint64_t		mPosition;
+		std::size_t			mOffset;
+		std::size_t			mFirstSize;
+		std::size_t			mSecondSize;
+	};
+
+public:
+	//! \brief capacity is rounded up to the next power of two.
+	RingBuffer(std::size_t min_capacity, std::size_t num_channels);
+
+	//! \brief producer only. data holds num_channels blocks of frames samples, channel_stride apart.
+	void					write(const float* data, std::size_t frames, std::size_t channel_stride);
+	//! \brief answers the absolute position of the next frame to be written.
+	std::uint64_t			getWritePosition() const;
+
+	//! \brief acquires a view of len frames starting at pos. Clipped to what is written.
+	//! answers false if the window is not (or no longer) in the ring.
+	bool					acquire(std::uint64_t pos, std::size_t len, Window& window) const;
+	//! \brief answers true if the window was not overwritten while it was read.
+	bool					release(const Window& window) const;
+
+	std::size_t				getCapacity() const { return mCapacity; }
+	std::size_t				getNumChannels() const { return mNumChannels; }
+	//! \brief number of times a reader found its window overwritten.
+	std::uint64_t			getNumOverruns() const { return mOverruns; }
+
+private:
+	const float*			getChannel(std::size_t channel) const { return mData.data() + channel * mCapacity; }
+	bool					isIntact(std::uint64_t pos, std::uint64_t written) const;
+
+private:
+	std::size_t				mCapacity;
+	std::size_t				mMask;
+	std::size_t				mNumChannels;
+	std::vector<float>		mData;
+	std::atomic<std::uint64_t>
+							mWritePosition;
+	std::atomic<std::size_t>
+							mLargestWrite;
+	mutable std::atomic<std::uint64_t>
+							mOverruns;
+};
+
+}} // !namespace cistft::audio
+
+#endif // !CISTFT_INCLUDE_RING_BUFFER_H_
\ No newline at end of file
@@ -0,0 +1,119 @@
+#ifndef CISTFT_INCLUDE_SIGNAL_GENERATOR_H_
+#define CISTFT_INCLUDE_SIGNAL_GENERATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cistft {
+namespace audio {
+
+//! \brief signals the generator knows about.
+enum class SignalType
+{
+	WhiteNoise = 0,
+	PinkNoise,
+	LinearChirp,	// sweeps low to high frequency linearly, once per period
+	LogChirp,		// sweeps low to high frequency exponentially, once per period
+	ToneComb,		// evenly spaced sines from low to high frequency
+	ImpulseTrain,	// one full scale sample every period
+	Count
+};
+
+/*!
+ * \class SignalGenerator
+ * \namespace cistft::audio
+ * \brief produces reproducible test signals. The same format and seed always
+ * produce the same samples, no matter how the output is split into blocks.
+ * \note noise is independent per channel, every other signal is the same on all channels.
+ * \note does not depend on Cinder. GeneratorNode runs it in the audio graph,
+ * the headless analyzer renders it ahead of time.
+ */
+class SignalGenerator
+{
+public:
+	class Format
+	{
+	public:
+		Format();
+
+		Format&			signal(SignalType type);
+		Format&			channels(std::size_t size);
+		Format&			sampleRate(int rate);
+		Format&			seed(std::uint64_t seed);
+		Format&			amplitude(float val);
+		Format&			lowFrequency(float val);
+		Format&			highFrequency(float val);
+		Format&			period(float seconds);
+		Format&			numTones(std::size_t count);
+
+		SignalType		getSignal() const { return mSignal; }
+		std::size_t		getChannelSize() const { return mChannels; }
+		int				getSampleRate() const { return mSampleRate; }
+		std::uint64_t	getSeed() const { return mSeed; }
+		float			getAmplitude() const { return mAmplitude; }
+		float			getLowFrequency() const { return mLowFrequency; }
+		float			getHighFrequency() const { return mHighFrequency; }
+		float			getPeriod() const { return mPeriod; }
+		std::size_t		getNumTones() const { return mNumTones; }
+
+	private:
+		SignalType		mSignal;
+		std::size_t		mChannels;
+		int				mSampleRate;
+		std::uint64_t	mSeed;
+		float			mAmplitude;
+		float			mLowFrequency;
+		float			mHighFrequency;
+		float			mPeriod;
+		std::size_t		mNumTones;
+	};
+
+public:
+	explicit SignalGenerator(const Format& fmt = Format());
+
+	/*!
+	 * \brief writes the next num_frames frames and advances.
+	 * \param channel_stride distance between channels of a frame, num_frames for planar output
+	 * \param frame_stride distance between frames of a channel, 1 for planar output
+	 */
+	void				generate(float* out, std::size_t num_frames, std::size_t channel_stride, std::size_t frame_stride);
+	//! \brief convenience for interleaved output, channels * num_frames samples.
+	void				generateInterleaved(float* out, std::size_t num_frames);
+	//! \brief starts over from the first sample.
+	void				reset();
+
+	const Format&		getFormat() const { return mFormat; }
+	//! \brief answers the number of frames generated since the last reset.
+	std::uint64_t		getPosition() const { return mPosition; }
+
+	//! \brief answers the configuration name of a signal. e.g. "pink"
+	static const char*	getSignalName(SignalType type);
+	//! \brief parses a configuration name. answers false if name is unknown.
+	static bool			parseSignalName(const std::string& name, SignalType& type);
+
+private:
+	//! one stream per channel, seeded from the format seed and the channel index
+	struct Noise
+	{
+		std::uint64_t	mState;
+		float			mPink[7];	// Paul Kellet's pink filter
+	};
+
+	float				nextWhite(Noise&);
+	float				nextPink(Noise&);
+	//! answers the next deterministic sample, the one shared by all channels
+	float				nextTone();
+
+private:
+	Format				mFormat;
+	std::uint64_t		mPosition;
+	std::vector<Noise>	mNoise;
+	std::vector<double>	mPhases;		// cycles, [0, 1)
+	std::uint64_t		mPeriodFrames;
+};
+
+}} // !namespace cistft::audio
+
+#endif // !CISTFT_INCLUDE_SIGNAL_GENERATOR_H_
\ No newline at end of file
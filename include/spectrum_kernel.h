@@ -0,0 +1,80 @@
+#ifndef CISTFT_INCLUDE_SPECTRUM_KERNEL_H_
+#define CISTFT_INCLUDE_SPECTRUM_KERNEL_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cistft {
+namespace dsp {
+
+/*!
+ * \brief computes the smoothed, normalized magnitude spectrum in one pass.
+ * out[i] = out[i] * smoothing + sqrt(re[i]^2 + im[i]^2) * scale * (1 - smoothing)
+ * \note dispatches to AVX2, SSE2 or a scalar loop depending on the running CPU.
+ */
+void			magnitudeSmooth(const float* real,
+								const float* imag,
+								float* out,
+								std::size_t size,
+								float scale,
+								float smoothing);
+
+/*!
+ * \brief log-domain variant of magnitudeSmooth. Smoothing is done on the
+ * squared magnitude (no sqrt) and the result is written in decibels
+ * (same mapping as ci::audio::linearToDecibel) so colorizing needs no log.
+ * \param power smoothing state, holds the normalized squared magnitudes
+ * \param decibel output, 0 for anything below -100 dBFS
+ */
+void			powerSmoothDecibel(	const float* real,
+									const float* imag,
+									float* power,
+									float* decibel,
+									std::size_t size,
+									float scale,
+									float smoothing);
+
+/*!
+ * \brief maps every value to a table entry in one pass.
+ * out[i] = table[clamp(in[i] * scale + offset, 0, table_size - 1)]
+ * \note NaN inputs map to the first entry.
+ */
+void			lookupTable(const float* in,
+							std::uint32_t* out,
+							std::size_t size,
+							float scale,
+							float offset,
+							const std::uint32_t* table,
+							std::size_t table_size);
+
+/*!
+ * \brief averages channels and applies a window in one pass.
+ * out[i] = (channels[0][i] + ... + channels[num_channels - 1][i]) * scale * window[i]
+ * \param window size coefficients, or null for no window
+ * \note reads every channel and writes out exactly once, out may not alias a channel.
+ */
+void			downmixWindow(	const float* const* channels,
+								std::size_t num_channels,
+								std::size_t size,
+								const float* window,
+								float scale,
+								float* out);
+
+/*!
+ * \brief reduces a signal to one min/max pair per column, for drawing.
+ * column c covers samples [c * size / columns, (c + 1) * size / columns),
+ * a column narrower than one sample takes the sample it falls on.
+ * \param mins, maxs columns values each
+ */
+void			minMaxColumns(	const float* in,
+								std::size_t size,
+								std::size_t columns,
+								float* mins,
+								float* maxs);
+
+//! \brief answers the name of the instruction set the kernels dispatched to.
+const char*		getKernelIsaName();
+
+}} // !namespace cistft::dsp
+
+#endif // !CISTFT_INCLUDE_SPECTRUM_KERNEL_H_
\ No newline at end of file
@@ -2,12 +2,24 @@
 #define CISTFT_INCLUDE_STFT_CLIENT_H_
 
 #include "work_client.h"
+#include "work_pool.h"
+#include "stft_request.h"
+#include "work_metrics.h"
+#include "window_function.h"
 
-#include <cinder/audio/dsp/Dsp.h>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <vector>
 
 namespace cistft {
-class AppGlobals;
+class AppConfig;
+namespace audio {
+class Recorder;
+class RingBuffer;
+} //!cistft::audio
 namespace stft {
+struct ClientStorage;
 
 /*!
  * \class Client
@@ -20,6 +32,8 @@ namespace stft {
  * from the main thread.
  * \note This is the meat of the processing. Everything happens
  * here, from windowing to the actual FFT.
+ * \note Cinder-free. Hops are read from an audio::Recorder and the
+ * colorized rows go to a RowSink, StftRenderer in the app.
  * \see ClientStorage
  */
 class Client : public work::Client
@@ -28,32 +42,108 @@ public:
 	class Format
 	{
 	public:
+		Format();
+
 		Format&			windowSize(std::size_t size);
 		Format&			fftSize(std::size_t size);
 		Format&			channels(std::size_t size);
-		Format&			windowType(ci::audio::dsp::WindowType type);
+		Format&			windowType(dsp::WindowType type);
+		//! every factor-th sample of the low passed window is transformed, 1 is off
+		Format&			decimation(std::size_t factor);
 
 		std::size_t		getWindowSize() const;
 		std::size_t		getFftSize() const;
 		std::size_t		getChannelSize() const;
-		ci::audio::dsp::WindowType
-						getWindowType() const;
+		dsp::WindowType	getWindowType() const;
+		std::size_t		getDecimation() const;
 
 	private:
 		std::size_t		mWindowSize;
 		std::size_t		mFftSize;
 		std::size_t		mChannels;
-		ci::audio::dsp::WindowType
-						mWindowType;
+		dsp::WindowType	mWindowType;
+		std::size_t		mDecimation;
+	};
+
+	/*!
+	 * \class RowSink
+	 * \brief takes the colorized rows of the transformed hops.
+	 * \note called from every worker at once, each with a different hop.
+	 */
+	class RowSink
+	{
+	public:
+		virtual ~RowSink() {}
+		//! commits the row of the pop_index-th hop on the recorder's timeline, colors are packed RGBA8
+		virtual void	commitRow(std::uint64_t pop_index, const std::vector<std::uint32_t>& colors) = 0;
+	};
+
+	/*!
+	 * \struct Metrics
+	 * \brief a snapshot of the client's instrumentation, durations are in nanoseconds.
+	 */
+	struct Metrics
+	{
+		Metrics() : mQueuedTransforms(0), mDroppedHops(0), mLateHops(0), mDecimatedHops(0) {}
+
+		work::HistogramSnapshot	mTransformTime;		// windowing, transform and magnitudes, per hop
+		work::HistogramSnapshot	mColorizeTime;		// palette lookup, per hop
+		std::size_t				mQueuedTransforms;
+		std::uint64_t			mDroppedHops;
+		std::uint64_t			mLateHops;
+		std::uint64_t			mDecimatedHops;
 	};
 
 public:
-	Client(work::Manager&, AppGlobals* = nullptr, Format fmt = Format());
+	//! \note config, recorder and sink must outlive the client
+	Client(work::Manager&, const AppConfig* = nullptr, const audio::Recorder* = nullptr, RowSink* = nullptr, Format fmt = Format());
 	void			handle(work::RequestRef) override;
+	//! answers a request out of this client's pool, allocation free once warmed up. Main thread only.
+	//! \see Request for stride and deadline
+	work::RequestRef
+					makeRequest(std::uint64_t query_pos,
+								std::size_t num_hops = 1,
+								std::size_t stride = 1,
+								std::uint64_t deadline = std::numeric_limits<std::uint64_t>::max());
+	//! answers the smoothed time, in seconds, a worker spends on one hop. 0 until measured.
+	float			getHopCost() const;
+	//! answers how many transforms are requested but not finished yet.
+	std::size_t		getNumQueuedTransforms() const;
+	//! records hops the scheduler skipped before requesting them.
+	void			dropHops(std::size_t count);
+	//! answers how many hops were never transformed because they were off screen already.
+	std::uint64_t	getNumDroppedHops() const;
+	//! answers how many hops were transformed too late, off screen at commit or their samples overwritten.
+	std::uint64_t	getNumLateHops() const;
+	//! answers how many hops repeated the row of a previous hop instead of being transformed.
+	std::uint64_t	getNumDecimatedHops() const;
+	//! fills a snapshot of the instrumentation. Thread safe.
+	void			snapshot(Metrics&) const;
+
+private:
+	//! windows, transforms and computes the magnitude spectrum of one hop, in dB if is_decibel.
+	//! answers false if the samples of the hop are no longer in the ring.
+	bool			processHop(ClientStorage&, const audio::RingBuffer&, std::uint64_t pos, bool is_decibel);
 
 private:
 	Format			mFormat;
-	AppGlobals*		mGlobals;
+	const AppConfig*
+					mConfig;
+	const audio::Recorder*
+					mRecorder;
+	RowSink*		mSink;
+	work::RequestPool<Request>
+					mRequestPool;
+	std::atomic<float>
+					mHopCost;
+	std::atomic<std::size_t>
+					mQueuedTransforms;
+	std::atomic<std::uint64_t>
+					mDroppedHops;
+	std::atomic<std::uint64_t>
+					mLateHops;
+	std::atomic<std::uint64_t>
+					mDecimatedHops;
 };
 
 }} // !namespace cistft::stft
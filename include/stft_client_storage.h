@@ -1,37 +1,88 @@
 #ifndef CISTFT_INCLUDE_STFT_CLIENT_STORAGE_H_
 #define CISTFT_INCLUDE_STFT_CLIENT_STORAGE_H_
 
-#include <cinder/audio/dsp/Dsp.h>
-#include <cinder/audio/dsp/Fft.h>
-#include <cinder/audio/Buffer.h>
+#include <cstdint>
+#include <vector>
 
 #include "stft_client.h"
+#include "goertzel_bank.h"
+#include "polyphase_decimator.h"
+#include "fft_backend.h"
+#include "window_function.h"
+#include "wav_file.h"
+#include "work_metrics.h"
 
 namespace cistft {
 
-class AppGlobals;
+class AppConfig;
 
 namespace stft {
 
+/*!
+ * \struct ClientStorage
+ * \namespace cistft::stft
+ * \brief everything one thread needs to transform hops: the transform
+ * engine, the window table and the spectrum buffers.
+ * \note Cinder-free, the headless analyzer uses it as is.
+ */
 struct ClientStorage
 {
-	ClientStorage(const Client::Format& fmt, AppGlobals* const globals);
-
-	std::unique_ptr<ci::audio::dsp::Fft>	mFft;
-	ci::audio::Buffer						mCopiedBuffer;		// not windowed samples before transform
-	ci::audio::Buffer						mFftBuffer;			// windowed samples before transform
-	ci::audio::BufferSpectral				mBufferSpectral;	// transformed samples
-	std::vector<float>						mMagSpectrum;		// computed magnitude spectrum from frequency-domain samples
-	ci::audio::AlignedArrayPtr				mWindowingTable;
+	ClientStorage(const Client::Format& fmt, const AppConfig& config);
+
+	fft::BackendRef							mFft;				// null if the Goertzel bank is used instead
+	std::unique_ptr<dsp::GoertzelBank>		mGoertzelBank;		// non-null if visible bins are cheaper to evaluate one by one
+	std::unique_ptr<dsp::PolyphaseDecimator>
+											mDecimator;			// non-null if the window is decimated before the transform
+	std::vector<float>						mDecimatorInput;	// downmixed window with the decimator padding on both sides
+	std::vector<float>						mBandReal;			// Goertzel output, visible bins only
+	std::vector<float>						mBandImag;			// Goertzel output, visible bins only
+	std::vector<float>						mBandInput;			// Goertzel input, windowed samples without padding
+	float*									mTransformInput;	// windowed samples before transform, owned by FFT or Goertzel
+	std::size_t								mTransformInputSize;
+	std::vector<float>						mMagSpectrum;		// computed magnitude spectrum of the visible bins (linear or dB)
+	std::vector<float>						mPowSpectrum;		// smoothed squared magnitudes, used in dB mode
+	std::vector<std::uint32_t>				mColorRow;			// colorized magnitude spectrum, packed RGBA8
+	std::vector<const float*>				mFirstSpans;		// per channel, first span of the hop being windowed
+	std::vector<const float*>				mSecondSpans;		// per channel, second span of the hop being windowed
+	std::vector<float>						mWindowingTable;	// one coefficient per analysis sample
 	std::size_t								mFftSize;
 	std::size_t								mChannelSize;
-	std::size_t								mWindowSize;
-	ci::audio::dsp::WindowType				mWindowType;
+	std::size_t								mWindowSize;		// recorded samples per hop
+	std::size_t								mAnalysisSize;		// samples per hop after decimation
+	std::size_t								mBinStart;			// first visible bin (high pass)
+	std::size_t								mBinCount;			// number of visible bins
+	dsp::WindowType							mWindowType;
 	float									mSmoothingFactor;
 	float									mChannelScale;		// one over channel size
 	float									mMagnitudeScale;	// one over FFT size
+	work::Histogram							mTransformTime;		// windowing, transform and magnitudes of a hop, nanoseconds
+	work::Histogram							mColorizeTime;		// palette lookup of a hop, nanoseconds
 };
 
+/*!
+ * \brief averages the channels of one hop and windows them into the transform input.
+ * \note every channel is given as two spans (mFirstSpans, mSecondSpans) because of the
+ * ring wrap around, first_size + second_size is the window size. The second may be empty.
+ */
+void		windowHop(ClientStorage& storage, std::size_t first_size, std::size_t second_size);
+
+/*!
+ * \brief same as windowHop, for interleaved samples in their stored encoding.
+ * Samples are converted to float, averaged and windowed in one pass, so a
+ * mapped file is never copied or converted as a whole.
+ * \param frames window size frames of mChannelSize channels each, e.g. WavFile::getFrames
+ */
+void		windowInterleavedHop(ClientStorage& storage, const unsigned char* frames, audio::SampleEncoding encoding);
+
+/*!
+ * \brief transforms the windowed hop and leaves the smoothed spectrum of the visible bins
+ * in mMagSpectrum, in dB if is_decibel.
+ */
+void		transformHop(ClientStorage& storage, bool is_decibel);
+
+//! \brief forgets the smoothing history, the next hop is not blended with anything.
+void		resetSmoothing(ClientStorage& storage);
+
 }} // !namespace cistft
 
 #endif // !CISTFT_INCLUDE_STFT_CLIENT_STORAGE_H_
\ No newline at end of file
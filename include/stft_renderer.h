@@ -2,53 +2,110 @@
 #define CISTFT_INCLUDE_STFT_RENDERER_H_
 
 #include <vector>
-#include <array>
-#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 
 #include "stft_surface.h"
+#include "stft_client.h"
+#include "index_free_list.h"
+#include "work_metrics.h"
 
 #include <cinder/gl/Texture.h>
-#include <cinder/gl/Fbo.h>
+#include <cinder/gl/Vbo.h>
 
 namespace cistft {
 class AppGlobals;
 
-class StftRenderer
+/*!
+ * \class StftRenderer
+ * \namespace cistft
+ * \brief draws the spectrogram history out of one ring texture.
+ * \note workers fill rows of CPU staging surfaces. Every frame the main
+ * thread streams the newly committed rows, in order, into the ring texture
+ * through a pixel unpack buffer. Scrolling is a texture coordinate offset.
+ * \note rows that scrolled off screen before being committed are skipped,
+ * the scheduler drops them under overload. \see getDeadlineByQueryPos
+ * \note only rows committed since the last frame are uploaded, contiguous
+ * ones in a single call. The steady state cost of a frame follows the hop
+ * rate, not the length of the visible history.
+ * \note staging surfaces are allocated once in setup and recycled through
+ * a lock-free free list, workers never allocate nor fault in fresh pages.
+ * \note the rows of stft::Client land here, \see commitRow
+ */
+class StftRenderer : public stft::Client::RowSink
 {
+public:
+	/*!
+	 * \struct Metrics
+	 * \brief a snapshot of the renderer's instrumentation, durations are in nanoseconds.
+	 */
+	struct Metrics
+	{
+		Metrics() : mNumFrames(0), mUploadedRows(0), mUploadCalls(0), mUploadedBytes(0) {}
+
+		work::HistogramSnapshot	mFrameTime;			// update and draw, per frame
+		std::uint64_t			mNumFrames;
+		std::uint64_t			mUploadedRows;
+		std::uint64_t			mUploadCalls;		// glTexSubImage2D calls
+		std::uint64_t			mUploadedBytes;
+	};
+
 public:
 	StftRenderer(AppGlobals&);
+	~StftRenderer();
 
 	void								update();
 	void								setup();
 	void								draw();
-	StftSurface&						getSurface(int index, int pop_pos);
+	StftSurface&						getSurface(int index);
+	//! fills the row of a hop in its staging surface. Called from workers.
+	void								commitRow(std::uint64_t pop_index, const std::vector<std::uint32_t>& colors) override;
 	std::size_t							getFramesPerSurface() const;
-	std::size_t							getSurfaceIndexByQueryPos(std::size_t pos) const;
-	std::size_t							getIndexInSurfaceByQueryPos(std::size_t pos) const;
+	std::size_t							getSurfaceIndexByQueryPos(std::uint64_t pos) const;
+	std::size_t							getIndexInSurfaceByQueryPos(std::uint64_t pos) const;
+	//! answers the recorder write position at which the row of a hop scrolls off screen
+	std::uint64_t						getDeadlineByQueryPos(std::uint64_t pos) const;
+	//! answers how many rows the last update uploaded, new rows mean the view changed
+	std::size_t							getNumUpdatedRows() const;
+	//! fills a snapshot of the instrumentation. Main thread only.
+	void								snapshot(Metrics&) const;
 
 private:
-	using container_pair				= std::pair<StftSurfaceRef, ci::gl::TextureRef>;
-	using container						= std::vector < container_pair >;
+	//! staging slot to pooled surface index + 1, 0 while the slot is empty
+	using container						= std::unique_ptr < std::atomic<std::uint32_t>[] >;
 
 private:
 	AppGlobals&							mGlobals;
-	container							mSurfaceTexturePool;
-	std::mutex							mPoolLock;
+	container							mSurfacePool;
+	std::vector<StftSurfaceRef>			mSurfaceStorage;
+	work::IndexFreeList					mFreeSurfaces;
 	std::size_t							mFramesPerSurface;
 	std::size_t							mViewableBins;
 	std::size_t							mNumSurfaces;
-	std::size_t							mTotalSurfacesLength;
-	std::size_t							mLastSurfaceLength;
-	std::atomic<int>					mLastPopPos;
-	std::array<ci::gl::Fbo, 2>			mFrameBuffers;
+	std::size_t							mHistoryLength;
+	std::uint64_t						mNextUploadIndex;
+	std::size_t							mNumUpdatedRows;
+	ci::gl::TextureRef					mRingTexture;
+	ci::gl::Vbo							mUploadBuffer;
+
+	work::Histogram						mFrameTime;
+	std::uint64_t						mUpdateTime; //!< spent in update this frame, added to draw
+	std::uint64_t						mNumFrames;
+	std::uint64_t						mUploadedRows;
+	std::uint64_t						mUploadCalls;
+	std::uint64_t						mUploadedBytes;
 
 private:
-	std::size_t							calculateLastSurfaceLength() const;
-	std::size_t							calculateTotalSurfacesLength() const;
-	std::size_t							getActiveFramebuffer() const;
-	float								calculateActiveFboOffset() const;
-	void								drawFramebuffers(float shift_right = 0.0f, float shift_up = 0.0f);
-	void								drawFramebuffer(ci::gl::Fbo& fbo, float shift_right = 0.0f, float shift_up = 0.0f);
+	std::size_t							calculateHistoryLength() const;
+	std::size_t							getSurfaceIndexByPopIndex(std::uint64_t pop_index) const;
+	std::uint64_t						getOldestVisiblePopIndex() const;
+	std::size_t							skipStaleRows();
+	void								clearRingTexture();
+	std::size_t							uploadCommittedRows();
+	StftSurface*						getSurfaceBySlot(std::size_t index) const;
+	void								releaseSurface(std::size_t index);
+	void								drawHistory();
 };
 
 } // !namespace cistft
@@ -3,17 +3,51 @@
 
 #include "work_request.h"
 
+#include <cstdint>
+#include <limits>
+
 namespace cistft {
 namespace stft {
 
+/*!
+ * \class Request
+ * \namespace cistft::stft
+ * \brief a range of consecutive hops to be transformed by the STFT Client.
+ * \note the first hop starts at the query position. the rest of them
+ * are one recorder hop size apart from each other. Positions are 64-bit
+ * sample indices on the recorder's timeline and never wrap.
+ * \note the deadline is the recorder write position at which the first
+ * hop scrolls off screen, every following hop is due one hop later.
+ * The default deadline never passes, not even for the later hops.
+ * With a stride above one only every stride-th hop is transformed and
+ * the hops in between repeat its row.
+ */
 class Request : public work::Request
 {
 public:
-	Request(std::size_t query_pos) : mQueryPos(query_pos) {}
-	std::size_t getQueryPos() const { return mQueryPos; }
+	Request(std::uint64_t query_pos,
+			std::size_t num_hops = 1,
+			std::size_t stride = 1,
+			std::uint64_t deadline = std::numeric_limits<std::uint64_t>::max())
+		: mQueryPos(query_pos), mNumHops(num_hops), mStride(stride > 0 ? stride : 1), mDeadline(deadline) {}
+	std::uint64_t getQueryPos() const { return mQueryPos; }
+	std::size_t getNumHops() const { return mNumHops; }
+	std::size_t getStride() const { return mStride; }
+	std::uint64_t getDeadline() const { return mDeadline; }
+	//! answers the deadline of the hop-th hop, saturated so no deadline stays no deadline
+	std::uint64_t getHopDeadline(std::size_t hop, std::size_t hop_size) const
+	{
+		const auto _offset = static_cast<std::uint64_t>(hop) * hop_size;
+		return mDeadline > std::numeric_limits<std::uint64_t>::max() - _offset ? std::numeric_limits<std::uint64_t>::max() : mDeadline + _offset;
+	}
+	//! answers the number of hops actually transformed
+	std::size_t getNumTransforms() const { return (mNumHops + mStride - 1) / mStride; }
 
 private:
-	std::size_t mQueryPos;
+	std::uint64_t mQueryPos;
+	std::size_t mNumHops;
+	std::size_t mStride;
+	std::uint64_t mDeadline;
 };
 
 }} // !namespace cistft::stft
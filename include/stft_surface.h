@@ -2,26 +2,43 @@
 #define CISTFT_INCLUDE_STFT_SURFACE_H_
 
 #include <atomic>
-#include <mutex>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 #include <cinder/Surface.h>
 
 namespace cistft {
 
-class StftSurface final : public ci::Surface32f
+/*!
+ * \class StftSurface
+ * \namespace cistft
+ * \brief a block of spectrogram rows, one row per hop and one pixel per bin.
+ * \note pixels are packed RGBA8 so a colorized row is copied in as is.
+ */
+class StftSurface final : public ci::Surface8u
 {
 public:
-	StftSurface(int width, int height, int fft_vector_index);
+	StftSurface(int width, int height);
 	StftSurface() = delete;
 
-	void				fillRow(int row, const std::vector<float>& data);
-	void				processRow(int row, const std::vector<float>&);
-	bool				allRowsTouched() const { return mTouchedRows == getHeight(); }
+	/*!
+	 * \brief copies a colorized row in and commits it for a hop. Lock-free,
+	 * every hop owns a distinct row so workers never write the same pixels.
+	 * \note colors are packed RGBA8, see palette::ColorTable
+	 */
+	void				fillRow(int row, std::uint64_t pop_index, const std::vector<std::uint32_t>& colors);
+	void				processRow(int row, const std::vector<std::uint32_t>& colors);
+	//! answers the first pixel of a row, rows are getRowBytes() apart
+	std::uint32_t*		getRowPointer(int row);
+	//! answers true once the row is committed for that hop. pixels of a committed row are visible to the caller.
+	bool				isRowCommitted(int row, std::uint64_t pop_index) const { return mCommittedRows[row].load(std::memory_order_acquire) == pop_index + 1; }
 
 private:
-	std::atomic<int>	mTouchedRows{ 0 };
-	std::mutex			mWriteLock;
-	int					mFftVectorStartIndex;
+	//! hop index + 1 of the last commit per row, 0 if never committed.
+	//! rows of dropped hops are skipped, a stale commit must not pass for a newer hop.
+	std::unique_ptr<std::atomic<std::uint64_t>[]>
+						mCommittedRows;
 };
 
 typedef std::unique_ptr<StftSurface> StftSurfaceRef;
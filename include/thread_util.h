@@ -0,0 +1,24 @@
+#ifndef CISTFT_INCLUDE_THREAD_UTIL_H_
+#define CISTFT_INCLUDE_THREAD_UTIL_H_
+
+#include <string>
+#include <vector>
+
+namespace cistft {
+namespace thread {
+
+//! \brief names the calling thread so it shows up in debuggers, perf and top. best effort.
+void				setCurrentThreadName(const std::string& name);
+//! \brief pins the calling thread to a set of CPUs. answers false if unsupported or rejected.
+bool				setCurrentThreadAffinity(const std::vector<int>& cpus);
+//! \brief answers the number of hardware threads, at least 1.
+int					getNumCpus();
+
+//! \brief parses a CPU list like "0-3,6,8-9". answers false on malformed input.
+bool				parseCpuList(const std::string& text, std::vector<int>& cpus);
+//! \brief formats a CPU list, the inverse of parseCpuList.
+std::string			formatCpuList(const std::vector<int>& cpus);
+
+}} // !namespace cistft::thread
+
+#endif // !CISTFT_INCLUDE_THREAD_UTIL_H_
\ No newline at end of file
@@ -0,0 +1,108 @@
+#ifndef CISTFT_INCLUDE_WAV_FILE_H_
+#define CISTFT_INCLUDE_WAV_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace cistft {
+namespace audio {
+
+//! \brief how one sample is stored in a WAV data chunk, little endian.
+enum class SampleEncoding
+{
+	Unsigned8,	// 8-bit PCM is unsigned, 128 is silence
+	Int16,
+	Int24,
+	Int32,
+	Float32,
+	Float64
+};
+
+//! \brief answers the size of one sample in bytes.
+std::size_t				getSampleBytes(SampleEncoding encoding);
+
+/*!
+ * \struct SampleView
+ * \namespace cistft::audio
+ * \brief interleaved samples in their stored encoding. Does not own them.
+ */
+struct SampleView
+{
+	SampleView(const void* frames = nullptr, std::size_t num_frames = 0, std::size_t num_channels = 0, SampleEncoding encoding = SampleEncoding::Float32)
+		: mFrames(static_cast<const unsigned char*>(frames)), mNumFrames(num_frames), mNumChannels(num_channels), mEncoding(encoding) {}
+
+	//! answers the frame-th frame, all channels
+	const unsigned char*	getFrames(std::size_t frame) const { return mFrames + frame * mNumChannels * getSampleBytes(mEncoding); }
+
+	const unsigned char*	mFrames;
+	std::size_t				mNumFrames;
+	std::size_t				mNumChannels;
+	SampleEncoding			mEncoding;
+};
+
+/*!
+ * \class WavFile
+ * \namespace cistft::audio
+ * \brief a RIFF WAVE file mapped into memory. Only the header is parsed on open,
+ * the samples are read straight out of the mapping, interleaved and in their
+ * stored encoding. Opening takes the same time for any file size.
+ * \note understands PCM 8/16/24/32-bit integer, IEEE float 32/64-bit
+ * and WAVE_FORMAT_EXTENSIBLE wrapping any of them.
+ * \note the mapping is advised for sequential reads, the kernel reads ahead.
+ * \note does not depend on Cinder, the headless analyzer uses it.
+ */
+class WavFile
+{
+public:
+	WavFile();
+	~WavFile();
+
+	//! \brief maps the file and parses its header. answers false and sets getError() on failure.
+	bool				open(const std::string& path);
+	//! \brief unmaps the file, views handed out are no longer valid.
+	void				close();
+
+	std::size_t			getNumChannels() const { return mNumChannels; }
+	std::size_t			getNumFrames() const { return mNumFrames; }
+	int					getSampleRate() const { return mSampleRate; }
+	SampleEncoding		getEncoding() const { return mEncoding; }
+	//! \brief answers the size of one interleaved frame, all channels, in bytes.
+	std::size_t			getFrameBytes() const { return mFrameBytes; }
+	float				getDuration() const;
+	const std::string&	getError() const { return mError; }
+
+	//! \brief answers a view into the mapped samples, starting at a frame. No copies.
+	const unsigned char*
+						getFrames(std::size_t first_frame) const { return mData + first_frame * mFrameBytes; }
+	//! \brief answers all samples of the file as a view. Valid until closed.
+	SampleView			getView() const { return SampleView(mData, mNumFrames, mNumChannels, mEncoding); }
+
+private:
+	WavFile(const WavFile&); // = delete
+	WavFile& operator=(const WavFile&); // = delete
+
+	bool				fail(const std::string& error);
+	bool				map(const std::string& path);
+	void				unmap();
+
+private:
+	const unsigned char*
+						mMapping;
+	std::size_t			mMappingSize;
+	void*				mFileHandle;	// Windows only, the file and its mapping object
+	void*				mMappingHandle;
+
+	const unsigned char*
+						mData;			// first frame, inside the mapping
+	std::size_t			mNumChannels;
+	std::size_t			mNumFrames;
+	std::size_t			mFrameBytes;
+	int					mSampleRate;
+	SampleEncoding		mEncoding;
+	std::string			mError;
+};
+
+}} // !namespace cistft::audio
+
+#endif // !CISTFT_INCLUDE_WAV_FILE_H_
\ No newline at end of file
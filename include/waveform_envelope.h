@@ -0,0 +1,85 @@
+#ifndef CISTFT_INCLUDE_WAVEFORM_ENVELOPE_H_
+#define CISTFT_INCLUDE_WAVEFORM_ENVELOPE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ring_buffer.h"
+
+namespace cistft {
+namespace audio {
+
+/*!
+ * \class WaveformEnvelope
+ * \namespace cistft::audio
+ * \brief keeps the envelope of the last window of audio for drawing.
+ * The audio thread reduces every bucket of samples to a min/max pair
+ * and records the pairs into a lock-free RingBuffer.
+ *
+ * \note a window never takes more than MAX_BUCKETS pairs, so reading it
+ * costs the same whether it holds a few milliseconds or a minute.
+ * \note ring channel 2 * c holds the minimums of input channel c and
+ * channel 2 * c + 1 its maximums.
+ * \note Cinder-free. WaveformNode runs it in the audio graph, the min_max
+ * test drives it directly.
+ */
+class WaveformEnvelope
+{
+public:
+	static const std::size_t		MAX_BUCKETS = 4096;
+
+	//! Constructs a WaveformEnvelope keeping window_size frames worth of envelope.
+	explicit WaveformEnvelope(std::size_t window_size);
+
+	//! allocates the ring and the audio thread scratch for writes of frames_per_block frames. Not while write runs.
+	void							initialize(std::size_t num_channels, std::size_t frames_per_block);
+	//! lets go of the ring. Not while write or getColumns run.
+	void							uninitialize();
+	//! reduces frames frames of planar samples, channel_stride apart. Audio thread only.
+	void							write(const float* data, std::size_t frames, std::size_t channel_stride);
+
+	/*!
+	 * \brief reduces the envelope of the last window to one min/max pair per column.
+	 * mins and maxs are resized to getNumChannels() blocks of columns values.
+	 * answers false if nothing was recorded yet. Main thread only.
+	 */
+	bool							getColumns(std::size_t columns, std::vector<float>& mins, std::vector<float>& maxs);
+
+	//! answers the number of frames the envelope covers
+	std::size_t						getWindowSize() const { return mWindowSize; }
+	//! answers the number of frames reduced to one min/max pair
+	std::size_t						getBucketSize() const { return mBucketSize; }
+	//! answers the number of min/max pairs a window holds
+	std::size_t						getNumBuckets() const { return mNumBuckets; }
+	//! answers the number of input channels, 0 before initialize
+	std::size_t						getNumChannels() const { return mNumChannels; }
+	//! answers the number of buckets recorded so far, the one being filled excluded
+	std::uint64_t					getNumRecordedBuckets() const;
+
+private:
+	//! records the bucket being filled once it is full
+	void							accumulate(const float* data, std::size_t channel_stride, std::size_t frame, std::size_t count);
+
+private:
+	std::size_t						mWindowSize;
+	std::size_t						mBucketSize;
+	std::size_t						mNumBuckets;
+	std::size_t						mNumChannels;
+	std::unique_ptr<RingBuffer>		mBuckets;
+
+	// audio thread
+	std::vector<float>				mPending;		// min/max pairs of the bucket being filled, ring channel order
+	std::size_t						mPendingFrames;
+	std::vector<float>				mBlock;			// whole buckets of one write, ring channel blocks
+	std::size_t						mBlockCapacity;
+
+	// main thread
+	std::vector<float>				mEnvelope;		// the window copied out of the ring, ring channel blocks
+	std::vector<float>				mDiscarded;
+};
+
+}} // !namespace cistft::audio
+
+#endif // !CISTFT_INCLUDE_WAVEFORM_ENVELOPE_H_
\ No newline at end of file
@@ -0,0 +1,49 @@
+#ifndef CISTFT_INCLUDE_WAVEFORM_NODE_H_
+#define CISTFT_INCLUDE_WAVEFORM_NODE_H_
+
+#include <cinder/audio/Node.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "waveform_envelope.h"
+
+namespace cistft {
+namespace audio {
+
+/*!
+ * \class WaveformNode
+ * \namespace cistft::audio
+ * \brief keeps the envelope of the last window of audio for drawing.
+ * \note runs a WaveformEnvelope in the audio graph, every process call
+ * writes the block into it.
+ */
+class WaveformNode : public ci::audio::NodeAutoPullable
+{
+public:
+	//! Constructs a WaveformNode keeping window_size frames worth of envelope.
+	WaveformNode(std::size_t window_size);
+
+	//! answers the number of frames the envelope covers
+	std::size_t						getWindowSize() const { return mEnvelope.getWindowSize(); }
+	//! answers the number of frames reduced to one min/max pair
+	std::size_t						getBucketSize() const { return mEnvelope.getBucketSize(); }
+
+	//! \see WaveformEnvelope::getColumns
+	bool							getColumns(std::size_t columns, std::vector<float>& mins, std::vector<float>& maxs);
+
+protected:
+	void							initialize() override;
+	void							uninitialize() override;
+	void							process(ci::audio::Buffer* buffer) override;
+
+private:
+	WaveformEnvelope				mEnvelope;
+
+private:
+	using inherited = ci::audio::NodeAutoPullable;
+};
+
+}} // !namespace cistft::audio
+
+#endif // !CISTFT_INCLUDE_WAVEFORM_NODE_H_
\ No newline at end of file
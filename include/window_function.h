@@ -0,0 +1,23 @@
+#ifndef CISTFT_INCLUDE_WINDOW_FUNCTION_H_
+#define CISTFT_INCLUDE_WINDOW_FUNCTION_H_
+
+#include <cstddef>
+
+namespace cistft {
+namespace dsp {
+
+//! \brief analysis windows, same shapes as ci::audio::dsp::WindowType
+enum class WindowType
+{
+	Blackman,
+	Hamming,
+	Hann,
+	Rect
+};
+
+//! \brief fills size samples of a window. Matches ci::audio::dsp::generateWindow.
+void			generateWindow(WindowType type, float* window, std::size_t size);
+
+}} // !namespace cistft::dsp
+
+#endif // !CISTFT_INCLUDE_WINDOW_FUNCTION_H_
\ No newline at end of file
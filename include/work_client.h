@@ -50,8 +50,8 @@ static ClientRef make_client(Manager& manager, Args... args)
 	return std::shared_ptr<T>(new T(manager, args...));
 }
 
-/* C++11's thread_local define */
-#ifndef thread_local
+/* C++11's thread_local define, VS2013 only knows __declspec(thread) */
+#if defined(_MSC_VER) && _MSC_VER < 1900 && !defined(thread_local)
 #define thread_local __declspec(thread)
 #endif // !thread_local
 
@@ -0,0 +1,114 @@
+#ifndef CISTFT_INCLUDE_WORK_DEQUE_H_
+#define CISTFT_INCLUDE_WORK_DEQUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace cistft {
+namespace work {
+
+/*!
+ * \class StealingDeque
+ * \namespace cistft::work
+ *
+ * \brief a bounded Chase-Lev work-stealing deque of T pointers.
+ * The owner thread pushes and pops at the bottom, any other thread
+ * steals from the top. Lock-free on both ends.
+ *
+ * \note ordering follows "Correct and Efficient Work-Stealing for Weak
+ * Memory Models" (Le, Pop, Cohen, Zappa Nardelli, PPoPP 2013).
+ * \note capacity is fixed, push answers false when full and the caller
+ * is expected to fall back to another queue.
+ */
+template<class T>
+class StealingDeque
+{
+public:
+	//! \brief constructs a deque, capacity is rounded up to a power of two.
+	explicit StealingDeque(std::size_t capacity = 1024)
+		: mTop(0)
+		, mBottom(0)
+	{
+		std::size_t _capacity = 1;
+		while (_capacity < capacity) _capacity <<= 1;
+
+		mMask = _capacity - 1;
+		mBuffer.reset(new std::atomic<T*>[_capacity]);
+	}
+
+	//! \brief owner only. answers false if the deque is full.
+	bool push(T* item)
+	{
+		const auto b = mBottom.load(std::memory_order_relaxed);
+		const auto t = mTop.load(std::memory_order_acquire);
+		if (b - t > static_cast<std::int64_t>(mMask)) return false;
+
+		mBuffer[b & mMask].store(item, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		mBottom.store(b + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	//! \brief owner only. answers the most recently pushed item or null.
+	T* pop()
+	{
+		const auto b = mBottom.load(std::memory_order_relaxed) - 1;
+		mBottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		auto t = mTop.load(std::memory_order_relaxed);
+
+		if (t > b)
+		{
+			// empty
+			mBottom.store(b + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		T* item = mBuffer[b & mMask].load(std::memory_order_relaxed);
+		if (t == b)
+		{
+			// last item, race the thieves for it
+			if (!mTop.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				item = nullptr;
+			mBottom.store(b + 1, std::memory_order_relaxed);
+		}
+		return item;
+	}
+
+	//! \brief any thread. answers the oldest item or null if empty or lost a race.
+	T* steal()
+	{
+		auto t = mTop.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const auto b = mBottom.load(std::memory_order_acquire);
+
+		if (t >= b) return nullptr;
+
+		T* item = mBuffer[t & mMask].load(std::memory_order_relaxed);
+		if (!mTop.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return nullptr;
+		return item;
+	}
+
+	//! \brief answers an approximate number of items, exact if called by the owner.
+	std::size_t size() const
+	{
+		const auto b = mBottom.load(std::memory_order_relaxed);
+		const auto t = mTop.load(std::memory_order_relaxed);
+		return b > t ? static_cast<std::size_t>(b - t) : 0;
+	}
+
+private:
+	StealingDeque(const StealingDeque&); // = delete
+	StealingDeque& operator=(const StealingDeque&); // = delete
+
+	std::atomic<std::int64_t>				mTop;
+	std::atomic<std::int64_t>				mBottom;
+	std::size_t								mMask;
+	std::unique_ptr<std::atomic<T*>[]>		mBuffer;
+};
+
+}} // !namespace cistft::work
+
+#endif // !CISTFT_INCLUDE_WORK_DEQUE_H_
\ No newline at end of file
@@ -0,0 +1,48 @@
+#ifndef CISTFT_INCLUDE_WORK_EVENT_H_
+#define CISTFT_INCLUDE_WORK_EVENT_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace cistft {
+namespace work {
+
+/*!
+ * \class EventCount
+ * \namespace cistft::work
+ *
+ * \brief parks idle worker threads without losing wake ups.
+ * A waiter announces itself with prepareWait(), checks its queues one more
+ * time and then either cancelWait()s or commitWait()s. notify() only touches
+ * the mutex when somebody is actually waiting, so the submit path stays
+ * lock-free while all workers are busy.
+ */
+class EventCount
+{
+public:
+	EventCount() : mState(0) {}
+
+	//! \brief announces a waiter, answers the key to pass to commitWait.
+	std::uint32_t		prepareWait();
+	//! \brief withdraws a waiter announced by prepareWait.
+	void				cancelWait();
+	//! \brief blocks until notified after the key was taken.
+	void				commitWait(std::uint32_t key);
+	//! \brief wakes one waiter, or all of them.
+	void				notify(bool all = false);
+
+private:
+	EventCount(const EventCount&); // = delete
+	EventCount& operator=(const EventCount&); // = delete
+
+	//! low 32 bits count the waiters, high 32 bits are the epoch
+	std::atomic<std::uint64_t>	mState;
+	std::mutex					mLock;
+	std::condition_variable		mCondition;
+};
+
+}} // !namespace cistft::work
+
+#endif // !CISTFT_INCLUDE_WORK_EVENT_H_
\ No newline at end of file
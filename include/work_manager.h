@@ -1,43 +1,125 @@
 #ifndef CISTFT_INCLUDE_WORK_MANAGER_H_
 #define CISTFT_INCLUDE_WORK_MANAGER_H_
 
-#include <boost/asio/io_service.hpp>
-#include <boost/thread/thread.hpp>
+#include "work_deque.h"
+#include "work_event.h"
+#include "work_metrics.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace cistft {
 namespace work {
 
 //! \note a shallow type for Client shared_ptr's
 typedef std::shared_ptr< class Client > ClientRef;
+
+/*!
+ * \struct RequestDeleter
+ * \brief gives pooled requests back to their pool, deletes the rest.
+ */
+struct RequestDeleter
+{
+	void operator()(class Request*) const;
+};
+
 //! \note a shallow type for Request unique_ptr's
-typedef std::unique_ptr< class Request > RequestRef;
+typedef std::unique_ptr< class Request, RequestDeleter > RequestRef;
 
 /*!
  * \class Manager
  * \namespace cistft::work
  *
- * \brief A work manager implemented with a dependency on Boost.Asio
- * handles work requests from the main thread and executes them in the
- * background.
+ * \brief A work-stealing work manager. handles work requests from the
+ * main thread and executes them in the background.
+ *
+ * \note every worker owns a Chase-Lev deque (StealingDeque). Requests
+ * posted from outside the pool go through a shared injection queue,
+ * workers move them into their own deques in batches and steal from each
+ * other when they run dry. Idle workers park on an EventCount.
+ * \note requests are queued intrusively, posting does not allocate.
+ * \note every worker records how long requests waited and ran into its
+ * own histograms, \see snapshot
  */
 
 class Manager
 {
 public:
-	//! \brief constructor of a work manager, accepts number of worker threads.
-	Manager(std::size_t num_threads = 4);
-	//! \brief joins all threads and stops IO service.
+	/*!
+	 * \struct Metrics
+	 * \brief a snapshot of the pool's instrumentation, durations are in nanoseconds.
+	 * \note reuse one object, busy ratios cover the time since it was last taken.
+	 */
+	struct Metrics
+	{
+		Metrics() : mQueueDepth(0), mTakenAt(0) {}
+
+		HistogramSnapshot			mWaitTime;		// posted to started, since the manager started
+		HistogramSnapshot			mServiceTime;	// started to finished, since the manager started
+		std::size_t					mQueueDepth;	// posted and not started yet
+		std::vector<float>			mBusyRatio;		// per worker, [0, 1]
+		std::vector<std::uint64_t>	mBusyTime;		// per worker, since the manager started
+		std::uint64_t				mTakenAt;
+	};
+
+	//! \brief constructor of a work manager, accepts number of worker threads
+	//! and optionally a set of CPUs the workers are pinned to.
+	Manager(std::size_t num_threads = 4, const std::vector<int>& cpus = std::vector<int>());
+	//! \brief stops and joins all threads, pending requests are discarded.
 	virtual ~Manager();
 
 	//! \brief runs a work request synchronously.
 	void							run(ClientRef, RequestRef);
 	//! \brief send a work request to the worker pool and runs it asynchronously.
 	void							post(const ClientRef&, RequestRef&);
+	//! \brief answers number of worker threads in the pool.
+	std::size_t						getNumThreads() const;
+	//! \brief limits how many workers take requests, the rest stay parked. [1, getNumThreads()]
+	void							setConcurrency(std::size_t num_active);
+	//! \brief answers how many workers take requests.
+	std::size_t						getConcurrency() const;
+	//! \brief fills a snapshot of the instrumentation. Cheap enough for a few times a second.
+	void							snapshot(Metrics&) const;
+
+private:
+	struct Worker
+	{
+		explicit Worker(std::size_t capacity) : mDeque(capacity), mBusyTime(0) {}
+
+		StealingDeque<Request>		mDeque;
+		std::thread					mThread;
+		Histogram					mWaitTime;
+		Histogram					mServiceTime;
+		std::atomic<std::uint64_t>	mBusyTime;
+	};
+
+	void							workerLoop(std::size_t index, std::vector<int> cpus);
+	void							parkInactive(std::size_t index);
+	Request*						findTask(std::size_t index);
+	Request*						popInjected(std::size_t index);
+	Request*						popInjectedLocked();
+	Request*						stealTask(std::size_t index);
+	void							execute(std::size_t index, Request*);
 
 private:
-	boost::asio::io_service			mIoService;
-	boost::thread_group				mThreadPool;
-	boost::asio::io_service::work	mWorker;
+	std::vector< std::unique_ptr<Worker> >
+									mWorkers;
+	std::mutex						mInjectionLock;
+	Request*						mInjectionHead;
+	Request*						mInjectionTail;
+	std::atomic<std::size_t>		mInjectionSize;
+	EventCount						mIdleWorkers;
+	std::mutex						mConcurrencyLock;
+	std::condition_variable			mConcurrencyChanged;
+	std::atomic<std::size_t>		mConcurrency;
+	std::atomic<bool>				mStopping;
+	std::size_t						mNumThreads;
+	std::uint64_t					mStartedAt;
 };
 
 }}
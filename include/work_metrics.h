@@ -0,0 +1,88 @@
+#ifndef CISTFT_INCLUDE_WORK_METRICS_H_
+#define CISTFT_INCLUDE_WORK_METRICS_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cistft {
+namespace work {
+
+//! \brief answers a monotonic timestamp in nanoseconds.
+//! \note QueryPerformanceCounter on Windows, the VS2013 steady_clock only ticks every few milliseconds.
+std::uint64_t		getTimestamp();
+//! \brief answers the CPU time, in nanoseconds, the process spent so far in user and kernel mode, all threads together.
+std::uint64_t		getProcessCpuTime();
+
+/*!
+ * \struct HistogramSnapshot
+ * \namespace cistft::work
+ * \brief a copy of one or more Histograms, safe to read and combine.
+ * \note counts are cumulative, subtract an earlier snapshot to get the
+ * distribution of an interval.
+ */
+struct HistogramSnapshot
+{
+	HistogramSnapshot();
+
+	//! \brief forgets every value.
+	void				clear();
+	//! \brief removes the values of an earlier snapshot of the same histograms.
+	void				subtract(const HistogramSnapshot& earlier);
+
+	std::uint64_t		getCount() const;
+	//! \brief answers the mean value, 0 if empty.
+	double				getMean() const;
+	//! \brief answers the highest value with `percentile` percent of values at or below it. [0, 100]
+	std::uint64_t		getPercentile(double percentile) const;
+	//! \brief answers the highest value recorded, within bucket precision.
+	std::uint64_t		getMax() const;
+
+	std::vector<std::uint64_t>
+						mCounts;
+	std::uint64_t		mSum;
+};
+
+/*!
+ * \class Histogram
+ * \namespace cistft::work
+ * \brief a log-linear (HDR style) histogram of nanosecond durations.
+ * \note every power of two is split into 8 linear sub buckets, values are
+ * kept within 12.5% from 1 ns up to about 18 minutes. Longer ones land in
+ * the last bucket.
+ * \note one thread records, any thread may collect at the same time.
+ * Recording is a couple of relaxed loads and stores, no locks and no
+ * read-modify-write, so it is cheap enough to stay on in production.
+ */
+class Histogram
+{
+public:
+	static const std::size_t	SUB_BUCKET_BITS = 3;
+	static const std::size_t	SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+	static const std::size_t	MAX_EXPONENT = 40;
+	static const std::size_t	NUM_BUCKETS = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKETS;
+
+	Histogram();
+
+	//! \brief records one value. Owner thread only.
+	void						record(std::uint64_t value);
+	//! \brief adds the recorded values to a snapshot. Thread safe.
+	void						collect(HistogramSnapshot& snapshot) const;
+
+	//! \brief answers the bucket a value falls in.
+	static std::size_t			getBucketIndex(std::uint64_t value);
+	//! \brief answers the highest value a bucket holds.
+	static std::uint64_t		getBucketUpperBound(std::size_t index);
+
+private:
+	Histogram(const Histogram&); // = delete
+	Histogram& operator=(const Histogram&); // = delete
+
+	std::atomic<std::uint64_t>	mCounts[NUM_BUCKETS];
+	std::atomic<std::uint64_t>	mSum;
+};
+
+}} //!cistft::work
+
+#endif //!CISTFT_INCLUDE_WORK_METRICS_H_
\ No newline at end of file
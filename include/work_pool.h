@@ -0,0 +1,118 @@
+#ifndef CISTFT_INCLUDE_WORK_POOL_H_
+#define CISTFT_INCLUDE_WORK_POOL_H_
+
+#include "work_request.h"
+
+#include <atomic>
+#include <new>
+
+namespace cistft {
+namespace work {
+
+/*!
+ * \class RequestPoolBase
+ * \namespace cistft::work
+ *
+ * \brief where pooled requests go back to once their RequestRef dies.
+ */
+class RequestPoolBase
+{
+public:
+	virtual ~RequestPoolBase() {}
+	//! \brief destroys the request and keeps its memory. Thread safe.
+	virtual void		recycle(Request*) = 0;
+
+protected:
+	static void			adopt(Request* request, RequestPoolBase* pool) { request->mPool = pool; }
+};
+
+/*!
+ * \class RequestPool
+ * \namespace cistft::work
+ *
+ * \brief a free list of request sized memory blocks. Requests of type T
+ * are constructed in place, and their memory goes back to the pool when
+ * their RequestRef is destroyed. Once warmed up, acquire and recycle
+ * never touch the heap.
+ *
+ * \note acquire must only be called from one thread at a time (the main
+ * thread), recycle may be called from any thread. Recycled blocks are
+ * pushed on a shared stack and the acquiring thread takes the whole stack
+ * at once, so the free list has no ABA problem.
+ * \note the pool must outlive its requests. Keep it in the client that
+ * handles them, posted requests keep their client alive.
+ */
+template<class T>
+class RequestPool final : public RequestPoolBase
+{
+public:
+	RequestPool() : mShared(nullptr), mPrivate(nullptr), mNumAllocated(0) {}
+
+	~RequestPool()
+	{
+		release(mPrivate);
+		release(mShared.exchange(nullptr, std::memory_order_acquire));
+	}
+
+	//! \brief constructs a T out of pooled memory.
+	template<class... Args>
+	RequestRef acquire(Args... args)
+	{
+		T* request = new (takeBlock()) T(args...);
+		adopt(request, this);
+		return RequestRef(request);
+	}
+
+	void recycle(Request* request) override
+	{
+		T* typed = static_cast<T*>(request);
+		typed->~T();
+
+		auto block = new (static_cast<void*>(typed)) Block;
+		block->mNext = mShared.load(std::memory_order_relaxed);
+		while (!mShared.compare_exchange_weak(block->mNext, block, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	//! \brief answers how many blocks were taken from the heap so far.
+	std::size_t getNumAllocated() const { return mNumAllocated; }
+
+private:
+	static_assert(std::is_base_of<Request, T>::value,
+		"RequestPool only accepts types derived from cistft::work::Request");
+
+	struct Block { Block* mNext; };
+
+	void* takeBlock()
+	{
+		if (!mPrivate) mPrivate = mShared.exchange(nullptr, std::memory_order_acquire);
+
+		if (mPrivate)
+		{
+			Block* block = mPrivate;
+			mPrivate = block->mNext;
+			block->~Block();
+			return block;
+		}
+
+		++mNumAllocated;
+		return ::operator new(sizeof(T) < sizeof(Block) ? sizeof(Block) : sizeof(T));
+	}
+
+	static void release(Block* list)
+	{
+		while (list)
+		{
+			Block* next = list->mNext;
+			::operator delete(list);
+			list = next;
+		}
+	}
+
+	std::atomic<Block*>				mShared;
+	Block*							mPrivate;
+	std::atomic<std::size_t>		mNumAllocated;
+};
+
+}} // !namespace cistft::work
+
+#endif // !CISTFT_INCLUDE_WORK_POOL_H_
\ No newline at end of file
@@ -3,11 +3,14 @@
 
 #include "work_manager.h"
 
+#include <cstdint>
 #include <memory>
 
 namespace cistft {
 namespace work {
 
+class RequestPoolBase;
+
 /*!
  * \class Request
  * \namespace cistft::work
@@ -18,14 +21,30 @@ namespace work {
  * \note ONLY a unique_ptr of this guy SHOULD be constructed. no shared
  * ownership what-so-ever!
  * \note subclass Request to get custom processing done.
- * \note use Request::make as the factory function.
+ * \note use Request::make as the factory function, or a RequestPool
+ * on hot paths.
+ * \note a posted request carries its client and is linked into the
+ * manager's queues by itself, posting it allocates nothing.
  */
 
 class Request
 {
 public:
+	Request() : mPool(nullptr), mNext(nullptr), mPostedAt(0) {}
+	virtual ~Request() {}
+
 	//! \brief main processing call. Background thread will call this.
 	virtual void		run() {};
+
+private:
+	friend class Manager;
+	friend class RequestPoolBase;
+	friend struct RequestDeleter;
+
+	ClientRef			mClient;	// set while the request is posted
+	RequestPoolBase*	mPool;		// null if the request came from the heap
+	Request*			mNext;		// intrusive link of the injection queue
+	std::uint64_t		mPostedAt;	// timestamp of the last post, see getTimestamp
 };
 
 //! \brief factory function for work requests. returns a unique_ptr.
@@ -36,7 +55,7 @@ static RequestRef make_request(Args... args)
 	static_assert(std::is_base_of<Request, T>::value,
 		"RequestRef factory method only accepts types derived from cistft::work::Request");
 	// copy elision will happen here by the compiler, no std::move required.
-	return std::unique_ptr<T>(new T(args...));
+	return RequestRef(new T(args...));
 }
 
 }}
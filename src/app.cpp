@@ -1,15 +1,28 @@
 #include "app.h"
 #include "palette_manager.h"
 
+#include <algorithm>
+
 namespace cistft
 {
 
+namespace {
+//! frames per second while nothing changes, bounds how late a paused view notices new rows
+static float IDLE_REFRESH_RATE = 5.0f;
+//! seconds the rate stays up after the last input or the last new rows
+static double REDRAW_LINGER = 0.5;
+} //!namespace
+
 Application::Application()
-	: mGlobals(mWorkManager, mAudioNodes, mStftRenderer, mGridRenderer, mAppConfig)
+	: mWorkManager(mAppConfig.getNumWorkerThreadsToSpawn(), mAppConfig.getWorkerAffinity())
+	, mGlobals(mWorkManager, mAudioNodes, mStftRenderer, mGridRenderer, mAppConfig)
 	, mAudioNodes(mGlobals)
 	, mStftRenderer(mGlobals)
 	, mMonitorRenderer(mGlobals)
 	, mGridRenderer(mGlobals)
+	, mMetricsPanel(mGlobals)
+	, mLastInputTime(0.0)
+	, mLastRowsTime(0.0)
 {}
 
 void Application::prepareSettings(Settings *settings)
@@ -35,8 +48,8 @@ void Application::prepareSettings(Settings *settings)
 	// set the window position (top left) to be at 10% of monitor size
 	settings->setWindowPos(window_position);
 
-	// cap at 300.0 fps!
-	settings->setFrameRate(300.0f);
+	// capped by the configuration, paceFrameRate lowers it while idle
+	settings->setFrameRate(mAppConfig.getMaxRefreshRate());
 }
 
 void Application::setup()
@@ -56,9 +69,14 @@ void Application::update()
 	mStftRenderer.update();
 	// Update audio input and pull the latest data in
 	mAudioNodes.update();
+	// Refresh the performance numbers shown in the GUI
+	if (mGlobals.getAudioNodes().isRecorderReady())
+		mMetricsPanel.update();
 	// Check if we have to swap GUI with post-launch one
 	if (mAppConfig.shouldLaunch())
 		setupPostLaunchGUI();
+	// Draw the next frames only as often as something changes
+	paceFrameRate();
 }
 
 void Application::draw()
@@ -100,6 +118,8 @@ void Application::draw()
 
 void Application::mouseDown(ci::app::MouseEvent event)
 {
+	requestRedraw();
+
 	// If user clicks anywhere on screen
 	if (mAudioNodes.isInputReady())
 	{
@@ -109,6 +129,8 @@ void Application::mouseDown(ci::app::MouseEvent event)
 
 void Application::keyDown(ci::app::KeyEvent event)
 {
+	requestRedraw();
+
 	// If user enters SPACE
 	if (event.getChar() == ' ')
 	{
@@ -119,10 +141,82 @@ void Application::keyDown(ci::app::KeyEvent event)
 	}
 }
 
+void Application::mouseUp(ci::app::MouseEvent event)
+{
+	requestRedraw();
+}
+
+void Application::mouseMove(ci::app::MouseEvent event)
+{
+	requestRedraw();
+}
+
+void Application::mouseDrag(ci::app::MouseEvent event)
+{
+	requestRedraw();
+}
+
+void Application::mouseWheel(ci::app::MouseEvent event)
+{
+	requestRedraw();
+}
+
+void Application::keyUp(ci::app::KeyEvent event)
+{
+	requestRedraw();
+}
+
+void Application::resize()
+{
+	requestRedraw();
+}
+
+void Application::requestRedraw()
+{
+	mLastInputTime = ci::app::getElapsedSeconds();
+	// effective right away, not one idle frame later
+	if (getFrameRate() != mAppConfig.getMaxRefreshRate())
+		setFrameRate(mAppConfig.getMaxRefreshRate());
+}
+
+void Application::paceFrameRate()
+{
+	const auto _now = ci::app::getElapsedSeconds();
+
+	const auto _mouse_pos = getMousePos();
+	if (_mouse_pos != mLastMousePos)
+	{
+		mLastMousePos = _mouse_pos;
+		mLastInputTime = _now;
+	}
+
+	// before launch the waveform moves while the input is on
+	const auto _has_new_rows = mAudioNodes.isRecorderReady()
+		? mStftRenderer.getNumUpdatedRows() > 0
+		: mAudioNodes.isInputEnabled();
+	if (_has_new_rows) mLastRowsTime = _now;
+
+	auto _rate = mAppConfig.getMaxRefreshRate();
+	if (mAppConfig.isEventDrivenRedraw() && _now - mLastInputTime > REDRAW_LINGER)
+	{
+		if (_now - mLastRowsTime > REDRAW_LINGER)
+		{
+			_rate = std::min(_rate, IDLE_REFRESH_RATE);
+		}
+		else if (mAppConfig.getHopDuration() > 0.0f)
+		{
+			// no point in drawing faster than rows are published
+			_rate = std::min(_rate, std::max(1.0f / mAppConfig.getHopDuration(), IDLE_REFRESH_RATE));
+		}
+	}
+
+	if (_rate != getFrameRate()) setFrameRate(_rate);
+}
+
 void Application::drawFps()
 {
 	std::stringstream buf;
-	buf << "FPS: " << ci::app::App::getAverageFps();
+	buf << "FPS: " << ci::app::App::getAverageFps() << " / " << getFrameRate();
 	ci::gl::drawStringRight(buf.str(), ci::Vec2i(ci::app::getWindowWidth() - 25, 10));
 }
 
@@ -163,6 +257,7 @@ void Application::setupPostLaunchGUI()
 		mGridRenderer.setVerticalBoundary(mAppConfig.getActualHighPassFrequency(), mAppConfig.getActualLowPassFrequency());
 		
 		palette::Manager::instance().setupPostLaunchGUI(mGuiInstance.get());
+		mMetricsPanel.setupPostLaunchGUI(mGuiInstance.get());
 
 		mAudioNodes.setupRecorder();
 		mStftRenderer.setup();
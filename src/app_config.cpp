@@ -1,25 +1,41 @@
 #include "app_config.h"
 #include "palette_manager.h"
+#include "thread_util.h"
+#include "polyphase_decimator.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <sstream>
+#include <vector>
 #include <mutex>
 
+#if !defined(CISTFT_HEADLESS)
 #include <cinder/Json.h>
 #include <cinder/params/Params.h>
 #include <cinder/audio/Context.h>
 
 #include <boost/algorithm/string/replace.hpp>
+#endif
 
 namespace cistft
 {
 
 namespace {
 const std::string TEMPLATE("{\n\
-	\"record_duration\":@RECORD_DURATION@,\n\
 	\"time_range\":@TIME_RANGE@,\n\
 	\"window_duration\":@WINDOW_DURATION@,\n\
 	\"hop_duration\":@HOP_DURATION@,\n\
 	\"viewable_bins\":@VIEWABLE_BINS@,\n\
+	\"fft_backend\":\"@FFT_BACKEND@\",\n\
+	\"max_worker_lag\":@MAX_WORKER_LAG@,\n\
+	\"worker_threads\":@WORKER_THREADS@,\n\
+	\"decimation\":@DECIMATION@,\n\
+	\"worker_affinity\":\"@WORKER_AFFINITY@\",\n\
+	\"audio_cpu\":@AUDIO_CPU@,\n\
+	\"input_source\":\"@INPUT_SOURCE@\",\n\
+	\"max_refresh_rate\":@MAX_REFRESH_RATE@,\n\
+	\"event_driven_redraw\":@EVENT_DRIVEN_REDRAW@,\n\
+	\"monitor_duration\":@MONITOR_DURATION@,\n\
 	\"bandpass\":{\n\
 		\"low_pass\":@FREQ_LOWPASS@,\n\
 		\"high_pass\":@FREQ_HIGHPASS@\n\
@@ -39,33 +55,40 @@ const std::string CONFIG_FILENAME("stft.conf");
 }
 
 AppConfig::AppConfig()
-	: mConfigFile(CONFIG_FILENAME, std::ios::in)
-	, mRecordDuration(20.0f * 60.0f) // every 20 minutes, internals will reset
-	, mTimeRange(20.0f) // 20 seconds in one screen
+	: mTimeRange(20.0f) // 20 seconds in one screen
 	, mWindowDuration(0.02f) // about 1024 samples in 20 seconds
 	, mHopDuration(0.01f) // about 512 samples in 20 seconds
 	, mMinimumViewableBins(256)
 	, mLowPassFrequency(10000.0f) //10KHz
 	, mHighPassFrequency(100.0f) //100Hz
+	, mFftBackend(static_cast<int>(fft::BackendType::Ooura))
+	, mMaxWorkerLag(2.0f) // workers may fall 2 seconds behind the audio thread
+	, mWorkerThreads(0) // auto
+	, mDecimation(0) // auto
+	, mAudioCpu(-1) // workers may run on any CPU, the audio callback included
+	, mInputSource("device") // the default microphone
+	, mMaxRefreshRate(60.0f)
+	, mEventDrivenRedraw(true) // full rate only while something changes
+	, mMonitorDuration(0.025f) // about 1024 samples
 	, mActualViewableBins(0)
 	, mActualLowPassFrequency(0)
 	, mActualHighPassFrequency(0)
 	, mMagnitudeIndexStart(0)
 	, mCalculatedFftSize(0)
+	, mDecimationFactor(1)
 	, mSampleRate(0)
 	, mSamplesCacheSize(50)
 	, mPreparedForLaunch(false)
 	, mDirty(true)
 {
+#if !defined(CISTFT_HEADLESS)
+	mConfigFile.open(CONFIG_FILENAME, std::ios::in);
 	if (mConfigFile)
 	{
 		std::stringstream buf;
 		buf << mConfigFile.rdbuf();
 		try {
 			ci::JsonTree _tree(buf.str());
-			if (_tree.hasChild("record_duration")) {
-				mRecordDuration = _tree.getChild("record_duration").getValue<float>();
-			}
 			if (_tree.hasChild("time_range")) {
 				mTimeRange = _tree.getChild("time_range").getValue<float>();
 			}
@@ -78,6 +101,44 @@ AppConfig::AppConfig()
 			if (_tree.hasChild("viewable_bins")) {
 				mMinimumViewableBins = _tree.getChild("viewable_bins").getValue<int>();
 			}
+			if (_tree.hasChild("fft_backend")) {
+				fft::BackendType _type;
+				if (fft::parseBackendName(_tree.getChild("fft_backend").getValue<std::string>(), _type))
+					fftBackend(_type);
+			}
+			if (_tree.hasChild("max_worker_lag")) {
+				maxWorkerLag(_tree.getChild("max_worker_lag").getValue<float>());
+			}
+			if (_tree.hasChild("worker_threads")) {
+				// either a number or "auto"
+				const auto _threads = _tree.getChild("worker_threads").getValue<std::string>();
+				workerThreads(_threads == "auto" ? 0 : std::atoi(_threads.c_str()));
+			}
+			if (_tree.hasChild("decimation")) {
+				// either a number or "auto"
+				const auto _decimation = _tree.getChild("decimation").getValue<std::string>();
+				decimation(_decimation == "auto" ? 0 : std::atoi(_decimation.c_str()));
+			}
+			if (_tree.hasChild("worker_affinity")) {
+				std::vector<int> _cpus;
+				if (thread::parseCpuList(_tree.getChild("worker_affinity").getValue<std::string>(), _cpus))
+					workerAffinity(_cpus);
+			}
+			if (_tree.hasChild("audio_cpu")) {
+				audioCpu(_tree.getChild("audio_cpu").getValue<int>());
+			}
+			if (_tree.hasChild("input_source")) {
+				inputSource(_tree.getChild("input_source").getValue<std::string>());
+			}
+			if (_tree.hasChild("max_refresh_rate")) {
+				maxRefreshRate(_tree.getChild("max_refresh_rate").getValue<float>());
+			}
+			if (_tree.hasChild("event_driven_redraw")) {
+				eventDrivenRedraw(_tree.getChild("event_driven_redraw").getValue<bool>());
+			}
+			if (_tree.hasChild("monitor_duration")) {
+				monitorDuration(_tree.getChild("monitor_duration").getValue<float>());
+			}
 			if (_tree.hasChild("bandpass"))
 			{
 				if (_tree.hasChild("bandpass.low_pass"))
@@ -119,6 +180,7 @@ AppConfig::AppConfig()
 		}
 		catch (...) { /*no op*/ }
 	}
+#endif // !CISTFT_HEADLESS
 
 	checkSanity();
 }
@@ -126,21 +188,58 @@ AppConfig::AppConfig()
 namespace {
 //! in terms of samples
 static int MINIMUM_ZERO_PADDING_OFFSET = 128;
+//! never decimate further than this
+static int MAX_DECIMATION_FACTOR = 16;
+//! in terms of decimated samples, windows shorter than this keep a lower factor
+static int MINIMUM_DECIMATED_WINDOW = 128;
+//! in frames per second, the bounds of the refresh rate
+static float MIN_REFRESH_RATE = 1.0f;
+static float MAX_REFRESH_RATE = 300.0f;
+//! in seconds, the bounds of the pre-launch waveform
+static float MIN_MONITOR_DURATION = 0.005f;
+static float MAX_MONITOR_DURATION = 60.0f;
+
+static bool _is_power_of_2(int x)
+{
+	return x > 0 && (x & (x - 1)) == 0;
+}
+
+//! answers the smallest power of two above x, same as ci::nextPowerOf2
+static int _next_power_of_2(int x)
+{
+	int _power = 1;
+	while (_power <= x) _power <<= 1;
+	return _power;
+}
 } //!namespace
 
 void AppConfig::buildBandPass() const
 {
-	mCalculatedFftSize = static_cast<int>((mMinimumViewableBins * mSampleRate) / (mLowPassFrequency - mHighPassFrequency));
+	// Everything above the low pass is thrown away, so the signal can run at a lower rate
+	mDecimationFactor = isDecimationAuto()
+		? static_cast<int>(dsp::PolyphaseDecimator::calculateFactor(static_cast<float>(mSampleRate), mLowPassFrequency, MAX_DECIMATION_FACTOR))
+		: std::min(mDecimation, MAX_DECIMATION_FACTOR);
+
+	while (mDecimationFactor > 1 && getWindowDurationInSamples() / mDecimationFactor < MINIMUM_DECIMATED_WINDOW)
+	{
+		--mDecimationFactor;
+	}
+
+	// The transform sees the decimated signal, same resolution out of a smaller FFT
+	const auto _sample_rate = static_cast<float>(mSampleRate) / mDecimationFactor;
+	const auto _window_size = getWindowDurationInSamples() / mDecimationFactor;
 
-	if (!ci::isPowerOf2(mCalculatedFftSize))
-		mCalculatedFftSize = ci::nextPowerOf2(mCalculatedFftSize);
+	mCalculatedFftSize = static_cast<int>((mMinimumViewableBins * _sample_rate) / (mLowPassFrequency - mHighPassFrequency));
 
-	if (mCalculatedFftSize < static_cast<int>(getWindowDurationInSamples()) + MINIMUM_ZERO_PADDING_OFFSET)
+	if (!_is_power_of_2(mCalculatedFftSize))
+		mCalculatedFftSize = _next_power_of_2(mCalculatedFftSize);
+
+	if (mCalculatedFftSize < _window_size + MINIMUM_ZERO_PADDING_OFFSET)
 	{
 		// The while loop guarantees we ALWAYS get zero padding
-		while (mCalculatedFftSize < static_cast<int>(getWindowDurationInSamples()) + MINIMUM_ZERO_PADDING_OFFSET)
+		while (mCalculatedFftSize < _window_size + MINIMUM_ZERO_PADDING_OFFSET)
 		{
-			mCalculatedFftSize = ci::nextPowerOf2(mCalculatedFftSize);
+			mCalculatedFftSize = _next_power_of_2(mCalculatedFftSize);
 		}
 	}
 
@@ -152,7 +251,7 @@ void AppConfig::buildBandPass() const
 	// index of operation placeholder
 	auto index = 0;
 	// Based on the calculated FFT size, calculate the frequency step per bin
-	const auto _frequency_step = (1.0f / mCalculatedFftSize) * mSampleRate;
+	const auto _frequency_step = (1.0f / mCalculatedFftSize) * _sample_rate;
 
 	// Let's find the high pass index first. This is where we start showing FFT data on screen
 	for (index = 0; index < mCalculatedFftSize / 2 && _temp_frequency < mHighPassFrequency; ++index)
@@ -189,29 +288,44 @@ void AppConfig::buildBandPass() const
 
 	// Calculated the actual number of bins shown to the user
 	mActualViewableBins = (index - mMagnitudeIndexStart) + 1;
+	// Never past the last bin a real transform of this size produces
+	if (mMagnitudeIndexStart + mActualViewableBins > mCalculatedFftSize / 2)
+		mActualViewableBins = mCalculatedFftSize / 2 - mMagnitudeIndexStart;
 	// We got the actual low pass frequency calculated here, in an ideal world, this is equal to what user has supplied
 	mActualLowPassFrequency = _temp_frequency;
 }
 
 AppConfig::~AppConfig()
 {
+#if !defined(CISTFT_HEADLESS)
 	if (mConfigFile) mConfigFile.close();
 	mConfigFile.open(CONFIG_FILENAME, std::ios::out);
 	if (mConfigFile)
 	{
 		mConfigFile << generateConfig() << std::endl;
 	}
+#endif // !CISTFT_HEADLESS
 }
 
+#if !defined(CISTFT_HEADLESS)
 std::string AppConfig::generateConfig() const
 {
 	std::string _template_copy(TEMPLATE);
 
-	boost::algorithm::replace_first(_template_copy, "@RECORD_DURATION@", std::to_string(mRecordDuration));
 	boost::algorithm::replace_first(_template_copy, "@TIME_RANGE@", std::to_string(mTimeRange));
 	boost::algorithm::replace_first(_template_copy, "@WINDOW_DURATION@", std::to_string(mWindowDuration));
 	boost::algorithm::replace_first(_template_copy, "@HOP_DURATION@", std::to_string(mHopDuration));
 	boost::algorithm::replace_first(_template_copy, "@VIEWABLE_BINS@", std::to_string(mMinimumViewableBins));
+	boost::algorithm::replace_first(_template_copy, "@FFT_BACKEND@", fft::getBackendName(getFftBackend()));
+	boost::algorithm::replace_first(_template_copy, "@MAX_WORKER_LAG@", std::to_string(mMaxWorkerLag));
+	boost::algorithm::replace_first(_template_copy, "@WORKER_THREADS@", isWorkerThreadsAuto() ? "\"auto\"" : std::to_string(mWorkerThreads));
+	boost::algorithm::replace_first(_template_copy, "@DECIMATION@", isDecimationAuto() ? "\"auto\"" : std::to_string(mDecimation));
+	boost::algorithm::replace_first(_template_copy, "@WORKER_AFFINITY@", thread::formatCpuList(mWorkerAffinity));
+	boost::algorithm::replace_first(_template_copy, "@AUDIO_CPU@", std::to_string(mAudioCpu));
+	boost::algorithm::replace_first(_template_copy, "@INPUT_SOURCE@", mInputSource);
+	boost::algorithm::replace_first(_template_copy, "@MAX_REFRESH_RATE@", std::to_string(mMaxRefreshRate));
+	boost::algorithm::replace_first(_template_copy, "@EVENT_DRIVEN_REDRAW@", mEventDrivenRedraw ? "true" : "false");
+	boost::algorithm::replace_first(_template_copy, "@MONITOR_DURATION@", std::to_string(mMonitorDuration));
 	boost::algorithm::replace_first(_template_copy, "@FREQ_LOWPASS@", std::to_string(mLowPassFrequency));
 	boost::algorithm::replace_first(_template_copy, "@FREQ_HIGHPASS@", std::to_string(mHighPassFrequency));
 	boost::algorithm::replace_first(_template_copy, "@CP_INDEX@", std::to_string(palette::Manager::instance().getActivePalette()));
@@ -223,10 +337,10 @@ std::string AppConfig::generateConfig() const
 
 	return _template_copy;
 }
+#endif // !CISTFT_HEADLESS
 
 void AppConfig::checkSanity()
 {
-	if (mTimeRange > mRecordDuration) mTimeRange = mRecordDuration;
 	if (mWindowDuration > mTimeRange) mWindowDuration = mTimeRange;
 	if (mHopDuration > mWindowDuration) mHopDuration = mWindowDuration;
 	if (mHighPassFrequency < 0) mHighPassFrequency = 0;
@@ -289,12 +403,20 @@ AppConfig& AppConfig::highPassFrequency(float val)
 	return *this;
 }
 
-AppConfig& AppConfig::recordDuration(float val)
+AppConfig& AppConfig::fftBackend(fft::BackendType type)
+{
+	if (!fft::isBackendAvailable(type)) return *this;
+
+	mFftBackend = static_cast<int>(type);
+	return *this;
+}
+
+AppConfig& AppConfig::maxWorkerLag(float val)
 {
-	mRecordDuration = val;
+	mMaxWorkerLag = val;
 
-	if (mRecordDuration < 0)
-		mRecordDuration = 0;
+	if (mMaxWorkerLag < 0)
+		mMaxWorkerLag = 0;
 
 	mDirty = true;
 	return *this;
@@ -361,6 +483,147 @@ float AppConfig::getHighPassFrequency() const
 	return mHighPassFrequency;
 }
 
+fft::BackendType AppConfig::getFftBackend() const
+{
+	const auto _type = static_cast<fft::BackendType>(mFftBackend);
+	return fft::isBackendAvailable(_type) ? _type : fft::BackendType::Portable;
+}
+
+AppConfig& AppConfig::workerThreads(int val)
+{
+	mWorkerThreads = val < 0 ? 0 : val;
+	return *this;
+}
+
+AppConfig& AppConfig::workerAffinity(const std::vector<int>& cpus)
+{
+	mWorkerAffinity = cpus;
+	return *this;
+}
+
+AppConfig& AppConfig::audioCpu(int cpu)
+{
+	mAudioCpu = cpu < 0 ? -1 : cpu;
+	return *this;
+}
+
+AppConfig& AppConfig::inputSource(const std::string& source)
+{
+	mInputSource = source.empty() ? "device" : source;
+	return *this;
+}
+
+const std::string& AppConfig::getInputSource() const
+{
+	return mInputSource;
+}
+
+AppConfig& AppConfig::maxRefreshRate(float fps)
+{
+	mMaxRefreshRate = std::min(std::max(fps, MIN_REFRESH_RATE), MAX_REFRESH_RATE);
+	return *this;
+}
+
+AppConfig& AppConfig::eventDrivenRedraw(bool enabled)
+{
+	mEventDrivenRedraw = enabled;
+	return *this;
+}
+
+float AppConfig::getMaxRefreshRate() const
+{
+	return mMaxRefreshRate;
+}
+
+bool AppConfig::isEventDrivenRedraw() const
+{
+	return mEventDrivenRedraw;
+}
+
+AppConfig& AppConfig::monitorDuration(float val)
+{
+	mMonitorDuration = std::min(std::max(val, MIN_MONITOR_DURATION), MAX_MONITOR_DURATION);
+	return *this;
+}
+
+float AppConfig::getMonitorDuration() const
+{
+	return mMonitorDuration;
+}
+
+AppConfig& AppConfig::decimation(int factor)
+{
+	mDecimation = factor < 0 ? 0 : factor;
+
+	mDirty = true;
+	return *this;
+}
+
+int AppConfig::getDecimation() const
+{
+	return mDecimation;
+}
+
+bool AppConfig::isDecimationAuto() const
+{
+	return mDecimation == 0;
+}
+
+int AppConfig::getDecimationFactor() const
+{
+	checkDirty();
+	return mDecimationFactor;
+}
+
+int AppConfig::getWorkerThreads() const
+{
+	return mWorkerThreads;
+}
+
+bool AppConfig::isWorkerThreadsAuto() const
+{
+	return mWorkerThreads == 0;
+}
+
+int AppConfig::getNumWorkerThreadsToSpawn() const
+{
+	if (!isWorkerThreadsAuto()) return mWorkerThreads;
+
+	// one per CPU workers may run on, the active count is adapted at runtime
+	const auto _affinity = getWorkerAffinity();
+	const auto _cpus = _affinity.empty() ? thread::getNumCpus() : static_cast<int>(_affinity.size());
+	return _cpus > 1 ? _cpus : 1;
+}
+
+std::vector<int> AppConfig::getWorkerAffinity() const
+{
+	std::vector<int> _cpus = mWorkerAffinity;
+	_cpus.erase(std::remove(_cpus.begin(), _cpus.end(), mAudioCpu), _cpus.end());
+
+	// an audio CPU alone, or a list naming nothing but the audio CPU, means "anywhere but there".
+	// an empty answer would unpin the workers and let them onto the audio CPU again.
+	if (_cpus.empty() && mAudioCpu >= 0)
+	{
+		for (int cpu = 0; cpu < thread::getNumCpus(); ++cpu)
+		{
+			if (cpu != mAudioCpu) _cpus.push_back(cpu);
+		}
+	}
+
+	return _cpus;
+}
+
+int AppConfig::getAudioCpu() const
+{
+	return mAudioCpu;
+}
+
+float AppConfig::getMaxWorkerLag() const
+{
+	checkDirty();
+	return mMaxWorkerLag;
+}
+
 int AppConfig::getActualViewableBins() const
 {
 	checkDirty();
@@ -391,12 +654,6 @@ int AppConfig::getCalculatedFftSize() const
 	return mCalculatedFftSize;
 }
 
-float AppConfig::getRecordDuration() const
-{
-	checkDirty();
-	return mRecordDuration;
-}
-
 float AppConfig::getTimeRange() const
 {
 	checkDirty();
@@ -421,12 +678,6 @@ int AppConfig::getSamplesCacheSize() const
 	return mSamplesCacheSize;
 }
 
-int AppConfig::getRecordDurationInSamples() const
-{
-	checkDirty();
-	return static_cast<int>(getRecordDuration() * mSampleRate);
-}
-
 int AppConfig::getTimeSpanInSamples() const
 {
 	checkDirty();
@@ -445,6 +696,18 @@ int AppConfig::getWindowDurationInSamples() const
 	return static_cast<int>(getWindowDuration() * mSampleRate);
 }
 
+int AppConfig::getMonitorDurationInSamples() const
+{
+	checkDirty();
+	return std::max(static_cast<int>(getMonitorDuration() * mSampleRate), 1);
+}
+
+int AppConfig::getMaxWorkerLagInSamples() const
+{
+	checkDirty();
+	return static_cast<int>(getMaxWorkerLag() * mSampleRate);
+}
+
 int AppConfig::getSampleRate() const
 {
 	checkDirty();
@@ -456,6 +719,7 @@ void AppConfig::checkDirty() const
 	if (mDirty) { setup(); }
 }
 
+#if !defined(CISTFT_HEADLESS)
 namespace {
 namespace GUI_STATICS {
 const static std::string SAMPLE_CACHE_SIZE_KEY("Sample cache size (Pixels)");
@@ -464,17 +728,44 @@ const static std::string BINS_TEXT_KEY("Guaranteed FFT bins");
 const static std::string LOW_PASS_FREQ_KEY("Low pass frequency (Hz)");
 const static std::string HIGH_PASS_FREQ_KEY("High pass frequency (Hz)");
 const static std::string CALCULATED_FFT_KEY("Calculated FFT size");
+const static std::string FFT_BACKEND_KEY("FFT backend");
+const static std::string DECIMATION_KEY("Decimation (0 = auto)");
+const static std::string CALCULATED_DECIMATION_KEY("Calculated decimation");
 const static std::string ACTUAL_VIEWABLE_BINS_KEY("Calculated viewable bins");
 const static std::string ACTUAL_LP_FREQ_KEY("Calculated Low pass frequency (Hz)");
 const static std::string ACTUAL_HP_FREQ_KEY("Calculated High pass frequency (Hz)");
 const static std::string CONFIGURE_TEXT_KEY("Configure the parameters below and hit START");
-const static std::string RECORD_TEXT_KEY("Record duration (s)");
 const static std::string VIEWABLE_TEXT_KEY("Viewable Time range (s)");
 const static std::string WINDOW_TEXT_KEY("Window duration (s)");
 const static std::string HOP_TEXT_KEY("Hop duration (s)");
 const static std::string START_BUTTON_KEY("START");
+const static std::string MAX_REFRESH_KEY("Max refresh rate (fps)");
+const static std::string EVENT_DRIVEN_KEY("Redraw on new rows and input only");
 }}
 
+namespace {
+//! only the backends compiled into this build are offered, the GUI index maps into this list
+static std::vector<fft::BackendType> _get_available_fft_backends()
+{
+	std::vector<fft::BackendType> _types;
+	for (int index = 0; index < static_cast<int>(fft::BackendType::Count); ++index)
+	{
+		const auto _type = static_cast<fft::BackendType>(index);
+		if (fft::isBackendAvailable(_type)) _types.push_back(_type);
+	}
+	return _types;
+}
+
+static std::vector<std::string> _get_fft_backend_names(const std::vector<fft::BackendType>& types)
+{
+	std::vector<std::string> _names;
+	for (const auto type : types)
+	{
+		_names.push_back(fft::getBackendName(type));
+	}
+	return _names;
+}} //!namespace
+
 void AppConfig::setupPreLaunchGUI(cinder::params::InterfaceGl* const gui)
 {
 	gui->addText("Filter parameters");
@@ -485,16 +776,23 @@ void AppConfig::setupPreLaunchGUI(cinder::params::InterfaceGl* const gui)
 	gui->addParam<float>(GUI_STATICS::HIGH_PASS_FREQ_KEY, [this](float val){ highPassFrequency(val); }, [this]()->float{ return getHighPassFrequency(); });
 
 	gui->addParam(GUI_STATICS::CALCULATED_FFT_KEY, &mCalculatedFftSize, "readonly=true");
+	const auto _backends = _get_available_fft_backends();
+	gui->addParam(GUI_STATICS::FFT_BACKEND_KEY, _get_fft_backend_names(_backends),
+		[this, _backends](int val){ fftBackend(_backends[val]); },
+		[this, _backends]()->int{ return static_cast<int>(std::find(_backends.begin(), _backends.end(), getFftBackend()) - _backends.begin()); });
+	gui->addParam<int>(GUI_STATICS::DECIMATION_KEY, [this](int val){ decimation(val); }, [this]()->int{ return getDecimation(); });
+	gui->addParam(GUI_STATICS::CALCULATED_DECIMATION_KEY, &mDecimationFactor, "readonly=true");
 	gui->addParam(GUI_STATICS::ACTUAL_VIEWABLE_BINS_KEY, &mActualViewableBins, "readonly=true");
 	gui->addParam(GUI_STATICS::ACTUAL_LP_FREQ_KEY, &mLowPassFrequency, "readonly=true");
 	gui->addParam(GUI_STATICS::ACTUAL_HP_FREQ_KEY, &mHighPassFrequency, "readonly=true");
 	gui->addSeparator();
 
 	gui->addText(GUI_STATICS::CONFIGURE_TEXT_KEY);
-	gui->addParam(GUI_STATICS::RECORD_TEXT_KEY, &mRecordDuration).min(300.0f).max(6000.0f).step(10.0f);
 	gui->addParam(GUI_STATICS::VIEWABLE_TEXT_KEY, &mTimeRange).min(2.0f).max(20.0f).step(0.5f);
 	gui->addParam(GUI_STATICS::WINDOW_TEXT_KEY, &mWindowDuration).min(0.01f).max(0.5f).step(0.01f);
 	gui->addParam(GUI_STATICS::HOP_TEXT_KEY, &mHopDuration).min(0.0f).max(0.5f).step(0.005f);
+	gui->addParam(GUI_STATICS::MAX_REFRESH_KEY, &mMaxRefreshRate).min(MIN_REFRESH_RATE).max(MAX_REFRESH_RATE).step(5.0f);
+	gui->addParam(GUI_STATICS::EVENT_DRIVEN_KEY, &mEventDrivenRedraw);
 	gui->addSeparator();
 
 	gui->addButton(GUI_STATICS::START_BUTTON_KEY, [this, gui] {
@@ -509,11 +807,12 @@ void AppConfig::setupPostLaunchGUI(cinder::params::InterfaceGl* const gui)
 	gui->setOptions(GUI_STATICS::BINS_TEXT_KEY, "readonly=true");
 	gui->setOptions(GUI_STATICS::LOW_PASS_FREQ_KEY, "readonly=true");
 	gui->setOptions(GUI_STATICS::HIGH_PASS_FREQ_KEY, "readonly=true");
+	gui->setOptions(GUI_STATICS::FFT_BACKEND_KEY, "readonly=true");
+	gui->setOptions(GUI_STATICS::DECIMATION_KEY, "readonly=true");
 
 	gui->removeParam(GUI_STATICS::START_BUTTON_KEY);
 	gui->removeParam(GUI_STATICS::CONFIGURE_TEXT_KEY);
 
-	gui->setOptions(GUI_STATICS::RECORD_TEXT_KEY, "readonly=true");
 	gui->setOptions(GUI_STATICS::WINDOW_TEXT_KEY, "readonly=true");
 	gui->setOptions(GUI_STATICS::HOP_TEXT_KEY, "readonly=true");
 	gui->setOptions(GUI_STATICS::VIEWABLE_TEXT_KEY, "readonly=true");
@@ -524,6 +823,15 @@ static size_t _get_sample_rate()
 {
 return ci::audio::Context::deviceManager()->getDefaultOutput()->getSampleRate();
 }} //!namespace
+#else
+AppConfig& AppConfig::sampleRate(int val)
+{
+	mSampleRate = val;
+
+	mDirty = true;
+	return *this;
+}
+#endif // !CISTFT_HEADLESS
 
 void AppConfig::setup() const
 {
@@ -531,7 +839,9 @@ void AppConfig::setup() const
 	
 	mDirty = false;
 	
+#if !defined(CISTFT_HEADLESS)
 	mSampleRate = _get_sample_rate();
+#endif
 	buildBandPass();
 }
 
@@ -2,14 +2,19 @@
 #include "app_globals.h"
 #include "app_config.h"
 #include "recorder_node.h"
+#include "generator_node.h"
+#include "waveform_node.h"
 #include "stft_client.h"
 #include "stft_request.h"
 #include "grid_renderer.h"
+#include "stft_renderer.h"
 
 #include <cinder/audio/Context.h>
-#include <cinder/audio/MonitorNode.h>
 #include <cinder/app/App.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace cistft
 {
 
@@ -19,11 +24,16 @@ AudioNodes::AudioNodes(AppGlobals& globals)
 	, mIsInputReady(false)
 	, mIsMonitorReady(false)
 	, mIsRecorderReady(false)
-	, mQueryPosition(0)
 {}
 
 void AudioNodes::setupInput()
 {
+	// A generated signal was asked for, no need for a microphone
+	if (mGlobals.getAppConfig().getInputSource() != "device" && setupGenerator(mGlobals.getAppConfig().getInputSource()))
+	{
+		return;
+	}
+
 	try
 	{
 		// Iterate through all devices on this machine and see if we can find any inputs.
@@ -36,15 +46,17 @@ void AudioNodes::setupInput()
 
 		if (num_inputs == 0)
 		{
-			ci::app::getWindow()->setTitle(ci::app::getWindow()->getTitle() + " ( Could not find any input channels. Make sure your computer comes with a mic! )");
+			ci::app::getWindow()->setTitle(ci::app::getWindow()->getTitle() + " ( Could not find any input channels, showing pink noise. )");
+			setupGenerator("pink");
 			return;
 		}
 
-		mInputDeviceNode = mGlobals.getAudioContext().createInputDeviceNode();
+		mInputNode = mGlobals.getAudioContext().createInputDeviceNode();
 	}
 	catch (const std::exception&)
 	{
-		ci::app::getWindow()->setTitle(ci::app::getWindow()->getTitle() + " ( No audio input found. )");
+		ci::app::getWindow()->setTitle(ci::app::getWindow()->getTitle() + " ( No audio input found, showing pink noise. )");
+		setupGenerator("pink");
 		return;
 	}
 	catch (...)
@@ -57,19 +69,42 @@ void AudioNodes::setupInput()
 	mIsInputReady = true;
 }
 
+bool AudioNodes::setupGenerator(const std::string& signal_name)
+{
+	audio::SignalType _signal;
+	if (!audio::SignalGenerator::parseSignalName(signal_name, _signal)) return false;
+
+	// same seed every run, so two runs see the same input
+	const auto _format = audio::SignalGenerator::Format()
+		.signal(_signal)
+		.sampleRate(static_cast<int>(mGlobals.getAudioContext().getSampleRate()));
+
+	mInputNode = mGlobals.getAudioContext().makeNode(new audio::GeneratorNode(_format));
+
+	enableInput();
+	mIsInputReady = true;
+	return true;
+}
+
 void AudioNodes::setupRecorder()
 {
 	if (!isInputReady()) return;
 
 	mBufferRecorderNode = mGlobals.getAudioContext().makeNode(new cistft::audio::RecorderNode(mGlobals));
-	mInputDeviceNode >> mBufferRecorderNode;
+	mInputNode >> mBufferRecorderNode;
 
 	auto stftClientFormat = stft::Client::Format()
 		.channels(mBufferRecorderNode->getNumChannels())
 		.fftSize(mGlobals.getAppConfig().getCalculatedFftSize())
-		.windowSize(mGlobals.getAppConfig().getWindowDurationInSamples());
+		.windowSize(mGlobals.getAppConfig().getWindowDurationInSamples())
+		.decimation(mGlobals.getAppConfig().getDecimationFactor());
 
-	mStftClient = work::make_client<stft::Client>(mGlobals.getWorkManager(), &mGlobals, stftClientFormat);
+	mStftClient = std::static_pointer_cast<stft::Client>(work::make_client<stft::Client>(
+		mGlobals.getWorkManager(),
+		&mGlobals.getAppConfig(),
+		&mBufferRecorderNode->getRecorder(),
+		&mGlobals.getThreadRenderer(),
+		stftClientFormat));
 
 	mBufferRecorderNode->start();
 	mIsRecorderReady = true;
@@ -79,10 +114,10 @@ void AudioNodes::setupMonitor()
 {
 	if (!isInputReady()) return;
 
-	auto monitorFormat = ci::audio::MonitorNode::Format().windowSize(1024);
-	mMonitorNode = mGlobals.getAudioContext().makeNode(new ci::audio::MonitorNode(monitorFormat));
+	// drawing cost does not depend on the duration, see WaveformNode
+	mMonitorNode = mGlobals.getAudioContext().makeNode(new cistft::audio::WaveformNode(mGlobals.getAppConfig().getMonitorDurationInSamples()));
 
-	mInputDeviceNode >> mMonitorNode;
+	mInputNode >> mMonitorNode;
 
 	mIsMonitorReady = true;
 }
@@ -91,40 +126,120 @@ void AudioNodes::update()
 {
 	if (isRecorderReady())
 	{
-		while (mBufferRecorderNode->popBufferWindow(mQueryPosition))
+		auto& renderer_ref = mGlobals.getThreadRenderer();
+		auto& recorder_ref = mBufferRecorderNode->getRecorder();
+		const auto _hop_size = recorder_ref.getHopSize();
+
+		// hops that would scroll off before they are drawn are not worth requesting
+		const auto _history = std::max<std::size_t>(1, mGlobals.getAppConfig().getTimeSpanInSamples() / _hop_size);
+		const auto _pending = recorder_ref.getNumPendingPops();
+		if (_pending > _history)
 		{
-			mStftClient->request(work::make_request<stft::Request>(mQueryPosition));
+			recorder_ref.skipBufferWindows(_pending - _history);
+			mStftClient->dropHops(_pending - _history);
 		}
 
-		auto _time_diff = getBufferRecorderNode()->getWritePosition() / static_cast<float>(getBufferRecorderNode()->getSampleRate()) - mGlobals.getAppConfig().getTimeRange();
+		// spread the backlog over the workers, one hop per request when we are keeping up
+		const auto _batch_size = calculateBatchSize();
+		const auto _stride = calculateStride();
 
-		mGlobals.getGridRenderer().setHorizontalBoundary(_time_diff, mGlobals.getAppConfig().getTimeRange() + _time_diff);
+		std::uint64_t _first_pos = 0;
+		const auto _num_hops = recorder_ref.popBufferWindows(_first_pos, recorder_ref.getNumPendingPops());
 
-		if (!getBufferRecorderNode()->isRecording())
+		// newest batch first, under overload the freshest rows are served before the stale ones
+		auto _remaining = _num_hops;
+		while (_remaining > 0)
 		{
-			// set to loop audio recording forever.
-			getBufferRecorderNode()->reset();
-			getBufferRecorderNode()->start();
+			const auto _batch_hops = std::min(_batch_size, _remaining);
+			_remaining -= _batch_hops;
+
+			const auto _batch_start = _first_pos + _remaining * _hop_size;
+			mStftClient->request(mStftClient->makeRequest(_batch_start, _batch_hops, _stride, renderer_ref.getDeadlineByQueryPos(_batch_start)));
 		}
+
+		if (mGlobals.getAppConfig().isWorkerThreadsAuto())
+		{
+			adaptConcurrency();
+		}
+
+		// seconds are computed in double, a float runs out of precision after a few days
+		const auto _recorded = recorder_ref.getWritePosition() / static_cast<double>(mBufferRecorderNode->getSampleRate());
+		const auto _time_diff = static_cast<float>(_recorded - mGlobals.getAppConfig().getTimeRange());
+
+		mGlobals.getGridRenderer().setHorizontalBoundary(_time_diff, mGlobals.getAppConfig().getTimeRange() + _time_diff);
 	}
 }
 
+namespace {
+//! upper bound of hops processed by a single STFT request
+static std::size_t MAX_HOPS_PER_REQUEST = 32;
+} //!namespace
+
+std::size_t AudioNodes::calculateBatchSize() const
+{
+	const auto _pending = mBufferRecorderNode->getRecorder().getNumPendingPops();
+	const auto _workers = mGlobals.getWorkManager().getConcurrency();
+	const auto _batch_size = _workers > 0 ? _pending / _workers : _pending;
+
+	if (_batch_size < 1) return 1;
+	if (_batch_size > MAX_HOPS_PER_REQUEST) return MAX_HOPS_PER_REQUEST;
+	return _batch_size;
+}
+
+namespace {
+//! upper bound of hops sharing one transform under overload
+static std::size_t MAX_DECIMATION_STRIDE = 8;
+} //!namespace
+
+std::size_t AudioNodes::calculateStride() const
+{
+	// queued work worth more than the allowed worker lag turns into latency, trade resolution instead
+	const auto& recorder_ref = mBufferRecorderNode->getRecorder();
+	const auto _budget = std::max<std::size_t>(1, mGlobals.getAppConfig().getMaxWorkerLagInSamples() / recorder_ref.getHopSize());
+	const auto _backlog = mStftClient->getNumQueuedTransforms() + recorder_ref.getNumPendingPops();
+
+	if (_backlog <= _budget) return 1;
+	return std::min((_backlog + _budget - 1) / _budget, MAX_DECIMATION_STRIDE);
+}
+
+namespace {
+//! auto concurrency keeps every active worker at most this busy, the rest absorbs bursts
+static float TARGET_WORKER_LOAD = 0.5f;
+} //!namespace
+
+void AudioNodes::adaptConcurrency()
+{
+	const auto _hop_cost = mStftClient->getHopCost();
+	if (_hop_cost <= 0.0f) return;
+
+	const auto _hops_per_second = mBufferRecorderNode->getSampleRate() / static_cast<float>(mBufferRecorderNode->getRecorder().getHopSize());
+	const auto _needed = std::ceil(_hop_cost * _hops_per_second / TARGET_WORKER_LOAD);
+
+	// clamped to [1, number of threads] by the manager
+	mGlobals.getWorkManager().setConcurrency(static_cast<std::size_t>(_needed));
+}
+
 cistft::audio::RecorderNode* const AudioNodes::getBufferRecorderNode()
 {
 	return mBufferRecorderNode.get();
 }
 
-cinder::audio::MonitorNode* const AudioNodes::getMonitorNode()
+cistft::audio::WaveformNode* const AudioNodes::getMonitorNode()
 {
 	return mMonitorNode.get();
 }
 
+stft::Client* const AudioNodes::getStftClient()
+{
+	return mStftClient.get();
+}
+
 void AudioNodes::enableInput()
 {
 	if (mIsEnabled) return;
 
 	mGlobals.getAudioContext().enable();
-	mInputDeviceNode->enable();
+	mInputNode->enable();
 
 	mIsEnabled = true;
 }
@@ -134,7 +249,7 @@ void AudioNodes::disableInput()
 	if (!mIsEnabled) return;
 
 	mGlobals.getAudioContext().disable();
-	mInputDeviceNode->disable();
+	mInputNode->disable();
 
 	mIsEnabled = false;
 }
@@ -166,4 +281,9 @@ bool AudioNodes::isMonitorReady() const
 	return mIsMonitorReady;
 }
 
+bool AudioNodes::isInputEnabled() const
+{
+	return mIsEnabled;
+}
+
 } //!cistft
\ No newline at end of file
@@ -6,2269 +6,2269 @@ namespace palette {
 //! \note All palette generated from http://www.ncl.ucar.edu/Document/Graphics/color_table_gallery.shtml
 
 //! \see http://www.ncl.ucar.edu/Document/Graphics/ColorTables/matlab_jet.shtml
-const std::array<const ci::Color, 64> MatlabJet::palette{{
-	ci::Color(0.0000f, 0.0000f, 0.56078f),
-	ci::Color(0.0000f, 0.0000f, 0.62353f),
-	ci::Color(0.0000f, 0.0000f, 0.68627f),
-	ci::Color(0.0000f, 0.0000f, 0.74902f),
-	ci::Color(0.0000f, 0.0000f, 0.81176f),
-	ci::Color(0.0000f, 0.0000f, 0.87451f),
-	ci::Color(0.0000f, 0.0000f, 0.93725f),
-	ci::Color(0.0000f, 0.0000f, 1.0000f),
-	ci::Color(0.0000f, 0.058824f, 1.0000f),
-	ci::Color(0.0000f, 0.12157f, 1.0000f),
-	ci::Color(0.0000f, 0.18431f, 1.0000f),
-	ci::Color(0.0000f, 0.24706f, 1.0000f),
-	ci::Color(0.0000f, 0.30980f, 1.0000f),
-	ci::Color(0.0000f, 0.37255f, 1.0000f),
-	ci::Color(0.0000f, 0.43529f, 1.0000f),
-	ci::Color(0.0000f, 0.49804f, 1.0000f),
-	ci::Color(0.0000f, 0.56078f, 1.0000f),
-	ci::Color(0.0000f, 0.62353f, 1.0000f),
-	ci::Color(0.0000f, 0.68627f, 1.0000f),
-	ci::Color(0.0000f, 0.74902f, 1.0000f),
-	ci::Color(0.0000f, 0.81176f, 1.0000f),
-	ci::Color(0.0000f, 0.87451f, 1.0000f),
-	ci::Color(0.0000f, 0.93725f, 1.0000f),
-	ci::Color(0.0000f, 1.0000f, 1.0000f),
-	ci::Color(0.058824f, 1.0000f, 0.93725f),
-	ci::Color(0.12157f, 1.0000f, 0.87451f),
-	ci::Color(0.18431f, 1.0000f, 0.81176f),
-	ci::Color(0.24706f, 1.0000f, 0.74902f),
-	ci::Color(0.30980f, 1.0000f, 0.68627f),
-	ci::Color(0.37255f, 1.0000f, 0.62353f),
-	ci::Color(0.43529f, 1.0000f, 0.56078f),
-	ci::Color(0.49804f, 1.0000f, 0.49804f),
-	ci::Color(0.56078f, 1.0000f, 0.43529f),
-	ci::Color(0.62353f, 1.0000f, 0.37255f),
-	ci::Color(0.68627f, 1.0000f, 0.30980f),
-	ci::Color(0.74902f, 1.0000f, 0.24706f),
-	ci::Color(0.81176f, 1.0000f, 0.18431f),
-	ci::Color(0.87451f, 1.0000f, 0.12157f),
-	ci::Color(0.93725f, 1.0000f, 0.058824f),
-	ci::Color(1.0000f, 1.0000f, 0.0000f),
-	ci::Color(1.0000f, 0.93725f, 0.0000f),
-	ci::Color(1.0000f, 0.87451f, 0.0000f),
-	ci::Color(1.0000f, 0.81176f, 0.0000f),
-	ci::Color(1.0000f, 0.74902f, 0.0000f),
-	ci::Color(1.0000f, 0.68627f, 0.0000f),
-	ci::Color(1.0000f, 0.62353f, 0.0000f),
-	ci::Color(1.0000f, 0.56078f, 0.0000f),
-	ci::Color(1.0000f, 0.49804f, 0.0000f),
-	ci::Color(1.0000f, 0.43529f, 0.0000f),
-	ci::Color(1.0000f, 0.37255f, 0.0000f),
-	ci::Color(1.0000f, 0.30980f, 0.0000f),
-	ci::Color(1.0000f, 0.24706f, 0.0000f),
-	ci::Color(1.0000f, 0.18431f, 0.0000f),
-	ci::Color(1.0000f, 0.12157f, 0.0000f),
-	ci::Color(1.0000f, 0.058824f, 0.0000f),
-	ci::Color(1.0000f, 0.0000f, 0.0000f),
-	ci::Color(0.93725f, 0.0000f, 0.0000f),
-	ci::Color(0.87451f, 0.0000f, 0.0000f),
-	ci::Color(0.81176f, 0.0000f, 0.0000f),
-	ci::Color(0.74902f, 0.0000f, 0.0000f),
-	ci::Color(0.68627f, 0.0000f, 0.0000f),
-	ci::Color(0.62353f, 0.0000f, 0.0000f),
-	ci::Color(0.56078f, 0.0000f, 0.0000f),
-	ci::Color(0.49804f, 0.0000f, 0.0000f)
+const std::array<const Color, 64> MatlabJet::palette{{
+	Color(0.0000f, 0.0000f, 0.56078f),
+	Color(0.0000f, 0.0000f, 0.62353f),
+	Color(0.0000f, 0.0000f, 0.68627f),
+	Color(0.0000f, 0.0000f, 0.74902f),
+	Color(0.0000f, 0.0000f, 0.81176f),
+	Color(0.0000f, 0.0000f, 0.87451f),
+	Color(0.0000f, 0.0000f, 0.93725f),
+	Color(0.0000f, 0.0000f, 1.0000f),
+	Color(0.0000f, 0.058824f, 1.0000f),
+	Color(0.0000f, 0.12157f, 1.0000f),
+	Color(0.0000f, 0.18431f, 1.0000f),
+	Color(0.0000f, 0.24706f, 1.0000f),
+	Color(0.0000f, 0.30980f, 1.0000f),
+	Color(0.0000f, 0.37255f, 1.0000f),
+	Color(0.0000f, 0.43529f, 1.0000f),
+	Color(0.0000f, 0.49804f, 1.0000f),
+	Color(0.0000f, 0.56078f, 1.0000f),
+	Color(0.0000f, 0.62353f, 1.0000f),
+	Color(0.0000f, 0.68627f, 1.0000f),
+	Color(0.0000f, 0.74902f, 1.0000f),
+	Color(0.0000f, 0.81176f, 1.0000f),
+	Color(0.0000f, 0.87451f, 1.0000f),
+	Color(0.0000f, 0.93725f, 1.0000f),
+	Color(0.0000f, 1.0000f, 1.0000f),
+	Color(0.058824f, 1.0000f, 0.93725f),
+	Color(0.12157f, 1.0000f, 0.87451f),
+	Color(0.18431f, 1.0000f, 0.81176f),
+	Color(0.24706f, 1.0000f, 0.74902f),
+	Color(0.30980f, 1.0000f, 0.68627f),
+	Color(0.37255f, 1.0000f, 0.62353f),
+	Color(0.43529f, 1.0000f, 0.56078f),
+	Color(0.49804f, 1.0000f, 0.49804f),
+	Color(0.56078f, 1.0000f, 0.43529f),
+	Color(0.62353f, 1.0000f, 0.37255f),
+	Color(0.68627f, 1.0000f, 0.30980f),
+	Color(0.74902f, 1.0000f, 0.24706f),
+	Color(0.81176f, 1.0000f, 0.18431f),
+	Color(0.87451f, 1.0000f, 0.12157f),
+	Color(0.93725f, 1.0000f, 0.058824f),
+	Color(1.0000f, 1.0000f, 0.0000f),
+	Color(1.0000f, 0.93725f, 0.0000f),
+	Color(1.0000f, 0.87451f, 0.0000f),
+	Color(1.0000f, 0.81176f, 0.0000f),
+	Color(1.0000f, 0.74902f, 0.0000f),
+	Color(1.0000f, 0.68627f, 0.0000f),
+	Color(1.0000f, 0.62353f, 0.0000f),
+	Color(1.0000f, 0.56078f, 0.0000f),
+	Color(1.0000f, 0.49804f, 0.0000f),
+	Color(1.0000f, 0.43529f, 0.0000f),
+	Color(1.0000f, 0.37255f, 0.0000f),
+	Color(1.0000f, 0.30980f, 0.0000f),
+	Color(1.0000f, 0.24706f, 0.0000f),
+	Color(1.0000f, 0.18431f, 0.0000f),
+	Color(1.0000f, 0.12157f, 0.0000f),
+	Color(1.0000f, 0.058824f, 0.0000f),
+	Color(1.0000f, 0.0000f, 0.0000f),
+	Color(0.93725f, 0.0000f, 0.0000f),
+	Color(0.87451f, 0.0000f, 0.0000f),
+	Color(0.81176f, 0.0000f, 0.0000f),
+	Color(0.74902f, 0.0000f, 0.0000f),
+	Color(0.68627f, 0.0000f, 0.0000f),
+	Color(0.62353f, 0.0000f, 0.0000f),
+	Color(0.56078f, 0.0000f, 0.0000f),
+	Color(0.49804f, 0.0000f, 0.0000f)
 }};
 
 //! \see http://www.ncl.ucar.edu/Document/Graphics/ColorTables/matlab_hot.shtml
-const std::array<const ci::Color, 64> MatlabHot::palette{{
-	ci::Color(0.039216f, 0.0000f, 0.0000f),
-	ci::Color(0.082353f, 0.0000f, 0.0000f),
-	ci::Color(0.12157f, 0.0000f, 0.0000f),
-	ci::Color(0.16471f, 0.0000f, 0.0000f),
-	ci::Color(0.20784f, 0.0000f, 0.0000f),
-	ci::Color(0.24706f, 0.0000f, 0.0000f),
-	ci::Color(0.29020f, 0.0000f, 0.0000f),
-	ci::Color(0.32941f, 0.0000f, 0.0000f),
-	ci::Color(0.37255f, 0.0000f, 0.0000f),
-	ci::Color(0.41569f, 0.0000f, 0.0000f),
-	ci::Color(0.45490f, 0.0000f, 0.0000f),
-	ci::Color(0.49804f, 0.0000f, 0.0000f),
-	ci::Color(0.54118f, 0.0000f, 0.0000f),
-	ci::Color(0.58039f, 0.0000f, 0.0000f),
-	ci::Color(0.62353f, 0.0000f, 0.0000f),
-	ci::Color(0.66667f, 0.0000f, 0.0000f),
-	ci::Color(0.70588f, 0.0000f, 0.0000f),
-	ci::Color(0.74902f, 0.0000f, 0.0000f),
-	ci::Color(0.78824f, 0.0000f, 0.0000f),
-	ci::Color(0.83137f, 0.0000f, 0.0000f),
-	ci::Color(0.87451f, 0.0000f, 0.0000f),
-	ci::Color(0.91373f, 0.0000f, 0.0000f),
-	ci::Color(0.95686f, 0.0000f, 0.0000f),
-	ci::Color(1.0000f, 0.0000f, 0.0000f),
-	ci::Color(1.0000f, 0.039216f, 0.0000f),
-	ci::Color(1.0000f, 0.082353f, 0.0000f),
-	ci::Color(1.0000f, 0.12157f, 0.0000f),
-	ci::Color(1.0000f, 0.16471f, 0.0000f),
-	ci::Color(1.0000f, 0.20784f, 0.0000f),
-	ci::Color(1.0000f, 0.24706f, 0.0000f),
-	ci::Color(1.0000f, 0.29020f, 0.0000f),
-	ci::Color(1.0000f, 0.32941f, 0.0000f),
-	ci::Color(1.0000f, 0.37255f, 0.0000f),
-	ci::Color(1.0000f, 0.41569f, 0.0000f),
-	ci::Color(1.0000f, 0.45490f, 0.0000f),
-	ci::Color(1.0000f, 0.49804f, 0.0000f),
-	ci::Color(1.0000f, 0.54118f, 0.0000f),
-	ci::Color(1.0000f, 0.58039f, 0.0000f),
-	ci::Color(1.0000f, 0.62353f, 0.0000f),
-	ci::Color(1.0000f, 0.66667f, 0.0000f),
-	ci::Color(1.0000f, 0.70588f, 0.0000f),
-	ci::Color(1.0000f, 0.74902f, 0.0000f),
-	ci::Color(1.0000f, 0.78824f, 0.0000f),
-	ci::Color(1.0000f, 0.83137f, 0.0000f),
-	ci::Color(1.0000f, 0.87451f, 0.0000f),
-	ci::Color(1.0000f, 0.91373f, 0.0000f),
-	ci::Color(1.0000f, 0.95686f, 0.0000f),
-	ci::Color(1.0000f, 1.0000f, 0.0000f),
-	ci::Color(1.0000f, 1.0000f, 0.058824f),
-	ci::Color(1.0000f, 1.0000f, 0.12157f),
-	ci::Color(1.0000f, 1.0000f, 0.18431f),
-	ci::Color(1.0000f, 1.0000f, 0.24706f),
-	ci::Color(1.0000f, 1.0000f, 0.30980f),
-	ci::Color(1.0000f, 1.0000f, 0.37255f),
-	ci::Color(1.0000f, 1.0000f, 0.43529f),
-	ci::Color(1.0000f, 1.0000f, 0.49804f),
-	ci::Color(1.0000f, 1.0000f, 0.56078f),
-	ci::Color(1.0000f, 1.0000f, 0.62353f),
-	ci::Color(1.0000f, 1.0000f, 0.68627f),
-	ci::Color(1.0000f, 1.0000f, 0.74902f),
-	ci::Color(1.0000f, 1.0000f, 0.81176f),
-	ci::Color(1.0000f, 1.0000f, 0.87451f),
-	ci::Color(1.0000f, 1.0000f, 0.93725f),
-	ci::Color(1.0000f, 1.0000f, 1.0000f)
+const std::array<const Color, 64> MatlabHot::palette{{
+	Color(0.039216f, 0.0000f, 0.0000f),
+	Color(0.082353f, 0.0000f, 0.0000f),
+	Color(0.12157f, 0.0000f, 0.0000f),
+	Color(0.16471f, 0.0000f, 0.0000f),
+	Color(0.20784f, 0.0000f, 0.0000f),
+	Color(0.24706f, 0.0000f, 0.0000f),
+	Color(0.29020f, 0.0000f, 0.0000f),
+	Color(0.32941f, 0.0000f, 0.0000f),
+	Color(0.37255f, 0.0000f, 0.0000f),
+	Color(0.41569f, 0.0000f, 0.0000f),
+	Color(0.45490f, 0.0000f, 0.0000f),
+	Color(0.49804f, 0.0000f, 0.0000f),
+	Color(0.54118f, 0.0000f, 0.0000f),
+	Color(0.58039f, 0.0000f, 0.0000f),
+	Color(0.62353f, 0.0000f, 0.0000f),
+	Color(0.66667f, 0.0000f, 0.0000f),
+	Color(0.70588f, 0.0000f, 0.0000f),
+	Color(0.74902f, 0.0000f, 0.0000f),
+	Color(0.78824f, 0.0000f, 0.0000f),
+	Color(0.83137f, 0.0000f, 0.0000f),
+	Color(0.87451f, 0.0000f, 0.0000f),
+	Color(0.91373f, 0.0000f, 0.0000f),
+	Color(0.95686f, 0.0000f, 0.0000f),
+	Color(1.0000f, 0.0000f, 0.0000f),
+	Color(1.0000f, 0.039216f, 0.0000f),
+	Color(1.0000f, 0.082353f, 0.0000f),
+	Color(1.0000f, 0.12157f, 0.0000f),
+	Color(1.0000f, 0.16471f, 0.0000f),
+	Color(1.0000f, 0.20784f, 0.0000f),
+	Color(1.0000f, 0.24706f, 0.0000f),
+	Color(1.0000f, 0.29020f, 0.0000f),
+	Color(1.0000f, 0.32941f, 0.0000f),
+	Color(1.0000f, 0.37255f, 0.0000f),
+	Color(1.0000f, 0.41569f, 0.0000f),
+	Color(1.0000f, 0.45490f, 0.0000f),
+	Color(1.0000f, 0.49804f, 0.0000f),
+	Color(1.0000f, 0.54118f, 0.0000f),
+	Color(1.0000f, 0.58039f, 0.0000f),
+	Color(1.0000f, 0.62353f, 0.0000f),
+	Color(1.0000f, 0.66667f, 0.0000f),
+	Color(1.0000f, 0.70588f, 0.0000f),
+	Color(1.0000f, 0.74902f, 0.0000f),
+	Color(1.0000f, 0.78824f, 0.0000f),
+	Color(1.0000f, 0.83137f, 0.0000f),
+	Color(1.0000f, 0.87451f, 0.0000f),
+	Color(1.0000f, 0.91373f, 0.0000f),
+	Color(1.0000f, 0.95686f, 0.0000f),
+	Color(1.0000f, 1.0000f, 0.0000f),
+	Color(1.0000f, 1.0000f, 0.058824f),
+	Color(1.0000f, 1.0000f, 0.12157f),
+	Color(1.0000f, 1.0000f, 0.18431f),
+	Color(1.0000f, 1.0000f, 0.24706f),
+	Color(1.0000f, 1.0000f, 0.30980f),
+	Color(1.0000f, 1.0000f, 0.37255f),
+	Color(1.0000f, 1.0000f, 0.43529f),
+	Color(1.0000f, 1.0000f, 0.49804f),
+	Color(1.0000f, 1.0000f, 0.56078f),
+	Color(1.0000f, 1.0000f, 0.62353f),
+	Color(1.0000f, 1.0000f, 0.68627f),
+	Color(1.0000f, 1.0000f, 0.74902f),
+	Color(1.0000f, 1.0000f, 0.81176f),
+	Color(1.0000f, 1.0000f, 0.87451f),
+	Color(1.0000f, 1.0000f, 0.93725f),
+	Color(1.0000f, 1.0000f, 1.0000f)
 }};
 
 //! \see http://www.ncl.ucar.edu/Document/Graphics/ColorTables/MPL_summer.shtml
-const std::array<const ci::Color, 128> MPLSummer::palette{{
-	ci::Color(0.003922f, 0.501961f, 0.400000f),
-	ci::Color(0.011765f, 0.505882f, 0.400000f),
-	ci::Color(0.019608f, 0.509804f, 0.400000f),
-	ci::Color(0.027451f, 0.513725f, 0.400000f),
-	ci::Color(0.035294f, 0.517647f, 0.400000f),
-	ci::Color(0.043137f, 0.521569f, 0.400000f),
-	ci::Color(0.050980f, 0.525490f, 0.400000f),
-	ci::Color(0.058824f, 0.529412f, 0.400000f),
-	ci::Color(0.066667f, 0.533333f, 0.400000f),
-	ci::Color(0.070588f, 0.535294f, 0.400000f),
-	ci::Color(0.082353f, 0.541176f, 0.400000f),
-	ci::Color(0.086275f, 0.543137f, 0.400000f),
-	ci::Color(0.098039f, 0.549020f, 0.400000f),
-	ci::Color(0.101961f, 0.550980f, 0.400000f),
-	ci::Color(0.113725f, 0.556863f, 0.400000f),
-	ci::Color(0.117647f, 0.558824f, 0.400000f),
-	ci::Color(0.129412f, 0.564706f, 0.400000f),
-	ci::Color(0.137255f, 0.568627f, 0.400000f),
-	ci::Color(0.141176f, 0.570588f, 0.400000f),
-	ci::Color(0.152941f, 0.576471f, 0.400000f),
-	ci::Color(0.160784f, 0.580392f, 0.400000f),
-	ci::Color(0.168627f, 0.584314f, 0.400000f),
-	ci::Color(0.172549f, 0.586275f, 0.400000f),
-	ci::Color(0.184314f, 0.592157f, 0.400000f),
-	ci::Color(0.192157f, 0.596078f, 0.400000f),
-	ci::Color(0.200000f, 0.600000f, 0.400000f),
-	ci::Color(0.203922f, 0.601961f, 0.400000f),
-	ci::Color(0.215686f, 0.607843f, 0.400000f),
-	ci::Color(0.223529f, 0.611765f, 0.400000f),
-	ci::Color(0.231373f, 0.615686f, 0.400000f),
-	ci::Color(0.235294f, 0.617647f, 0.400000f),
-	ci::Color(0.247059f, 0.623529f, 0.400000f),
-	ci::Color(0.254902f, 0.627451f, 0.400000f),
-	ci::Color(0.262745f, 0.631373f, 0.400000f),
-	ci::Color(0.270588f, 0.635294f, 0.400000f),
-	ci::Color(0.278431f, 0.639216f, 0.400000f),
-	ci::Color(0.286275f, 0.643137f, 0.400000f),
-	ci::Color(0.290196f, 0.645098f, 0.400000f),
-	ci::Color(0.301961f, 0.650980f, 0.400000f),
-	ci::Color(0.309804f, 0.654902f, 0.400000f),
-	ci::Color(0.317647f, 0.658824f, 0.400000f),
-	ci::Color(0.325490f, 0.662745f, 0.400000f),
-	ci::Color(0.333333f, 0.666667f, 0.400000f),
-	ci::Color(0.341176f, 0.670588f, 0.400000f),
-	ci::Color(0.349020f, 0.674510f, 0.400000f),
-	ci::Color(0.352941f, 0.676471f, 0.400000f),
-	ci::Color(0.364706f, 0.682353f, 0.400000f),
-	ci::Color(0.372549f, 0.686275f, 0.400000f),
-	ci::Color(0.380392f, 0.690196f, 0.400000f),
-	ci::Color(0.388235f, 0.694118f, 0.400000f),
-	ci::Color(0.396078f, 0.698039f, 0.400000f),
-	ci::Color(0.403922f, 0.701961f, 0.400000f),
-	ci::Color(0.411765f, 0.705882f, 0.400000f),
-	ci::Color(0.415686f, 0.707843f, 0.400000f),
-	ci::Color(0.427451f, 0.713725f, 0.400000f),
-	ci::Color(0.435294f, 0.717647f, 0.400000f),
-	ci::Color(0.443137f, 0.721569f, 0.400000f),
-	ci::Color(0.450980f, 0.725490f, 0.400000f),
-	ci::Color(0.458824f, 0.729412f, 0.400000f),
-	ci::Color(0.466667f, 0.733333f, 0.400000f),
-	ci::Color(0.474510f, 0.737255f, 0.400000f),
-	ci::Color(0.478431f, 0.739216f, 0.400000f),
-	ci::Color(0.490196f, 0.745098f, 0.400000f),
-	ci::Color(0.498039f, 0.749020f, 0.400000f),
-	ci::Color(0.505882f, 0.752941f, 0.400000f),
-	ci::Color(0.513725f, 0.756863f, 0.400000f),
-	ci::Color(0.521569f, 0.760784f, 0.400000f),
-	ci::Color(0.529412f, 0.764706f, 0.400000f),
-	ci::Color(0.537255f, 0.768627f, 0.400000f),
-	ci::Color(0.545098f, 0.772549f, 0.400000f),
-	ci::Color(0.552941f, 0.776471f, 0.400000f),
-	ci::Color(0.560784f, 0.780392f, 0.400000f),
-	ci::Color(0.568627f, 0.784314f, 0.400000f),
-	ci::Color(0.576471f, 0.788235f, 0.400000f),
-	ci::Color(0.584314f, 0.792157f, 0.400000f),
-	ci::Color(0.588235f, 0.794118f, 0.400000f),
-	ci::Color(0.600000f, 0.800000f, 0.400000f),
-	ci::Color(0.607843f, 0.803922f, 0.400000f),
-	ci::Color(0.615686f, 0.807843f, 0.400000f),
-	ci::Color(0.623529f, 0.811765f, 0.400000f),
-	ci::Color(0.631373f, 0.815686f, 0.400000f),
-	ci::Color(0.639216f, 0.819608f, 0.400000f),
-	ci::Color(0.647059f, 0.823529f, 0.400000f),
-	ci::Color(0.654902f, 0.827451f, 0.400000f),
-	ci::Color(0.662745f, 0.831373f, 0.400000f),
-	ci::Color(0.670588f, 0.835294f, 0.400000f),
-	ci::Color(0.678431f, 0.839216f, 0.400000f),
-	ci::Color(0.686275f, 0.843137f, 0.400000f),
-	ci::Color(0.694118f, 0.847059f, 0.400000f),
-	ci::Color(0.701961f, 0.850980f, 0.400000f),
-	ci::Color(0.709804f, 0.854902f, 0.400000f),
-	ci::Color(0.713725f, 0.856863f, 0.400000f),
-	ci::Color(0.725490f, 0.862745f, 0.400000f),
-	ci::Color(0.733333f, 0.866667f, 0.400000f),
-	ci::Color(0.741176f, 0.870588f, 0.400000f),
-	ci::Color(0.749020f, 0.874510f, 0.400000f),
-	ci::Color(0.756863f, 0.878431f, 0.400000f),
-	ci::Color(0.764706f, 0.882353f, 0.400000f),
-	ci::Color(0.772549f, 0.886275f, 0.400000f),
-	ci::Color(0.780392f, 0.890196f, 0.400000f),
-	ci::Color(0.788235f, 0.894118f, 0.400000f),
-	ci::Color(0.796078f, 0.898039f, 0.400000f),
-	ci::Color(0.803922f, 0.901961f, 0.400000f),
-	ci::Color(0.811765f, 0.905882f, 0.400000f),
-	ci::Color(0.819608f, 0.909804f, 0.400000f),
-	ci::Color(0.827451f, 0.913725f, 0.400000f),
-	ci::Color(0.835294f, 0.917647f, 0.400000f),
-	ci::Color(0.839216f, 0.919608f, 0.400000f),
-	ci::Color(0.850980f, 0.925490f, 0.400000f),
-	ci::Color(0.858824f, 0.929412f, 0.400000f),
-	ci::Color(0.866667f, 0.933333f, 0.400000f),
-	ci::Color(0.874510f, 0.937255f, 0.400000f),
-	ci::Color(0.882353f, 0.941176f, 0.400000f),
-	ci::Color(0.890196f, 0.945098f, 0.400000f),
-	ci::Color(0.898039f, 0.949020f, 0.400000f),
-	ci::Color(0.905882f, 0.952941f, 0.400000f),
-	ci::Color(0.913725f, 0.956863f, 0.400000f),
-	ci::Color(0.921569f, 0.960784f, 0.400000f),
-	ci::Color(0.929412f, 0.964706f, 0.400000f),
-	ci::Color(0.937255f, 0.968627f, 0.400000f),
-	ci::Color(0.945098f, 0.972549f, 0.400000f),
-	ci::Color(0.952941f, 0.976471f, 0.400000f),
-	ci::Color(0.960784f, 0.980392f, 0.400000f),
-	ci::Color(0.964706f, 0.982353f, 0.400000f),
-	ci::Color(0.976471f, 0.988235f, 0.400000f),
-	ci::Color(0.984314f, 0.992157f, 0.400000f),
-	ci::Color(0.992157f, 0.996078f, 0.400000f),
-	ci::Color(1.000000f, 1.000000f, 0.400000f)
+const std::array<const Color, 128> MPLSummer::palette{{
+	Color(0.003922f, 0.501961f, 0.400000f),
+	Color(0.011765f, 0.505882f, 0.400000f),
+	Color(0.019608f, 0.509804f, 0.400000f),
+	Color(0.027451f, 0.513725f, 0.400000f),
+	Color(0.035294f, 0.517647f, 0.400000f),
+	Color(0.043137f, 0.521569f, 0.400000f),
+	Color(0.050980f, 0.525490f, 0.400000f),
+	Color(0.058824f, 0.529412f, 0.400000f),
+	Color(0.066667f, 0.533333f, 0.400000f),
+	Color(0.070588f, 0.535294f, 0.400000f),
+	Color(0.082353f, 0.541176f, 0.400000f),
+	Color(0.086275f, 0.543137f, 0.400000f),
+	Color(0.098039f, 0.549020f, 0.400000f),
+	Color(0.101961f, 0.550980f, 0.400000f),
+	Color(0.113725f, 0.556863f, 0.400000f),
+	Color(0.117647f, 0.558824f, 0.400000f),
+	Color(0.129412f, 0.564706f, 0.400000f),
+	Color(0.137255f, 0.568627f, 0.400000f),
+	Color(0.141176f, 0.570588f, 0.400000f),
+	Color(0.152941f, 0.576471f, 0.400000f),
+	Color(0.160784f, 0.580392f, 0.400000f),
+	Color(0.168627f, 0.584314f, 0.400000f),
+	Color(0.172549f, 0.586275f, 0.400000f),
+	Color(0.184314f, 0.592157f, 0.400000f),
+	Color(0.192157f, 0.596078f, 0.400000f),
+	Color(0.200000f, 0.600000f, 0.400000f),
+	Color(0.203922f, 0.601961f, 0.400000f),
+	Color(0.215686f, 0.607843f, 0.400000f),
+	Color(0.223529f, 0.611765f, 0.400000f),
+	Color(0.231373f, 0.615686f, 0.400000f),
+	Color(0.235294f, 0.617647f, 0.400000f),
+	Color(0.247059f, 0.623529f, 0.400000f),
+	Color(0.254902f, 0.627451f, 0.400000f),
+	Color(0.262745f, 0.631373f, 0.400000f),
+	Color(0.270588f, 0.635294f, 0.400000f),
+	Color(0.278431f, 0.639216f, 0.400000f),
+	Color(0.286275f, 0.643137f, 0.400000f),
+	Color(0.290196f, 0.645098f, 0.400000f),
+	Color(0.301961f, 0.650980f, 0.400000f),
+	Color(0.309804f, 0.654902f, 0.400000f),
+	Color(0.317647f, 0.658824f, 0.400000f),
+	Color(0.325490f, 0.662745f, 0.400000f),
+	Color(0.333333f, 0.666667f, 0.400000f),
+	Color(0.341176f, 0.670588f, 0.400000f),
+	Color(0.349020f, 0.674510f, 0.400000f),
+	Color(0.352941f, 0.676471f, 0.400000f),
+	Color(0.364706f, 0.682353f, 0.400000f),
+	Color(0.372549f, 0.686275f, 0.400000f),
+	Color(0.380392f, 0.690196f, 0.400000f),
+	Color(0.388235f, 0.694118f, 0.400000f),
+	Color(0.396078f, 0.698039f, 0.400000f),
+	Color(0.403922f, 0.701961f, 0.400000f),
+	Color(0.411765f, 0.705882f, 0.400000f),
+	Color(0.415686f, 0.707843f, 0.400000f),
+	Color(0.427451f, 0.713725f, 0.400000f),
+	Color(0.435294f, 0.717647f, 0.400000f),
+	Color(0.443137f, 0.721569f, 0.400000f),
+	Color(0.450980f, 0.725490f, 0.400000f),
+	Color(0.458824f, 0.729412f, 0.400000f),
+	Color(0.466667f, 0.733333f, 0.400000f),
+	Color(0.474510f, 0.737255f, 0.400000f),
+	Color(0.478431f, 0.739216f, 0.400000f),
+	Color(0.490196f, 0.745098f, 0.400000f),
+	Color(0.498039f, 0.749020f, 0.400000f),
+	Color(0.505882f, 0.752941f, 0.400000f),
+	Color(0.513725f, 0.756863f, 0.400000f),
+	Color(0.521569f, 0.760784f, 0.400000f),
+	Color(0.529412f, 0.764706f, 0.400000f),
+	Color(0.537255f, 0.768627f, 0.400000f),
+	Color(0.545098f, 0.772549f, 0.400000f),
+	Color(0.552941f, 0.776471f, 0.400000f),
+	Color(0.560784f, 0.780392f, 0.400000f),
+	Color(0.568627f, 0.784314f, 0.400000f),
+	Color(0.576471f, 0.788235f, 0.400000f),
+	Color(0.584314f, 0.792157f, 0.400000f),
+	Color(0.588235f, 0.794118f, 0.400000f),
+	Color(0.600000f, 0.800000f, 0.400000f),
+	Color(0.607843f, 0.803922f, 0.400000f),
+	Color(0.615686f, 0.807843f, 0.400000f),
+	Color(0.623529f, 0.811765f, 0.400000f),
+	Color(0.631373f, 0.815686f, 0.400000f),
+	Color(0.639216f, 0.819608f, 0.400000f),
+	Color(0.647059f, 0.823529f, 0.400000f),
+	Color(0.654902f, 0.827451f, 0.400000f),
+	Color(0.662745f, 0.831373f, 0.400000f),
+	Color(0.670588f, 0.835294f, 0.400000f),
+	Color(0.678431f, 0.839216f, 0.400000f),
+	Color(0.686275f, 0.843137f, 0.400000f),
+	Color(0.694118f, 0.847059f, 0.400000f),
+	Color(0.701961f, 0.850980f, 0.400000f),
+	Color(0.709804f, 0.854902f, 0.400000f),
+	Color(0.713725f, 0.856863f, 0.400000f),
+	Color(0.725490f, 0.862745f, 0.400000f),
+	Color(0.733333f, 0.866667f, 0.400000f),
+	Color(0.741176f, 0.870588f, 0.400000f),
+	Color(0.749020f, 0.874510f, 0.400000f),
+	Color(0.756863f, 0.878431f, 0.400000f),
+	Color(0.764706f, 0.882353f, 0.400000f),
+	Color(0.772549f, 0.886275f, 0.400000f),
+	Color(0.780392f, 0.890196f, 0.400000f),
+	Color(0.788235f, 0.894118f, 0.400000f),
+	Color(0.796078f, 0.898039f, 0.400000f),
+	Color(0.803922f, 0.901961f, 0.400000f),
+	Color(0.811765f, 0.905882f, 0.400000f),
+	Color(0.819608f, 0.909804f, 0.400000f),
+	Color(0.827451f, 0.913725f, 0.400000f),
+	Color(0.835294f, 0.917647f, 0.400000f),
+	Color(0.839216f, 0.919608f, 0.400000f),
+	Color(0.850980f, 0.925490f, 0.400000f),
+	Color(0.858824f, 0.929412f, 0.400000f),
+	Color(0.866667f, 0.933333f, 0.400000f),
+	Color(0.874510f, 0.937255f, 0.400000f),
+	Color(0.882353f, 0.941176f, 0.400000f),
+	Color(0.890196f, 0.945098f, 0.400000f),
+	Color(0.898039f, 0.949020f, 0.400000f),
+	Color(0.905882f, 0.952941f, 0.400000f),
+	Color(0.913725f, 0.956863f, 0.400000f),
+	Color(0.921569f, 0.960784f, 0.400000f),
+	Color(0.929412f, 0.964706f, 0.400000f),
+	Color(0.937255f, 0.968627f, 0.400000f),
+	Color(0.945098f, 0.972549f, 0.400000f),
+	Color(0.952941f, 0.976471f, 0.400000f),
+	Color(0.960784f, 0.980392f, 0.400000f),
+	Color(0.964706f, 0.982353f, 0.400000f),
+	Color(0.976471f, 0.988235f, 0.400000f),
+	Color(0.984314f, 0.992157f, 0.400000f),
+	Color(0.992157f, 0.996078f, 0.400000f),
+	Color(1.000000f, 1.000000f, 0.400000f)
 }};
 
 //! \see http://www.ncl.ucar.edu/Document/Graphics/ColorTables/MPL_Paired.shtml
-const std::array<const ci::Color, 128> MPLPaired::palette{{
-	ci::Color(0.628143f, 0.793295f, 0.882245f),
-	ci::Color(0.582468f, 0.764198f, 0.866344f),
-	ci::Color(0.536794f, 0.735102f, 0.850442f),
-	ci::Color(0.491119f, 0.706005f, 0.834541f),
-	ci::Color(0.445444f, 0.676909f, 0.818639f),
-	ci::Color(0.399769f, 0.647812f, 0.802737f),
-	ci::Color(0.354095f, 0.618716f, 0.786836f),
-	ci::Color(0.308420f, 0.589619f, 0.770934f),
-	ci::Color(0.262745f, 0.560523f, 0.755033f),
-	ci::Color(0.239908f, 0.545975f, 0.747082f),
-	ci::Color(0.171396f, 0.502330f, 0.723230f),
-	ci::Color(0.148558f, 0.487782f, 0.715279f),
-	ci::Color(0.166782f, 0.502268f, 0.692964f),
-	ci::Color(0.191649f, 0.519692f, 0.685859f),
-	ci::Color(0.266251f, 0.571965f, 0.664544f),
-	ci::Color(0.291119f, 0.589389f, 0.657439f),
-	ci::Color(0.365721f, 0.641661f, 0.636125f),
-	ci::Color(0.415456f, 0.676509f, 0.621915f),
-	ci::Color(0.440323f, 0.693933f, 0.614810f),
-	ci::Color(0.514925f, 0.746205f, 0.593495f),
-	ci::Color(0.564660f, 0.781053f, 0.579285f),
-	ci::Color(0.614394f, 0.815902f, 0.565075f),
-	ci::Color(0.639262f, 0.833326f, 0.557970f),
-	ci::Color(0.684368f, 0.867728f, 0.531057f),
-	ci::Color(0.641399f, 0.846413f, 0.499254f),
-	ci::Color(0.598431f, 0.825098f, 0.467451f),
-	ci::Color(0.576947f, 0.814441f, 0.451549f),
-	ci::Color(0.512495f, 0.782468f, 0.403845f),
-	ci::Color(0.469527f, 0.761153f, 0.372042f),
-	ci::Color(0.426559f, 0.739839f, 0.340238f),
-	ci::Color(0.405075f, 0.729181f, 0.324337f),
-	ci::Color(0.340623f, 0.697209f, 0.276632f),
-	ci::Color(0.297655f, 0.675894f, 0.244829f),
-	ci::Color(0.254687f, 0.654579f, 0.213026f),
-	ci::Color(0.211719f, 0.633264f, 0.181223f),
-	ci::Color(0.249212f, 0.625975f, 0.199369f),
-	ci::Color(0.316878f, 0.623945f, 0.236248f),
-	ci::Color(0.350711f, 0.622930f, 0.254687f),
-	ci::Color(0.452211f, 0.619885f, 0.310004f),
-	ci::Color(0.519877f, 0.617855f, 0.346882f),
-	ci::Color(0.587543f, 0.615825f, 0.383760f),
-	ci::Color(0.655210f, 0.613795f, 0.420638f),
-	ci::Color(0.722876f, 0.611765f, 0.457516f),
-	ci::Color(0.790542f, 0.609735f, 0.494394f),
-	ci::Color(0.858208f, 0.607705f, 0.531273f),
-	ci::Color(0.892042f, 0.606690f, 0.549712f),
-	ci::Color(0.983206f, 0.598016f, 0.594233f),
-	ci::Color(0.975087f, 0.554710f, 0.551942f),
-	ci::Color(0.966967f, 0.511403f, 0.509650f),
-	ci::Color(0.958847f, 0.468097f, 0.467359f),
-	ci::Color(0.950727f, 0.424790f, 0.425067f),
-	ci::Color(0.942607f, 0.381484f, 0.382776f),
-	ci::Color(0.934487f, 0.338178f, 0.340484f),
-	ci::Color(0.930427f, 0.316524f, 0.319339f),
-	ci::Color(0.918247f, 0.251565f, 0.255902f),
-	ci::Color(0.910127f, 0.208258f, 0.213610f),
-	ci::Color(0.902007f, 0.164952f, 0.171319f),
-	ci::Color(0.893887f, 0.121646f, 0.129027f),
-	ci::Color(0.894994f, 0.132411f, 0.125121f),
-	ci::Color(0.903791f, 0.188235f, 0.153203f),
-	ci::Color(0.912587f, 0.244060f, 0.181284f),
-	ci::Color(0.916986f, 0.271972f, 0.195325f),
-	ci::Color(0.930181f, 0.355709f, 0.237447f),
-	ci::Color(0.938977f, 0.411534f, 0.265529f),
-	ci::Color(0.947774f, 0.467359f, 0.293610f),
-	ci::Color(0.956571f, 0.523183f, 0.321692f),
-	ci::Color(0.965367f, 0.579008f, 0.349773f),
-	ci::Color(0.974164f, 0.634833f, 0.377855f),
-	ci::Color(0.982960f, 0.690657f, 0.405936f),
-	ci::Color(0.991757f, 0.746482f, 0.434018f),
-	ci::Color(0.992803f, 0.728351f, 0.399446f),
-	ci::Color(0.993479f, 0.706697f, 0.361892f),
-	ci::Color(0.994156f, 0.685044f, 0.324337f),
-	ci::Color(0.994833f, 0.663391f, 0.286782f),
-	ci::Color(0.995509f, 0.641738f, 0.249227f),
-	ci::Color(0.995848f, 0.630911f, 0.230450f),
-	ci::Color(0.996863f, 0.598431f, 0.174118f),
-	ci::Color(0.997539f, 0.576778f, 0.136563f),
-	ci::Color(0.998216f, 0.555125f, 0.099008f),
-	ci::Color(0.998893f, 0.533472f, 0.061453f),
-	ci::Color(0.999569f, 0.511819f, 0.023899f),
-	ci::Color(0.993479f, 0.504314f, 0.026328f),
-	ci::Color(0.975548f, 0.521569f, 0.098731f),
-	ci::Color(0.957616f, 0.538824f, 0.171134f),
-	ci::Color(0.939685f, 0.556078f, 0.243537f),
-	ci::Color(0.921753f, 0.573333f, 0.315940f),
-	ci::Color(0.903822f, 0.590588f, 0.388343f),
-	ci::Color(0.885890f, 0.607843f, 0.460746f),
-	ci::Color(0.867958f, 0.625098f, 0.533149f),
-	ci::Color(0.850027f, 0.642353f, 0.605552f),
-	ci::Color(0.832095f, 0.659608f, 0.677955f),
-	ci::Color(0.823130f, 0.668235f, 0.714156f),
-	ci::Color(0.796232f, 0.694118f, 0.822760f),
-	ci::Color(0.767059f, 0.667451f, 0.823529f),
-	ci::Color(0.734579f, 0.627866f, 0.803230f),
-	ci::Color(0.702099f, 0.588281f, 0.782930f),
-	ci::Color(0.669619f, 0.548697f, 0.762630f),
-	ci::Color(0.637140f, 0.509112f, 0.742330f),
-	ci::Color(0.604660f, 0.469527f, 0.722030f),
-	ci::Color(0.572180f, 0.429942f, 0.701730f),
-	ci::Color(0.539700f, 0.390358f, 0.681430f),
-	ci::Color(0.507220f, 0.350773f, 0.661130f),
-	ci::Color(0.474740f, 0.311188f, 0.640830f),
-	ci::Color(0.442261f, 0.271603f, 0.620531f),
-	ci::Color(0.424852f, 0.251150f, 0.603860f),
-	ci::Color(0.475263f, 0.316786f, 0.603522f),
-	ci::Color(0.525675f, 0.382422f, 0.603183f),
-	ci::Color(0.550880f, 0.415240f, 0.603014f),
-	ci::Color(0.626498f, 0.513695f, 0.602507f),
-	ci::Color(0.676909f, 0.579331f, 0.602168f),
-	ci::Color(0.727320f, 0.644967f, 0.601830f),
-	ci::Color(0.777732f, 0.710604f, 0.601492f),
-	ci::Color(0.828143f, 0.776240f, 0.601153f),
-	ci::Color(0.878554f, 0.841876f, 0.600815f),
-	ci::Color(0.928966f, 0.907512f, 0.600477f),
-	ci::Color(0.979377f, 0.973149f, 0.600138f),
-	ci::Color(0.984406f, 0.966813f, 0.577409f),
-	ci::Color(0.958016f, 0.910650f, 0.539177f),
-	ci::Color(0.931626f, 0.854487f, 0.500946f),
-	ci::Color(0.905236f, 0.798324f, 0.462714f),
-	ci::Color(0.878847f, 0.742161f, 0.424483f),
-	ci::Color(0.852457f, 0.685998f, 0.386251f),
-	ci::Color(0.826067f, 0.629835f, 0.348020f),
-	ci::Color(0.812872f, 0.601753f, 0.328904f),
-	ci::Color(0.773287f, 0.517509f, 0.271557f),
-	ci::Color(0.746897f, 0.461346f, 0.233326f),
-	ci::Color(0.720508f, 0.405183f, 0.195094f),
-	ci::Color(0.694118f, 0.349020f, 0.156863f)
+const std::array<const Color, 128> MPLPaired::palette{{
+	Color(0.628143f, 0.793295f, 0.882245f),
+	Color(0.582468f, 0.764198f, 0.866344f),
+	Color(0.536794f, 0.735102f, 0.850442f),
+	Color(0.491119f, 0.706005f, 0.834541f),
+	Color(0.445444f, 0.676909f, 0.818639f),
+	Color(0.399769f, 0.647812f, 0.802737f),
+	Color(0.354095f, 0.618716f, 0.786836f),
+	Color(0.308420f, 0.589619f, 0.770934f),
+	Color(0.262745f, 0.560523f, 0.755033f),
+	Color(0.239908f, 0.545975f, 0.747082f),
+	Color(0.171396f, 0.502330f, 0.723230f),
+	Color(0.148558f, 0.487782f, 0.715279f),
+	Color(0.166782f, 0.502268f, 0.692964f),
+	Color(0.191649f, 0.519692f, 0.685859f),
+	Color(0.266251f, 0.571965f, 0.664544f),
+	Color(0.291119f, 0.589389f, 0.657439f),
+	Color(0.365721f, 0.641661f, 0.636125f),
+	Color(0.415456f, 0.676509f, 0.621915f),
+	Color(0.440323f, 0.693933f, 0.614810f),
+	Color(0.514925f, 0.746205f, 0.593495f),
+	Color(0.564660f, 0.781053f, 0.579285f),
+	Color(0.614394f, 0.815902f, 0.565075f),
+	Color(0.639262f, 0.833326f, 0.557970f),
+	Color(0.684368f, 0.867728f, 0.531057f),
+	Color(0.641399f, 0.846413f, 0.499254f),
+	Color(0.598431f, 0.825098f, 0.467451f),
+	Color(0.576947f, 0.814441f, 0.451549f),
+	Color(0.512495f, 0.782468f, 0.403845f),
+	Color(0.469527f, 0.761153f, 0.372042f),
+	Color(0.426559f, 0.739839f, 0.340238f),
+	Color(0.405075f, 0.729181f, 0.324337f),
+	Color(0.340623f, 0.697209f, 0.276632f),
+	Color(0.297655f, 0.675894f, 0.244829f),
+	Color(0.254687f, 0.654579f, 0.213026f),
+	Color(0.211719f, 0.633264f, 0.181223f),
+	Color(0.249212f, 0.625975f, 0.199369f),
+	Color(0.316878f, 0.623945f, 0.236248f),
+	Color(0.350711f, 0.622930f, 0.254687f),
+	Color(0.452211f, 0.619885f, 0.310004f),
+	Color(0.519877f, 0.617855f, 0.346882f),
+	Color(0.587543f, 0.615825f, 0.383760f),
+	Color(0.655210f, 0.613795f, 0.420638f),
+	Color(0.722876f, 0.611765f, 0.457516f),
+	Color(0.790542f, 0.609735f, 0.494394f),
+	Color(0.858208f, 0.607705f, 0.531273f),
+	Color(0.892042f, 0.606690f, 0.549712f),
+	Color(0.983206f, 0.598016f, 0.594233f),
+	Color(0.975087f, 0.554710f, 0.551942f),
+	Color(0.966967f, 0.511403f, 0.509650f),
+	Color(0.958847f, 0.468097f, 0.467359f),
+	Color(0.950727f, 0.424790f, 0.425067f),
+	Color(0.942607f, 0.381484f, 0.382776f),
+	Color(0.934487f, 0.338178f, 0.340484f),
+	Color(0.930427f, 0.316524f, 0.319339f),
+	Color(0.918247f, 0.251565f, 0.255902f),
+	Color(0.910127f, 0.208258f, 0.213610f),
+	Color(0.902007f, 0.164952f, 0.171319f),
+	Color(0.893887f, 0.121646f, 0.129027f),
+	Color(0.894994f, 0.132411f, 0.125121f),
+	Color(0.903791f, 0.188235f, 0.153203f),
+	Color(0.912587f, 0.244060f, 0.181284f),
+	Color(0.916986f, 0.271972f, 0.195325f),
+	Color(0.930181f, 0.355709f, 0.237447f),
+	Color(0.938977f, 0.411534f, 0.265529f),
+	Color(0.947774f, 0.467359f, 0.293610f),
+	Color(0.956571f, 0.523183f, 0.321692f),
+	Color(0.965367f, 0.579008f, 0.349773f),
+	Color(0.974164f, 0.634833f, 0.377855f),
+	Color(0.982960f, 0.690657f, 0.405936f),
+	Color(0.991757f, 0.746482f, 0.434018f),
+	Color(0.992803f, 0.728351f, 0.399446f),
+	Color(0.993479f, 0.706697f, 0.361892f),
+	Color(0.994156f, 0.685044f, 0.324337f),
+	Color(0.994833f, 0.663391f, 0.286782f),
+	Color(0.995509f, 0.641738f, 0.249227f),
+	Color(0.995848f, 0.630911f, 0.230450f),
+	Color(0.996863f, 0.598431f, 0.174118f),
+	Color(0.997539f, 0.576778f, 0.136563f),
+	Color(0.998216f, 0.555125f, 0.099008f),
+	Color(0.998893f, 0.533472f, 0.061453f),
+	Color(0.999569f, 0.511819f, 0.023899f),
+	Color(0.993479f, 0.504314f, 0.026328f),
+	Color(0.975548f, 0.521569f, 0.098731f),
+	Color(0.957616f, 0.538824f, 0.171134f),
+	Color(0.939685f, 0.556078f, 0.243537f),
+	Color(0.921753f, 0.573333f, 0.315940f),
+	Color(0.903822f, 0.590588f, 0.388343f),
+	Color(0.885890f, 0.607843f, 0.460746f),
+	Color(0.867958f, 0.625098f, 0.533149f),
+	Color(0.850027f, 0.642353f, 0.605552f),
+	Color(0.832095f, 0.659608f, 0.677955f),
+	Color(0.823130f, 0.668235f, 0.714156f),
+	Color(0.796232f, 0.694118f, 0.822760f),
+	Color(0.767059f, 0.667451f, 0.823529f),
+	Color(0.734579f, 0.627866f, 0.803230f),
+	Color(0.702099f, 0.588281f, 0.782930f),
+	Color(0.669619f, 0.548697f, 0.762630f),
+	Color(0.637140f, 0.509112f, 0.742330f),
+	Color(0.604660f, 0.469527f, 0.722030f),
+	Color(0.572180f, 0.429942f, 0.701730f),
+	Color(0.539700f, 0.390358f, 0.681430f),
+	Color(0.507220f, 0.350773f, 0.661130f),
+	Color(0.474740f, 0.311188f, 0.640830f),
+	Color(0.442261f, 0.271603f, 0.620531f),
+	Color(0.424852f, 0.251150f, 0.603860f),
+	Color(0.475263f, 0.316786f, 0.603522f),
+	Color(0.525675f, 0.382422f, 0.603183f),
+	Color(0.550880f, 0.415240f, 0.603014f),
+	Color(0.626498f, 0.513695f, 0.602507f),
+	Color(0.676909f, 0.579331f, 0.602168f),
+	Color(0.727320f, 0.644967f, 0.601830f),
+	Color(0.777732f, 0.710604f, 0.601492f),
+	Color(0.828143f, 0.776240f, 0.601153f),
+	Color(0.878554f, 0.841876f, 0.600815f),
+	Color(0.928966f, 0.907512f, 0.600477f),
+	Color(0.979377f, 0.973149f, 0.600138f),
+	Color(0.984406f, 0.966813f, 0.577409f),
+	Color(0.958016f, 0.910650f, 0.539177f),
+	Color(0.931626f, 0.854487f, 0.500946f),
+	Color(0.905236f, 0.798324f, 0.462714f),
+	Color(0.878847f, 0.742161f, 0.424483f),
+	Color(0.852457f, 0.685998f, 0.386251f),
+	Color(0.826067f, 0.629835f, 0.348020f),
+	Color(0.812872f, 0.601753f, 0.328904f),
+	Color(0.773287f, 0.517509f, 0.271557f),
+	Color(0.746897f, 0.461346f, 0.233326f),
+	Color(0.720508f, 0.405183f, 0.195094f),
+	Color(0.694118f, 0.349020f, 0.156863f)
 }};
 
 //! \see http://www.ncl.ucar.edu/Document/Graphics/ColorTables/MPL_ocean.shtml
-const std::array<const ci::Color, 128> MPLOcean::palette{{
-	ci::Color(0.000000f, 0.494118f, 0.003922f),
-	ci::Color(0.000000f, 0.482353f, 0.011765f),
-	ci::Color(0.000000f, 0.470588f, 0.019608f),
-	ci::Color(0.000000f, 0.458824f, 0.027451f),
-	ci::Color(0.000000f, 0.447059f, 0.035294f),
-	ci::Color(0.000000f, 0.435294f, 0.043137f),
-	ci::Color(0.000000f, 0.423529f, 0.050980f),
-	ci::Color(0.000000f, 0.411765f, 0.058824f),
-	ci::Color(0.000000f, 0.400000f, 0.066667f),
-	ci::Color(0.000000f, 0.394118f, 0.070588f),
-	ci::Color(0.000000f, 0.376471f, 0.082353f),
-	ci::Color(0.000000f, 0.370588f, 0.086275f),
-	ci::Color(0.000000f, 0.352941f, 0.098039f),
-	ci::Color(0.000000f, 0.347059f, 0.101961f),
-	ci::Color(0.000000f, 0.329412f, 0.113725f),
-	ci::Color(0.000000f, 0.323529f, 0.117647f),
-	ci::Color(0.000000f, 0.305882f, 0.129412f),
-	ci::Color(0.000000f, 0.294118f, 0.137255f),
-	ci::Color(0.000000f, 0.288235f, 0.141176f),
-	ci::Color(0.000000f, 0.270588f, 0.152941f),
-	ci::Color(0.000000f, 0.258824f, 0.160784f),
-	ci::Color(0.000000f, 0.247059f, 0.168627f),
-	ci::Color(0.000000f, 0.241176f, 0.172549f),
-	ci::Color(0.000000f, 0.223529f, 0.184314f),
-	ci::Color(0.000000f, 0.211765f, 0.192157f),
-	ci::Color(0.000000f, 0.200000f, 0.200000f),
-	ci::Color(0.000000f, 0.194118f, 0.203922f),
-	ci::Color(0.000000f, 0.176471f, 0.215686f),
-	ci::Color(0.000000f, 0.164706f, 0.223529f),
-	ci::Color(0.000000f, 0.152941f, 0.231373f),
-	ci::Color(0.000000f, 0.147059f, 0.235294f),
-	ci::Color(0.000000f, 0.129412f, 0.247059f),
-	ci::Color(0.000000f, 0.117647f, 0.254902f),
-	ci::Color(0.000000f, 0.105882f, 0.262745f),
-	ci::Color(0.000000f, 0.094118f, 0.270588f),
-	ci::Color(0.000000f, 0.082353f, 0.278431f),
-	ci::Color(0.000000f, 0.070588f, 0.286275f),
-	ci::Color(0.000000f, 0.064706f, 0.290196f),
-	ci::Color(0.000000f, 0.047059f, 0.301961f),
-	ci::Color(0.000000f, 0.035294f, 0.309804f),
-	ci::Color(0.000000f, 0.023529f, 0.317647f),
-	ci::Color(0.000000f, 0.011765f, 0.325490f),
-	ci::Color(0.000000f, 0.000000f, 0.333333f),
-	ci::Color(0.000000f, 0.011765f, 0.341176f),
-	ci::Color(0.000000f, 0.023529f, 0.349020f),
-	ci::Color(0.000000f, 0.029412f, 0.352941f),
-	ci::Color(0.000000f, 0.047059f, 0.364706f),
-	ci::Color(0.000000f, 0.058824f, 0.372549f),
-	ci::Color(0.000000f, 0.070588f, 0.380392f),
-	ci::Color(0.000000f, 0.082353f, 0.388235f),
-	ci::Color(0.000000f, 0.094118f, 0.396078f),
-	ci::Color(0.000000f, 0.105882f, 0.403922f),
-	ci::Color(0.000000f, 0.117647f, 0.411765f),
-	ci::Color(0.000000f, 0.123529f, 0.415686f),
-	ci::Color(0.000000f, 0.141176f, 0.427451f),
-	ci::Color(0.000000f, 0.152941f, 0.435294f),
-	ci::Color(0.000000f, 0.164706f, 0.443137f),
-	ci::Color(0.000000f, 0.176471f, 0.450980f),
-	ci::Color(0.000000f, 0.188235f, 0.458824f),
-	ci::Color(0.000000f, 0.200000f, 0.466667f),
-	ci::Color(0.000000f, 0.211765f, 0.474510f),
-	ci::Color(0.000000f, 0.217647f, 0.478431f),
-	ci::Color(0.000000f, 0.235294f, 0.490196f),
-	ci::Color(0.000000f, 0.247059f, 0.498039f),
-	ci::Color(0.000000f, 0.258824f, 0.505882f),
-	ci::Color(0.000000f, 0.270588f, 0.513725f),
-	ci::Color(0.000000f, 0.282353f, 0.521569f),
-	ci::Color(0.000000f, 0.294118f, 0.529412f),
-	ci::Color(0.000000f, 0.305882f, 0.537255f),
-	ci::Color(0.000000f, 0.317647f, 0.545098f),
-	ci::Color(0.000000f, 0.329412f, 0.552941f),
-	ci::Color(0.000000f, 0.341176f, 0.560784f),
-	ci::Color(0.000000f, 0.352941f, 0.568627f),
-	ci::Color(0.000000f, 0.364706f, 0.576471f),
-	ci::Color(0.000000f, 0.376471f, 0.584314f),
-	ci::Color(0.000000f, 0.382353f, 0.588235f),
-	ci::Color(0.000000f, 0.400000f, 0.600000f),
-	ci::Color(0.000000f, 0.411765f, 0.607843f),
-	ci::Color(0.000000f, 0.423529f, 0.615686f),
-	ci::Color(0.000000f, 0.435294f, 0.623529f),
-	ci::Color(0.000000f, 0.447059f, 0.631373f),
-	ci::Color(0.000000f, 0.458824f, 0.639216f),
-	ci::Color(0.000000f, 0.470588f, 0.647059f),
-	ci::Color(0.000000f, 0.482353f, 0.654902f),
-	ci::Color(0.000000f, 0.494118f, 0.662745f),
-	ci::Color(0.011765f, 0.505882f, 0.670588f),
-	ci::Color(0.035294f, 0.517647f, 0.678431f),
-	ci::Color(0.058824f, 0.529412f, 0.686275f),
-	ci::Color(0.082353f, 0.541176f, 0.694118f),
-	ci::Color(0.105882f, 0.552941f, 0.701961f),
-	ci::Color(0.129412f, 0.564706f, 0.709804f),
-	ci::Color(0.141176f, 0.570588f, 0.713725f),
-	ci::Color(0.176471f, 0.588235f, 0.725490f),
-	ci::Color(0.200000f, 0.600000f, 0.733333f),
-	ci::Color(0.223529f, 0.611765f, 0.741176f),
-	ci::Color(0.247059f, 0.623529f, 0.749020f),
-	ci::Color(0.270588f, 0.635294f, 0.756863f),
-	ci::Color(0.294118f, 0.647059f, 0.764706f),
-	ci::Color(0.317647f, 0.658824f, 0.772549f),
-	ci::Color(0.341176f, 0.670588f, 0.780392f),
-	ci::Color(0.364706f, 0.682353f, 0.788235f),
-	ci::Color(0.388235f, 0.694118f, 0.796078f),
-	ci::Color(0.411765f, 0.705882f, 0.803922f),
-	ci::Color(0.435294f, 0.717647f, 0.811765f),
-	ci::Color(0.458824f, 0.729412f, 0.819608f),
-	ci::Color(0.482353f, 0.741176f, 0.827451f),
-	ci::Color(0.505882f, 0.752941f, 0.835294f),
-	ci::Color(0.517647f, 0.758824f, 0.839216f),
-	ci::Color(0.552941f, 0.776471f, 0.850980f),
-	ci::Color(0.576471f, 0.788235f, 0.858824f),
-	ci::Color(0.600000f, 0.800000f, 0.866667f),
-	ci::Color(0.623529f, 0.811765f, 0.874510f),
-	ci::Color(0.647059f, 0.823529f, 0.882353f),
-	ci::Color(0.670588f, 0.835294f, 0.890196f),
-	ci::Color(0.694118f, 0.847059f, 0.898039f),
-	ci::Color(0.717647f, 0.858824f, 0.905882f),
-	ci::Color(0.741176f, 0.870588f, 0.913725f),
-	ci::Color(0.764706f, 0.882353f, 0.921569f),
-	ci::Color(0.788235f, 0.894118f, 0.929412f),
-	ci::Color(0.811765f, 0.905882f, 0.937255f),
-	ci::Color(0.835294f, 0.917647f, 0.945098f),
-	ci::Color(0.858824f, 0.929412f, 0.952941f),
-	ci::Color(0.882353f, 0.941176f, 0.960784f),
-	ci::Color(0.894118f, 0.947059f, 0.964706f),
-	ci::Color(0.929412f, 0.964706f, 0.976471f),
-	ci::Color(0.952941f, 0.976471f, 0.984314f),
-	ci::Color(0.976471f, 0.988235f, 0.992157f),
-	ci::Color(1.000000f, 1.000000f, 1.000000f)
+const std::array<const Color, 128> MPLOcean::palette{{
+	Color(0.000000f, 0.494118f, 0.003922f),
+	Color(0.000000f, 0.482353f, 0.011765f),
+	Color(0.000000f, 0.470588f, 0.019608f),
+	Color(0.000000f, 0.458824f, 0.027451f),
+	Color(0.000000f, 0.447059f, 0.035294f),
+	Color(0.000000f, 0.435294f, 0.043137f),
+	Color(0.000000f, 0.423529f, 0.050980f),
+	Color(0.000000f, 0.411765f, 0.058824f),
+	Color(0.000000f, 0.400000f, 0.066667f),
+	Color(0.000000f, 0.394118f, 0.070588f),
+	Color(0.000000f, 0.376471f, 0.082353f),
+	Color(0.000000f, 0.370588f, 0.086275f),
+	Color(0.000000f, 0.352941f, 0.098039f),
+	Color(0.000000f, 0.347059f, 0.101961f),
+	Color(0.000000f, 0.329412f, 0.113725f),
+	Color(0.000000f, 0.323529f, 0.117647f),
+	Color(0.000000f, 0.305882f, 0.129412f),
+	Color(0.000000f, 0.294118f, 0.137255f),
+	Color(0.000000f, 0.288235f, 0.141176f),
+	Color(0.000000f, 0.270588f, 0.152941f),
+	Color(0.000000f, 0.258824f, 0.160784f),
+	Color(0.000000f, 0.247059f, 0.168627f),
+	Color(0.000000f, 0.241176f, 0.172549f),
+	Color(0.000000f, 0.223529f, 0.184314f),
+	Color(0.000000f, 0.211765f, 0.192157f),
+	Color(0.000000f, 0.200000f, 0.200000f),
+	Color(0.000000f, 0.194118f, 0.203922f),
+	Color(0.000000f, 0.176471f, 0.215686f),
+	Color(0.000000f, 0.164706f, 0.223529f),
+	Color(0.000000f, 0.152941f, 0.231373f),
+	Color(0.000000f, 0.147059f, 0.235294f),
+	Color(0.000000f, 0.129412f, 0.247059f),
+	Color(0.000000f, 0.117647f, 0.254902f),
+	Color(0.000000f, 0.105882f, 0.262745f),
+	Color(0.000000f, 0.094118f, 0.270588f),
+	Color(0.000000f, 0.082353f, 0.278431f),
+	Color(0.000000f, 0.070588f, 0.286275f),
+	Color(0.000000f, 0.064706f, 0.290196f),
+	Color(0.000000f, 0.047059f, 0.301961f),
+	Color(0.000000f, 0.035294f, 0.309804f),
+	Color(0.000000f, 0.023529f, 0.317647f),
+	Color(0.000000f, 0.011765f, 0.325490f),
+	Color(0.000000f, 0.000000f, 0.333333f),
+	Color(0.000000f, 0.011765f, 0.341176f),
+	Color(0.000000f, 0.023529f, 0.349020f),
+	Color(0.000000f, 0.029412f, 0.352941f),
+	Color(0.000000f, 0.047059f, 0.364706f),
+	Color(0.000000f, 0.058824f, 0.372549f),
+	Color(0.000000f, 0.070588f, 0.380392f),
+	Color(0.000000f, 0.082353f, 0.388235f),
+	Color(0.000000f, 0.094118f, 0.396078f),
+	Color(0.000000f, 0.105882f, 0.403922f),
+	Color(0.000000f, 0.117647f, 0.411765f),
+	Color(0.000000f, 0.123529f, 0.415686f),
+	Color(0.000000f, 0.141176f, 0.427451f),
+	Color(0.000000f, 0.152941f, 0.435294f),
+	Color(0.000000f, 0.164706f, 0.443137f),
+	Color(0.000000f, 0.176471f, 0.450980f),
+	Color(0.000000f, 0.188235f, 0.458824f),
+	Color(0.000000f, 0.200000f, 0.466667f),
+	Color(0.000000f, 0.211765f, 0.474510f),
+	Color(0.000000f, 0.217647f, 0.478431f),
+	Color(0.000000f, 0.235294f, 0.490196f),
+	Color(0.000000f, 0.247059f, 0.498039f),
+	Color(0.000000f, 0.258824f, 0.505882f),
+	Color(0.000000f, 0.270588f, 0.513725f),
+	Color(0.000000f, 0.282353f, 0.521569f),
+	Color(0.000000f, 0.294118f, 0.529412f),
+	Color(0.000000f, 0.305882f, 0.537255f),
+	Color(0.000000f, 0.317647f, 0.545098f),
+	Color(0.000000f, 0.329412f, 0.552941f),
+	Color(0.000000f, 0.341176f, 0.560784f),
+	Color(0.000000f, 0.352941f, 0.568627f),
+	Color(0.000000f, 0.364706f, 0.576471f),
+	Color(0.000000f, 0.376471f, 0.584314f),
+	Color(0.000000f, 0.382353f, 0.588235f),
+	Color(0.000000f, 0.400000f, 0.600000f),
+	Color(0.000000f, 0.411765f, 0.607843f),
+	Color(0.000000f, 0.423529f, 0.615686f),
+	Color(0.000000f, 0.435294f, 0.623529f),
+	Color(0.000000f, 0.447059f, 0.631373f),
+	Color(0.000000f, 0.458824f, 0.639216f),
+	Color(0.000000f, 0.470588f, 0.647059f),
+	Color(0.000000f, 0.482353f, 0.654902f),
+	Color(0.000000f, 0.494118f, 0.662745f),
+	Color(0.011765f, 0.505882f, 0.670588f),
+	Color(0.035294f, 0.517647f, 0.678431f),
+	Color(0.058824f, 0.529412f, 0.686275f),
+	Color(0.082353f, 0.541176f, 0.694118f),
+	Color(0.105882f, 0.552941f, 0.701961f),
+	Color(0.129412f, 0.564706f, 0.709804f),
+	Color(0.141176f, 0.570588f, 0.713725f),
+	Color(0.176471f, 0.588235f, 0.725490f),
+	Color(0.200000f, 0.600000f, 0.733333f),
+	Color(0.223529f, 0.611765f, 0.741176f),
+	Color(0.247059f, 0.623529f, 0.749020f),
+	Color(0.270588f, 0.635294f, 0.756863f),
+	Color(0.294118f, 0.647059f, 0.764706f),
+	Color(0.317647f, 0.658824f, 0.772549f),
+	Color(0.341176f, 0.670588f, 0.780392f),
+	Color(0.364706f, 0.682353f, 0.788235f),
+	Color(0.388235f, 0.694118f, 0.796078f),
+	Color(0.411765f, 0.705882f, 0.803922f),
+	Color(0.435294f, 0.717647f, 0.811765f),
+	Color(0.458824f, 0.729412f, 0.819608f),
+	Color(0.482353f, 0.741176f, 0.827451f),
+	Color(0.505882f, 0.752941f, 0.835294f),
+	Color(0.517647f, 0.758824f, 0.839216f),
+	Color(0.552941f, 0.776471f, 0.850980f),
+	Color(0.576471f, 0.788235f, 0.858824f),
+	Color(0.600000f, 0.800000f, 0.866667f),
+	Color(0.623529f, 0.811765f, 0.874510f),
+	Color(0.647059f, 0.823529f, 0.882353f),
+	Color(0.670588f, 0.835294f, 0.890196f),
+	Color(0.694118f, 0.847059f, 0.898039f),
+	Color(0.717647f, 0.858824f, 0.905882f),
+	Color(0.741176f, 0.870588f, 0.913725f),
+	Color(0.764706f, 0.882353f, 0.921569f),
+	Color(0.788235f, 0.894118f, 0.929412f),
+	Color(0.811765f, 0.905882f, 0.937255f),
+	Color(0.835294f, 0.917647f, 0.945098f),
+	Color(0.858824f, 0.929412f, 0.952941f),
+	Color(0.882353f, 0.941176f, 0.960784f),
+	Color(0.894118f, 0.947059f, 0.964706f),
+	Color(0.929412f, 0.964706f, 0.976471f),
+	Color(0.952941f, 0.976471f, 0.984314f),
+	Color(0.976471f, 0.988235f, 0.992157f),
+	Color(1.000000f, 1.000000f, 1.000000f)
 }};
 
 //! \see http://www.ncl.ucar.edu/Document/Graphics/ColorTables/MPL_winter.shtml
-const std::array<const ci::Color, 128> MPLWinter::palette{{
-	ci::Color(0.000000f, 0.003922f, 0.998039f),
-	ci::Color(0.000000f, 0.011765f, 0.994118f),
-	ci::Color(0.000000f, 0.019608f, 0.990196f),
-	ci::Color(0.000000f, 0.027451f, 0.986275f),
-	ci::Color(0.000000f, 0.035294f, 0.982353f),
-	ci::Color(0.000000f, 0.043137f, 0.978431f),
-	ci::Color(0.000000f, 0.050980f, 0.974510f),
-	ci::Color(0.000000f, 0.058824f, 0.970588f),
-	ci::Color(0.000000f, 0.066667f, 0.966667f),
-	ci::Color(0.000000f, 0.070588f, 0.964706f),
-	ci::Color(0.000000f, 0.082353f, 0.958824f),
-	ci::Color(0.000000f, 0.086275f, 0.956863f),
-	ci::Color(0.000000f, 0.098039f, 0.950980f),
-	ci::Color(0.000000f, 0.101961f, 0.949020f),
-	ci::Color(0.000000f, 0.113725f, 0.943137f),
-	ci::Color(0.000000f, 0.117647f, 0.941176f),
-	ci::Color(0.000000f, 0.129412f, 0.935294f),
-	ci::Color(0.000000f, 0.137255f, 0.931373f),
-	ci::Color(0.000000f, 0.141176f, 0.929412f),
-	ci::Color(0.000000f, 0.152941f, 0.923529f),
-	ci::Color(0.000000f, 0.160784f, 0.919608f),
-	ci::Color(0.000000f, 0.168627f, 0.915686f),
-	ci::Color(0.000000f, 0.172549f, 0.913725f),
-	ci::Color(0.000000f, 0.184314f, 0.907843f),
-	ci::Color(0.000000f, 0.192157f, 0.903922f),
-	ci::Color(0.000000f, 0.200000f, 0.900000f),
-	ci::Color(0.000000f, 0.203922f, 0.898039f),
-	ci::Color(0.000000f, 0.215686f, 0.892157f),
-	ci::Color(0.000000f, 0.223529f, 0.888235f),
-	ci::Color(0.000000f, 0.231373f, 0.884314f),
-	ci::Color(0.000000f, 0.235294f, 0.882353f),
-	ci::Color(0.000000f, 0.247059f, 0.876471f),
-	ci::Color(0.000000f, 0.254902f, 0.872549f),
-	ci::Color(0.000000f, 0.262745f, 0.868627f),
-	ci::Color(0.000000f, 0.270588f, 0.864706f),
-	ci::Color(0.000000f, 0.278431f, 0.860784f),
-	ci::Color(0.000000f, 0.286275f, 0.856863f),
-	ci::Color(0.000000f, 0.290196f, 0.854902f),
-	ci::Color(0.000000f, 0.301961f, 0.849020f),
-	ci::Color(0.000000f, 0.309804f, 0.845098f),
-	ci::Color(0.000000f, 0.317647f, 0.841176f),
-	ci::Color(0.000000f, 0.325490f, 0.837255f),
-	ci::Color(0.000000f, 0.333333f, 0.833333f),
-	ci::Color(0.000000f, 0.341176f, 0.829412f),
-	ci::Color(0.000000f, 0.349020f, 0.825490f),
-	ci::Color(0.000000f, 0.352941f, 0.823529f),
-	ci::Color(0.000000f, 0.364706f, 0.817647f),
-	ci::Color(0.000000f, 0.372549f, 0.813725f),
-	ci::Color(0.000000f, 0.380392f, 0.809804f),
-	ci::Color(0.000000f, 0.388235f, 0.805882f),
-	ci::Color(0.000000f, 0.396078f, 0.801961f),
-	ci::Color(0.000000f, 0.403922f, 0.798039f),
-	ci::Color(0.000000f, 0.411765f, 0.794118f),
-	ci::Color(0.000000f, 0.415686f, 0.792157f),
-	ci::Color(0.000000f, 0.427451f, 0.786275f),
-	ci::Color(0.000000f, 0.435294f, 0.782353f),
-	ci::Color(0.000000f, 0.443137f, 0.778431f),
-	ci::Color(0.000000f, 0.450980f, 0.774510f),
-	ci::Color(0.000000f, 0.458824f, 0.770588f),
-	ci::Color(0.000000f, 0.466667f, 0.766667f),
-	ci::Color(0.000000f, 0.474510f, 0.762745f),
-	ci::Color(0.000000f, 0.478431f, 0.760784f),
-	ci::Color(0.000000f, 0.490196f, 0.754902f),
-	ci::Color(0.000000f, 0.498039f, 0.750980f),
-	ci::Color(0.000000f, 0.505882f, 0.747059f),
-	ci::Color(0.000000f, 0.513725f, 0.743137f),
-	ci::Color(0.000000f, 0.521569f, 0.739216f),
-	ci::Color(0.000000f, 0.529412f, 0.735294f),
-	ci::Color(0.000000f, 0.537255f, 0.731373f),
-	ci::Color(0.000000f, 0.545098f, 0.727451f),
-	ci::Color(0.000000f, 0.552941f, 0.723529f),
-	ci::Color(0.000000f, 0.560784f, 0.719608f),
-	ci::Color(0.000000f, 0.568627f, 0.715686f),
-	ci::Color(0.000000f, 0.576471f, 0.711765f),
-	ci::Color(0.000000f, 0.584314f, 0.707843f),
-	ci::Color(0.000000f, 0.588235f, 0.705882f),
-	ci::Color(0.000000f, 0.600000f, 0.700000f),
-	ci::Color(0.000000f, 0.607843f, 0.696078f),
-	ci::Color(0.000000f, 0.615686f, 0.692157f),
-	ci::Color(0.000000f, 0.623529f, 0.688235f),
-	ci::Color(0.000000f, 0.631373f, 0.684314f),
-	ci::Color(0.000000f, 0.639216f, 0.680392f),
-	ci::Color(0.000000f, 0.647059f, 0.676471f),
-	ci::Color(0.000000f, 0.654902f, 0.672549f),
-	ci::Color(0.000000f, 0.662745f, 0.668627f),
-	ci::Color(0.000000f, 0.670588f, 0.664706f),
-	ci::Color(0.000000f, 0.678431f, 0.660784f),
-	ci::Color(0.000000f, 0.686275f, 0.656863f),
-	ci::Color(0.000000f, 0.694118f, 0.652941f),
-	ci::Color(0.000000f, 0.701961f, 0.649020f),
-	ci::Color(0.000000f, 0.709804f, 0.645098f),
-	ci::Color(0.000000f, 0.713725f, 0.643137f),
-	ci::Color(0.000000f, 0.725490f, 0.637255f),
-	ci::Color(0.000000f, 0.733333f, 0.633333f),
-	ci::Color(0.000000f, 0.741176f, 0.629412f),
-	ci::Color(0.000000f, 0.749020f, 0.625490f),
-	ci::Color(0.000000f, 0.756863f, 0.621569f),
-	ci::Color(0.000000f, 0.764706f, 0.617647f),
-	ci::Color(0.000000f, 0.772549f, 0.613725f),
-	ci::Color(0.000000f, 0.780392f, 0.609804f),
-	ci::Color(0.000000f, 0.788235f, 0.605882f),
-	ci::Color(0.000000f, 0.796078f, 0.601961f),
-	ci::Color(0.000000f, 0.803922f, 0.598039f),
-	ci::Color(0.000000f, 0.811765f, 0.594118f),
-	ci::Color(0.000000f, 0.819608f, 0.590196f),
-	ci::Color(0.000000f, 0.827451f, 0.586275f),
-	ci::Color(0.000000f, 0.835294f, 0.582353f),
-	ci::Color(0.000000f, 0.839216f, 0.580392f),
-	ci::Color(0.000000f, 0.850980f, 0.574510f),
-	ci::Color(0.000000f, 0.858824f, 0.570588f),
-	ci::Color(0.000000f, 0.866667f, 0.566667f),
-	ci::Color(0.000000f, 0.874510f, 0.562745f),
-	ci::Color(0.000000f, 0.882353f, 0.558824f),
-	ci::Color(0.000000f, 0.890196f, 0.554902f),
-	ci::Color(0.000000f, 0.898039f, 0.550980f),
-	ci::Color(0.000000f, 0.905882f, 0.547059f),
-	ci::Color(0.000000f, 0.913725f, 0.543137f),
-	ci::Color(0.000000f, 0.921569f, 0.539216f),
-	ci::Color(0.000000f, 0.929412f, 0.535294f),
-	ci::Color(0.000000f, 0.937255f, 0.531373f),
-	ci::Color(0.000000f, 0.945098f, 0.527451f),
-	ci::Color(0.000000f, 0.952941f, 0.523529f),
-	ci::Color(0.000000f, 0.960784f, 0.519608f),
-	ci::Color(0.000000f, 0.964706f, 0.517647f),
-	ci::Color(0.000000f, 0.976471f, 0.511765f),
-	ci::Color(0.000000f, 0.984314f, 0.507843f),
-	ci::Color(0.000000f, 0.992157f, 0.503922f),
-	ci::Color(0.000000f, 1.000000f, 0.500000f)
+const std::array<const Color, 128> MPLWinter::palette{{
+	Color(0.000000f, 0.003922f, 0.998039f),
+	Color(0.000000f, 0.011765f, 0.994118f),
+	Color(0.000000f, 0.019608f, 0.990196f),
+	Color(0.000000f, 0.027451f, 0.986275f),
+	Color(0.000000f, 0.035294f, 0.982353f),
+	Color(0.000000f, 0.043137f, 0.978431f),
+	Color(0.000000f, 0.050980f, 0.974510f),
+	Color(0.000000f, 0.058824f, 0.970588f),
+	Color(0.000000f, 0.066667f, 0.966667f),
+	Color(0.000000f, 0.070588f, 0.964706f),
+	Color(0.000000f, 0.082353f, 0.958824f),
+	Color(0.000000f, 0.086275f, 0.956863f),
+	Color(0.000000f, 0.098039f, 0.950980f),
+	Color(0.000000f, 0.101961f, 0.949020f),
+	Color(0.000000f, 0.113725f, 0.943137f),
+	Color(0.000000f, 0.117647f, 0.941176f),
+	Color(0.000000f, 0.129412f, 0.935294f),
+	Color(0.000000f, 0.137255f, 0.931373f),
+	Color(0.000000f, 0.141176f, 0.929412f),
+	Color(0.000000f, 0.152941f, 0.923529f),
+	Color(0.000000f, 0.160784f, 0.919608f),
+	Color(0.000000f, 0.168627f, 0.915686f),
+	Color(0.000000f, 0.172549f, 0.913725f),
+	Color(0.000000f, 0.184314f, 0.907843f),
+	Color(0.000000f, 0.192157f, 0.903922f),
+	Color(0.000000f, 0.200000f, 0.900000f),
+	Color(0.000000f, 0.203922f, 0.898039f),
+	Color(0.000000f, 0.215686f, 0.892157f),
+	Color(0.000000f, 0.223529f, 0.888235f),
+	Color(0.000000f, 0.231373f, 0.884314f),
+	Color(0.000000f, 0.235294f, 0.882353f),
+	Color(0.000000f, 0.247059f, 0.876471f),
+	Color(0.000000f, 0.254902f, 0.872549f),
+	Color(0.000000f, 0.262745f, 0.868627f),
+	Color(0.000000f, 0.270588f, 0.864706f),
+	Color(0.000000f, 0.278431f, 0.860784f),
+	Color(0.000000f, 0.286275f, 0.856863f),
+	Color(0.000000f, 0.290196f, 0.854902f),
+	Color(0.000000f, 0.301961f, 0.849020f),
+	Color(0.000000f, 0.309804f, 0.845098f),
+	Color(0.000000f, 0.317647f, 0.841176f),
+	Color(0.000000f, 0.325490f, 0.837255f),
+	Color(0.000000f, 0.333333f, 0.833333f),
+	Color(0.000000f, 0.341176f, 0.829412f),
+	Color(0.000000f, 0.349020f, 0.825490f),
+	Color(0.000000f, 0.352941f, 0.823529f),
+	Color(0.000000f, 0.364706f, 0.817647f),
+	Color(0.000000f, 0.372549f, 0.813725f),
+	Color(0.000000f, 0.380392f, 0.809804f),
+	Color(0.000000f, 0.388235f, 0.805882f),
+	Color(0.000000f, 0.396078f, 0.801961f),
+	Color(0.000000f, 0.403922f, 0.798039f),
+	Color(0.000000f, 0.411765f, 0.794118f),
+	Color(0.000000f, 0.415686f, 0.792157f),
+	Color(0.000000f, 0.427451f, 0.786275f),
+	Color(0.000000f, 0.435294f, 0.782353f),
+	Color(0.000000f, 0.443137f, 0.778431f),
+	Color(0.000000f, 0.450980f, 0.774510f),
+	Color(0.000000f, 0.458824f, 0.770588f),
+	Color(0.000000f, 0.466667f, 0.766667f),
+	Color(0.000000f, 0.474510f, 0.762745f),
+	Color(0.000000f, 0.478431f, 0.760784f),
+	Color(0.000000f, 0.490196f, 0.754902f),
+	Color(0.000000f, 0.498039f, 0.750980f),
+	Color(0.000000f, 0.505882f, 0.747059f),
+	Color(0.000000f, 0.513725f, 0.743137f),
+	Color(0.000000f, 0.521569f, 0.739216f),
+	Color(0.000000f, 0.529412f, 0.735294f),
+	Color(0.000000f, 0.537255f, 0.731373f),
+	Color(0.000000f, 0.545098f, 0.727451f),
+	Color(0.000000f, 0.552941f, 0.723529f),
+	Color(0.000000f, 0.560784f, 0.719608f),
+	Color(0.000000f, 0.568627f, 0.715686f),
+	Color(0.000000f, 0.576471f, 0.711765f),
+	Color(0.000000f, 0.584314f, 0.707843f),
+	Color(0.000000f, 0.588235f, 0.705882f),
+	Color(0.000000f, 0.600000f, 0.700000f),
+	Color(0.000000f, 0.607843f, 0.696078f),
+	Color(0.000000f, 0.615686f, 0.692157f),
+	Color(0.000000f, 0.623529f, 0.688235f),
+	Color(0.000000f, 0.631373f, 0.684314f),
+	Color(0.000000f, 0.639216f, 0.680392f),
+	Color(0.000000f, 0.647059f, 0.676471f),
+	Color(0.000000f, 0.654902f, 0.672549f),
+	Color(0.000000f, 0.662745f, 0.668627f),
+	Color(0.000000f, 0.670588f, 0.664706f),
+	Color(0.000000f, 0.678431f, 0.660784f),
+	Color(0.000000f, 0.686275f, 0.656863f),
+	Color(0.000000f, 0.694118f, 0.652941f),
+	Color(0.000000f, 0.701961f, 0.649020f),
+	Color(0.000000f, 0.709804f, 0.645098f),
+	Color(0.000000f, 0.713725f, 0.643137f),
+	Color(0.000000f, 0.725490f, 0.637255f),
+	Color(0.000000f, 0.733333f, 0.633333f),
+	Color(0.000000f, 0.741176f, 0.629412f),
+	Color(0.000000f, 0.749020f, 0.625490f),
+	Color(0.000000f, 0.756863f, 0.621569f),
+	Color(0.000000f, 0.764706f, 0.617647f),
+	Color(0.000000f, 0.772549f, 0.613725f),
+	Color(0.000000f, 0.780392f, 0.609804f),
+	Color(0.000000f, 0.788235f, 0.605882f),
+	Color(0.000000f, 0.796078f, 0.601961f),
+	Color(0.000000f, 0.803922f, 0.598039f),
+	Color(0.000000f, 0.811765f, 0.594118f),
+	Color(0.000000f, 0.819608f, 0.590196f),
+	Color(0.000000f, 0.827451f, 0.586275f),
+	Color(0.000000f, 0.835294f, 0.582353f),
+	Color(0.000000f, 0.839216f, 0.580392f),
+	Color(0.000000f, 0.850980f, 0.574510f),
+	Color(0.000000f, 0.858824f, 0.570588f),
+	Color(0.000000f, 0.866667f, 0.566667f),
+	Color(0.000000f, 0.874510f, 0.562745f),
+	Color(0.000000f, 0.882353f, 0.558824f),
+	Color(0.000000f, 0.890196f, 0.554902f),
+	Color(0.000000f, 0.898039f, 0.550980f),
+	Color(0.000000f, 0.905882f, 0.547059f),
+	Color(0.000000f, 0.913725f, 0.543137f),
+	Color(0.000000f, 0.921569f, 0.539216f),
+	Color(0.000000f, 0.929412f, 0.535294f),
+	Color(0.000000f, 0.937255f, 0.531373f),
+	Color(0.000000f, 0.945098f, 0.527451f),
+	Color(0.000000f, 0.952941f, 0.523529f),
+	Color(0.000000f, 0.960784f, 0.519608f),
+	Color(0.000000f, 0.964706f, 0.517647f),
+	Color(0.000000f, 0.976471f, 0.511765f),
+	Color(0.000000f, 0.984314f, 0.507843f),
+	Color(0.000000f, 0.992157f, 0.503922f),
+	Color(0.000000f, 1.000000f, 0.500000f)
 }};
 
 // Generated from:
 // http://www.ncl.ucar.edu/Document/Graphics/ColorTables/Files/OceanLakeLandSnow.rgb
 
-const std::array<const ci::Colorf, 254> OceanLakeLandSnow::palette{{
-	ci::Color(0.094118f, 0.45490f, 0.80392f),
-	ci::Color(0.52941f, 0.80784f, 1.0000f),
-	ci::Color(0.14902f, 0.40392f, 0.15686f),
-	ci::Color(0.16471f, 0.41961f, 0.15686f),
-	ci::Color(0.18039f, 0.43137f, 0.16078f),
-	ci::Color(0.19608f, 0.44706f, 0.16078f),
-	ci::Color(0.21176f, 0.45882f, 0.16078f),
-	ci::Color(0.22745f, 0.47451f, 0.16471f),
-	ci::Color(0.24314f, 0.48627f, 0.16471f),
-	ci::Color(0.25882f, 0.50196f, 0.16471f),
-	ci::Color(0.27451f, 0.51373f, 0.16863f),
-	ci::Color(0.29020f, 0.52941f, 0.16863f),
-	ci::Color(0.30588f, 0.54118f, 0.16863f),
-	ci::Color(0.32157f, 0.55686f, 0.17255f),
-	ci::Color(0.33725f, 0.56863f, 0.17255f),
-	ci::Color(0.35294f, 0.58431f, 0.17255f),
-	ci::Color(0.36863f, 0.59608f, 0.17647f),
-	ci::Color(0.38431f, 0.61176f, 0.17647f),
-	ci::Color(0.40000f, 0.62353f, 0.18039f),
-	ci::Color(0.41569f, 0.63922f, 0.18039f),
-	ci::Color(0.43137f, 0.65098f, 0.18039f),
-	ci::Color(0.44706f, 0.66667f, 0.18431f),
-	ci::Color(0.46275f, 0.67843f, 0.18431f),
-	ci::Color(0.47843f, 0.69412f, 0.18431f),
-	ci::Color(0.49412f, 0.70588f, 0.18824f),
-	ci::Color(0.50980f, 0.72157f, 0.18824f),
-	ci::Color(0.52549f, 0.73333f, 0.18824f),
-	ci::Color(0.54118f, 0.74902f, 0.19216f),
-	ci::Color(0.55686f, 0.76078f, 0.19216f),
-	ci::Color(0.57255f, 0.77647f, 0.19216f),
-	ci::Color(0.60392f, 0.80392f, 0.19608f),
-	ci::Color(0.60784f, 0.80784f, 0.20392f),
-	ci::Color(0.61176f, 0.81176f, 0.21176f),
-	ci::Color(0.61961f, 0.81569f, 0.21961f),
-	ci::Color(0.62353f, 0.82353f, 0.22353f),
-	ci::Color(0.62745f, 0.82745f, 0.23137f),
-	ci::Color(0.63137f, 0.83137f, 0.23922f),
-	ci::Color(0.63529f, 0.83529f, 0.24706f),
-	ci::Color(0.63922f, 0.83922f, 0.25490f),
-	ci::Color(0.64706f, 0.84314f, 0.26275f),
-	ci::Color(0.65098f, 0.84706f, 0.27059f),
-	ci::Color(0.65490f, 0.85490f, 0.27451f),
-	ci::Color(0.65882f, 0.85882f, 0.28235f),
-	ci::Color(0.66275f, 0.86275f, 0.29020f),
-	ci::Color(0.66667f, 0.86667f, 0.29804f),
-	ci::Color(0.67451f, 0.87059f, 0.30588f),
-	ci::Color(0.67843f, 0.87451f, 0.31373f),
-	ci::Color(0.68235f, 0.87843f, 0.32157f),
-	ci::Color(0.68627f, 0.88235f, 0.32941f),
-	ci::Color(0.69020f, 0.89020f, 0.33333f),
-	ci::Color(0.69412f, 0.89412f, 0.34118f),
-	ci::Color(0.70196f, 0.89804f, 0.34902f),
-	ci::Color(0.70588f, 0.90196f, 0.35686f),
-	ci::Color(0.70980f, 0.90588f, 0.36471f),
-	ci::Color(0.71373f, 0.90980f, 0.37255f),
-	ci::Color(0.71765f, 0.91373f, 0.38039f),
-	ci::Color(0.72157f, 0.92157f, 0.38431f),
-	ci::Color(0.72941f, 0.92549f, 0.39216f),
-	ci::Color(0.73725f, 0.93333f, 0.40784f),
-	ci::Color(0.74510f, 0.93333f, 0.41961f),
-	ci::Color(0.75294f, 0.93333f, 0.43529f),
-	ci::Color(0.76078f, 0.93725f, 0.44706f),
-	ci::Color(0.77255f, 0.93725f, 0.45882f),
-	ci::Color(0.78039f, 0.93725f, 0.47451f),
-	ci::Color(0.78824f, 0.93725f, 0.48627f),
-	ci::Color(0.79608f, 0.94118f, 0.49804f),
-	ci::Color(0.80392f, 0.94118f, 0.50980f),
-	ci::Color(0.81176f, 0.94118f, 0.52549f),
-	ci::Color(0.81961f, 0.94118f, 0.53725f),
-	ci::Color(0.83137f, 0.94510f, 0.54902f),
-	ci::Color(0.83922f, 0.94510f, 0.56471f),
-	ci::Color(0.84706f, 0.94510f, 0.57647f),
-	ci::Color(0.85490f, 0.94510f, 0.58824f),
-	ci::Color(0.86275f, 0.94902f, 0.60392f),
-	ci::Color(0.87059f, 0.94902f, 0.61569f),
-	ci::Color(0.87843f, 0.94902f, 0.62745f),
-	ci::Color(0.88627f, 0.94902f, 0.64314f),
-	ci::Color(0.89804f, 0.95294f, 0.65490f),
-	ci::Color(0.90588f, 0.95294f, 0.66667f),
-	ci::Color(0.91373f, 0.95294f, 0.68235f),
-	ci::Color(0.92157f, 0.95294f, 0.69412f),
-	ci::Color(0.92941f, 0.95686f, 0.70588f),
-	ci::Color(0.93725f, 0.95686f, 0.71765f),
-	ci::Color(0.94510f, 0.95686f, 0.73333f),
-	ci::Color(0.95686f, 0.95686f, 0.74510f),
-	ci::Color(0.96471f, 0.96078f, 0.75686f),
-	ci::Color(0.98039f, 0.96078f, 0.78431f),
-	ci::Color(0.98039f, 0.95686f, 0.78039f),
-	ci::Color(0.97647f, 0.95686f, 0.77255f),
-	ci::Color(0.97647f, 0.95294f, 0.76863f),
-	ci::Color(0.97647f, 0.95294f, 0.76078f),
-	ci::Color(0.97255f, 0.94902f, 0.75686f),
-	ci::Color(0.97255f, 0.94902f, 0.74902f),
-	ci::Color(0.97255f, 0.94510f, 0.74510f),
-	ci::Color(0.96863f, 0.94510f, 0.73725f),
-	ci::Color(0.96863f, 0.94118f, 0.73333f),
-	ci::Color(0.96863f, 0.93725f, 0.72941f),
-	ci::Color(0.96471f, 0.93725f, 0.72157f),
-	ci::Color(0.96471f, 0.93333f, 0.71765f),
-	ci::Color(0.96471f, 0.93333f, 0.70980f),
-	ci::Color(0.96078f, 0.92941f, 0.70588f),
-	ci::Color(0.96078f, 0.92941f, 0.69804f),
-	ci::Color(0.95686f, 0.92549f, 0.69412f),
-	ci::Color(0.95686f, 0.92549f, 0.68627f),
-	ci::Color(0.95686f, 0.92157f, 0.68235f),
-	ci::Color(0.95294f, 0.92157f, 0.67451f),
-	ci::Color(0.95294f, 0.91765f, 0.67059f),
-	ci::Color(0.95294f, 0.91373f, 0.66667f),
-	ci::Color(0.94902f, 0.91373f, 0.65882f),
-	ci::Color(0.94902f, 0.90980f, 0.65490f),
-	ci::Color(0.94902f, 0.90980f, 0.64706f),
-	ci::Color(0.94510f, 0.90588f, 0.64314f),
-	ci::Color(0.94510f, 0.90588f, 0.63529f),
-	ci::Color(0.94510f, 0.90196f, 0.63137f),
-	ci::Color(0.94118f, 0.89804f, 0.61961f),
-	ci::Color(0.93725f, 0.89412f, 0.60784f),
-	ci::Color(0.93333f, 0.88627f, 0.60000f),
-	ci::Color(0.92941f, 0.88235f, 0.58824f),
-	ci::Color(0.92549f, 0.87843f, 0.58039f),
-	ci::Color(0.92157f, 0.87059f, 0.56863f),
-	ci::Color(0.91765f, 0.86667f, 0.55686f),
-	ci::Color(0.91373f, 0.86275f, 0.54902f),
-	ci::Color(0.91373f, 0.85882f, 0.53725f),
-	ci::Color(0.90980f, 0.85098f, 0.52941f),
-	ci::Color(0.90588f, 0.84706f, 0.51765f),
-	ci::Color(0.90196f, 0.84314f, 0.50980f),
-	ci::Color(0.89804f, 0.83529f, 0.49804f),
-	ci::Color(0.89412f, 0.83137f, 0.48627f),
-	ci::Color(0.89020f, 0.82745f, 0.47843f),
-	ci::Color(0.88627f, 0.81961f, 0.46667f),
-	ci::Color(0.88235f, 0.81569f, 0.45882f),
-	ci::Color(0.87843f, 0.81176f, 0.44706f),
-	ci::Color(0.87451f, 0.80392f, 0.43529f),
-	ci::Color(0.87059f, 0.80000f, 0.42745f),
-	ci::Color(0.86667f, 0.79608f, 0.41569f),
-	ci::Color(0.86275f, 0.78824f, 0.40784f),
-	ci::Color(0.86275f, 0.78431f, 0.39608f),
-	ci::Color(0.85882f, 0.78039f, 0.38824f),
-	ci::Color(0.85490f, 0.77647f, 0.37647f),
-	ci::Color(0.85098f, 0.76863f, 0.36471f),
-	ci::Color(0.84706f, 0.76471f, 0.35686f),
-	ci::Color(0.83529f, 0.74902f, 0.32549f),
-	ci::Color(0.83529f, 0.74510f, 0.31765f),
-	ci::Color(0.83137f, 0.74118f, 0.30980f),
-	ci::Color(0.83137f, 0.73333f, 0.30196f),
-	ci::Color(0.83137f, 0.72941f, 0.29804f),
-	ci::Color(0.83137f, 0.72549f, 0.29020f),
-	ci::Color(0.82745f, 0.72157f, 0.28235f),
-	ci::Color(0.82745f, 0.71373f, 0.27451f),
-	ci::Color(0.82745f, 0.70980f, 0.26667f),
-	ci::Color(0.82745f, 0.70588f, 0.25882f),
-	ci::Color(0.82353f, 0.70196f, 0.25098f),
-	ci::Color(0.82353f, 0.69412f, 0.24706f),
-	ci::Color(0.82353f, 0.69020f, 0.23922f),
-	ci::Color(0.81961f, 0.68627f, 0.23137f),
-	ci::Color(0.81961f, 0.68235f, 0.22353f),
-	ci::Color(0.81961f, 0.67451f, 0.21569f),
-	ci::Color(0.81961f, 0.67059f, 0.20784f),
-	ci::Color(0.81569f, 0.66667f, 0.20000f),
-	ci::Color(0.81569f, 0.66275f, 0.19216f),
-	ci::Color(0.81569f, 0.65490f, 0.18824f),
-	ci::Color(0.81176f, 0.65098f, 0.18039f),
-	ci::Color(0.81176f, 0.64706f, 0.17255f),
-	ci::Color(0.81176f, 0.64314f, 0.16471f),
-	ci::Color(0.81176f, 0.63529f, 0.15686f),
-	ci::Color(0.80784f, 0.63137f, 0.14902f),
-	ci::Color(0.80784f, 0.62745f, 0.14118f),
-	ci::Color(0.80784f, 0.62353f, 0.13725f),
-	ci::Color(0.80784f, 0.61569f, 0.12941f),
-	ci::Color(0.80392f, 0.60784f, 0.11373f),
-	ci::Color(0.79608f, 0.60000f, 0.11373f),
-	ci::Color(0.78431f, 0.59216f, 0.11765f),
-	ci::Color(0.77647f, 0.58039f, 0.11765f),
-	ci::Color(0.76863f, 0.57255f, 0.12157f),
-	ci::Color(0.76078f, 0.56471f, 0.12157f),
-	ci::Color(0.74902f, 0.55686f, 0.12549f),
-	ci::Color(0.74118f, 0.54510f, 0.12549f),
-	ci::Color(0.73333f, 0.53725f, 0.12941f),
-	ci::Color(0.72549f, 0.52941f, 0.12941f),
-	ci::Color(0.71373f, 0.52157f, 0.13333f),
-	ci::Color(0.70588f, 0.50980f, 0.13333f),
-	ci::Color(0.69804f, 0.50196f, 0.13725f),
-	ci::Color(0.68627f, 0.49412f, 0.13725f),
-	ci::Color(0.67843f, 0.48627f, 0.14118f),
-	ci::Color(0.67059f, 0.47451f, 0.14118f),
-	ci::Color(0.66275f, 0.46667f, 0.14510f),
-	ci::Color(0.65098f, 0.45882f, 0.14510f),
-	ci::Color(0.64314f, 0.45098f, 0.14902f),
-	ci::Color(0.63529f, 0.43922f, 0.14902f),
-	ci::Color(0.62353f, 0.43137f, 0.15294f),
-	ci::Color(0.61569f, 0.42353f, 0.15294f),
-	ci::Color(0.60784f, 0.41569f, 0.15686f),
-	ci::Color(0.60000f, 0.40392f, 0.15686f),
-	ci::Color(0.58824f, 0.39608f, 0.16078f),
-	ci::Color(0.58039f, 0.38824f, 0.16078f),
-	ci::Color(0.57255f, 0.38039f, 0.16471f),
-	ci::Color(0.56471f, 0.36863f, 0.16471f),
-	ci::Color(0.54510f, 0.35294f, 0.16863f),
-	ci::Color(0.53725f, 0.34902f, 0.16471f),
-	ci::Color(0.52941f, 0.34510f, 0.16471f),
-	ci::Color(0.52157f, 0.33725f, 0.16078f),
-	ci::Color(0.51373f, 0.33333f, 0.16078f),
-	ci::Color(0.50588f, 0.32941f, 0.15686f),
-	ci::Color(0.49804f, 0.32549f, 0.15294f),
-	ci::Color(0.49020f, 0.31765f, 0.15294f),
-	ci::Color(0.48627f, 0.31373f, 0.14902f),
-	ci::Color(0.47843f, 0.30980f, 0.14902f),
-	ci::Color(0.47059f, 0.30588f, 0.14510f),
-	ci::Color(0.46275f, 0.29804f, 0.14510f),
-	ci::Color(0.45490f, 0.29412f, 0.14118f),
-	ci::Color(0.44706f, 0.29020f, 0.13725f),
-	ci::Color(0.43922f, 0.28627f, 0.13725f),
-	ci::Color(0.43137f, 0.27843f, 0.13333f),
-	ci::Color(0.42353f, 0.27451f, 0.13333f),
-	ci::Color(0.41569f, 0.27059f, 0.12941f),
-	ci::Color(0.40784f, 0.26667f, 0.12549f),
-	ci::Color(0.40000f, 0.25882f, 0.12549f),
-	ci::Color(0.39216f, 0.25490f, 0.12157f),
-	ci::Color(0.38431f, 0.25098f, 0.12157f),
-	ci::Color(0.38039f, 0.24706f, 0.11765f),
-	ci::Color(0.37255f, 0.23922f, 0.11765f),
-	ci::Color(0.36471f, 0.23529f, 0.11373f),
-	ci::Color(0.35686f, 0.23137f, 0.10980f),
-	ci::Color(0.34902f, 0.22745f, 0.10980f),
-	ci::Color(0.34118f, 0.21961f, 0.10588f),
-	ci::Color(0.32549f, 0.21176f, 0.10196f),
-	ci::Color(0.34902f, 0.23922f, 0.13333f),
-	ci::Color(0.36863f, 0.26275f, 0.16471f),
-	ci::Color(0.39216f, 0.29020f, 0.19608f),
-	ci::Color(0.41569f, 0.31765f, 0.22745f),
-	ci::Color(0.43529f, 0.34118f, 0.25490f),
-	ci::Color(0.45882f, 0.36863f, 0.28627f),
-	ci::Color(0.48235f, 0.39608f, 0.31765f),
-	ci::Color(0.50588f, 0.42353f, 0.34902f),
-	ci::Color(0.52549f, 0.44706f, 0.38039f),
-	ci::Color(0.54902f, 0.47451f, 0.41176f),
-	ci::Color(0.57255f, 0.50196f, 0.44314f),
-	ci::Color(0.59216f, 0.52549f, 0.47451f),
-	ci::Color(0.61569f, 0.55294f, 0.50588f),
-	ci::Color(0.63922f, 0.58039f, 0.53725f),
-	ci::Color(0.65882f, 0.60392f, 0.56471f),
-	ci::Color(0.68235f, 0.63137f, 0.59608f),
-	ci::Color(0.70588f, 0.65882f, 0.62745f),
-	ci::Color(0.72549f, 0.68235f, 0.65882f),
-	ci::Color(0.74902f, 0.70980f, 0.69020f),
-	ci::Color(0.77255f, 0.73725f, 0.72157f),
-	ci::Color(0.79216f, 0.76078f, 0.75294f),
-	ci::Color(0.81569f, 0.78824f, 0.78431f),
-	ci::Color(0.83922f, 0.81569f, 0.81569f),
-	ci::Color(0.86275f, 0.84314f, 0.84706f),
-	ci::Color(0.88235f, 0.86667f, 0.87451f),
-	ci::Color(0.90588f, 0.89412f, 0.90588f),
-	ci::Color(0.92941f, 0.92157f, 0.93725f),
-	ci::Color(0.97255f, 0.97255f, 1.0000)
+const std::array<const Color, 254> OceanLakeLandSnow::palette{{
+	Color(0.094118f, 0.45490f, 0.80392f),
+	Color(0.52941f, 0.80784f, 1.0000f),
+	Color(0.14902f, 0.40392f, 0.15686f),
+	Color(0.16471f, 0.41961f, 0.15686f),
+	Color(0.18039f, 0.43137f, 0.16078f),
+	Color(0.19608f, 0.44706f, 0.16078f),
+	Color(0.21176f, 0.45882f, 0.16078f),
+	Color(0.22745f, 0.47451f, 0.16471f),
+	Color(0.24314f, 0.48627f, 0.16471f),
+	Color(0.25882f, 0.50196f, 0.16471f),
+	Color(0.27451f, 0.51373f, 0.16863f),
+	Color(0.29020f, 0.52941f, 0.16863f),
+	Color(0.30588f, 0.54118f, 0.16863f),
+	Color(0.32157f, 0.55686f, 0.17255f),
+	Color(0.33725f, 0.56863f, 0.17255f),
+	Color(0.35294f, 0.58431f, 0.17255f),
+	Color(0.36863f, 0.59608f, 0.17647f),
+	Color(0.38431f, 0.61176f, 0.17647f),
+	Color(0.40000f, 0.62353f, 0.18039f),
+	Color(0.41569f, 0.63922f, 0.18039f),
+	Color(0.43137f, 0.65098f, 0.18039f),
+	Color(0.44706f, 0.66667f, 0.18431f),
+	Color(0.46275f, 0.67843f, 0.18431f),
+	Color(0.47843f, 0.69412f, 0.18431f),
+	Color(0.49412f, 0.70588f, 0.18824f),
+	Color(0.50980f, 0.72157f, 0.18824f),
+	Color(0.52549f, 0.73333f, 0.18824f),
+	Color(0.54118f, 0.74902f, 0.19216f),
+	Color(0.55686f, 0.76078f, 0.19216f),
+	Color(0.57255f, 0.77647f, 0.19216f),
+	Color(0.60392f, 0.80392f, 0.19608f),
+	Color(0.60784f, 0.80784f, 0.20392f),
+	Color(0.61176f, 0.81176f, 0.21176f),
+	Color(0.61961f, 0.81569f, 0.21961f),
+	Color(0.62353f, 0.82353f, 0.22353f),
+	Color(0.62745f, 0.82745f, 0.23137f),
+	Color(0.63137f, 0.83137f, 0.23922f),
+	Color(0.63529f, 0.83529f, 0.24706f),
+	Color(0.63922f, 0.83922f, 0.25490f),
+	Color(0.64706f, 0.84314f, 0.26275f),
+	Color(0.65098f, 0.84706f, 0.27059f),
+	Color(0.65490f, 0.85490f, 0.27451f),
+	Color(0.65882f, 0.85882f, 0.28235f),
+	Color(0.66275f, 0.86275f, 0.29020f),
+	Color(0.66667f, 0.86667f, 0.29804f),
+	Color(0.67451f, 0.87059f, 0.30588f),
+	Color(0.67843f, 0.87451f, 0.31373f),
+	Color(0.68235f, 0.87843f, 0.32157f),
+	Color(0.68627f, 0.88235f, 0.32941f),
+	Color(0.69020f, 0.89020f, 0.33333f),
+	Color(0.69412f, 0.89412f, 0.34118f),
+	Color(0.70196f, 0.89804f, 0.34902f),
+	Color(0.70588f, 0.90196f, 0.35686f),
+	Color(0.70980f, 0.90588f, 0.36471f),
+	Color(0.71373f, 0.90980f, 0.37255f),
+	Color(0.71765f, 0.91373f, 0.38039f),
+	Color(0.72157f, 0.92157f, 0.38431f),
+	Color(0.72941f, 0.92549f, 0.39216f),
+	Color(0.73725f, 0.93333f, 0.40784f),
+	Color(0.74510f, 0.93333f, 0.41961f),
+	Color(0.75294f, 0.93333f, 0.43529f),
+	Color(0.76078f, 0.93725f, 0.44706f),
+	Color(0.77255f, 0.93725f, 0.45882f),
+	Color(0.78039f, 0.93725f, 0.47451f),
+	Color(0.78824f, 0.93725f, 0.48627f),
+	Color(0.79608f, 0.94118f, 0.49804f),
+	Color(0.80392f, 0.94118f, 0.50980f),
+	Color(0.81176f, 0.94118f, 0.52549f),
+	Color(0.81961f, 0.94118f, 0.53725f),
+	Color(0.83137f, 0.94510f, 0.54902f),
+	Color(0.83922f, 0.94510f, 0.56471f),
+	Color(0.84706f, 0.94510f, 0.57647f),
+	Color(0.85490f, 0.94510f, 0.58824f),
+	Color(0.86275f, 0.94902f, 0.60392f),
+	Color(0.87059f, 0.94902f, 0.61569f),
+	Color(0.87843f, 0.94902f, 0.62745f),
+	Color(0.88627f, 0.94902f, 0.64314f),
+	Color(0.89804f, 0.95294f, 0.65490f),
+	Color(0.90588f, 0.95294f, 0.66667f),
+	Color(0.91373f, 0.95294f, 0.68235f),
+	Color(0.92157f, 0.95294f, 0.69412f),
+	Color(0.92941f, 0.95686f, 0.70588f),
+	Color(0.93725f, 0.95686f, 0.71765f),
+	Color(0.94510f, 0.95686f, 0.73333f),
+	Color(0.95686f, 0.95686f, 0.74510f),
+	Color(0.96471f, 0.96078f, 0.75686f),
+	Color(0.98039f, 0.96078f, 0.78431f),
+	Color(0.98039f, 0.95686f, 0.78039f),
+	Color(0.97647f, 0.95686f, 0.77255f),
+	Color(0.97647f, 0.95294f, 0.76863f),
+	Color(0.97647f, 0.95294f, 0.76078f),
+	Color(0.97255f, 0.94902f, 0.75686f),
+	Color(0.97255f, 0.94902f, 0.74902f),
+	Color(0.97255f, 0.94510f, 0.74510f),
+	Color(0.96863f, 0.94510f, 0.73725f),
+	Color(0.96863f, 0.94118f, 0.73333f),
+	Color(0.96863f, 0.93725f, 0.72941f),
+	Color(0.96471f, 0.93725f, 0.72157f),
+	Color(0.96471f, 0.93333f, 0.71765f),
+	Color(0.96471f, 0.93333f, 0.70980f),
+	Color(0.96078f, 0.92941f, 0.70588f),
+	Color(0.96078f, 0.92941f, 0.69804f),
+	Color(0.95686f, 0.92549f, 0.69412f),
+	Color(0.95686f, 0.92549f, 0.68627f),
+	Color(0.95686f, 0.92157f, 0.68235f),
+	Color(0.95294f, 0.92157f, 0.67451f),
+	Color(0.95294f, 0.91765f, 0.67059f),
+	Color(0.95294f, 0.91373f, 0.66667f),
+	Color(0.94902f, 0.91373f, 0.65882f),
+	Color(0.94902f, 0.90980f, 0.65490f),
+	Color(0.94902f, 0.90980f, 0.64706f),
+	Color(0.94510f, 0.90588f, 0.64314f),
+	Color(0.94510f, 0.90588f, 0.63529f),
+	Color(0.94510f, 0.90196f, 0.63137f),
+	Color(0.94118f, 0.89804f, 0.61961f),
+	Color(0.93725f, 0.89412f, 0.60784f),
+	Color(0.93333f, 0.88627f, 0.60000f),
+	Color(0.92941f, 0.88235f, 0.58824f),
+	Color(0.92549f, 0.87843f, 0.58039f),
+	Color(0.92157f, 0.87059f, 0.56863f),
+	Color(0.91765f, 0.86667f, 0.55686f),
+	Color(0.91373f, 0.86275f, 0.54902f),
+	Color(0.91373f, 0.85882f, 0.53725f),
+	Color(0.90980f, 0.85098f, 0.52941f),
+	Color(0.90588f, 0.84706f, 0.51765f),
+	Color(0.90196f, 0.84314f, 0.50980f),
+	Color(0.89804f, 0.83529f, 0.49804f),
+	Color(0.89412f, 0.83137f, 0.48627f),
+	Color(0.89020f, 0.82745f, 0.47843f),
+	Color(0.88627f, 0.81961f, 0.46667f),
+	Color(0.88235f, 0.81569f, 0.45882f),
+	Color(0.87843f, 0.81176f, 0.44706f),
+	Color(0.87451f, 0.80392f, 0.43529f),
+	Color(0.87059f, 0.80000f, 0.42745f),
+	Color(0.86667f, 0.79608f, 0.41569f),
+	Color(0.86275f, 0.78824f, 0.40784f),
+	Color(0.86275f, 0.78431f, 0.39608f),
+	Color(0.85882f, 0.78039f, 0.38824f),
+	Color(0.85490f, 0.77647f, 0.37647f),
+	Color(0.85098f, 0.76863f, 0.36471f),
+	Color(0.84706f, 0.76471f, 0.35686f),
+	Color(0.83529f, 0.74902f, 0.32549f),
+	Color(0.83529f, 0.74510f, 0.31765f),
+	Color(0.83137f, 0.74118f, 0.30980f),
+	Color(0.83137f, 0.73333f, 0.30196f),
+	Color(0.83137f, 0.72941f, 0.29804f),
+	Color(0.83137f, 0.72549f, 0.29020f),
+	Color(0.82745f, 0.72157f, 0.28235f),
+	Color(0.82745f, 0.71373f, 0.27451f),
+	Color(0.82745f, 0.70980f, 0.26667f),
+	Color(0.82745f, 0.70588f, 0.25882f),
+	Color(0.82353f, 0.70196f, 0.25098f),
+	Color(0.82353f, 0.69412f, 0.24706f),
+	Color(0.82353f, 0.69020f, 0.23922f),
+	Color(0.81961f, 0.68627f, 0.23137f),
+	Color(0.81961f, 0.68235f, 0.22353f),
+	Color(0.81961f, 0.67451f, 0.21569f),
+	Color(0.81961f, 0.67059f, 0.20784f),
+	Color(0.81569f, 0.66667f, 0.20000f),
+	Color(0.81569f, 0.66275f, 0.19216f),
+	Color(0.81569f, 0.65490f, 0.18824f),
+	Color(0.81176f, 0.65098f, 0.18039f),
+	Color(0.81176f, 0.64706f, 0.17255f),
+	Color(0.81176f, 0.64314f, 0.16471f),
+	Color(0.81176f, 0.63529f, 0.15686f),
+	Color(0.80784f, 0.63137f, 0.14902f),
+	Color(0.80784f, 0.62745f, 0.14118f),
+	Color(0.80784f, 0.62353f, 0.13725f),
+	Color(0.80784f, 0.61569f, 0.12941f),
+	Color(0.80392f, 0.60784f, 0.11373f),
+	Color(0.79608f, 0.60000f, 0.11373f),
+	Color(0.78431f, 0.59216f, 0.11765f),
+	Color(0.77647f, 0.58039f, 0.11765f),
+	Color(0.76863f, 0.57255f, 0.12157f),
+	Color(0.76078f, 0.56471f, 0.12157f),
+	Color(0.74902f, 0.55686f, 0.12549f),
+	Color(0.74118f, 0.54510f, 0.12549f),
+	Color(0.73333f, 0.53725f, 0.12941f),
+	Color(0.72549f, 0.52941f, 0.12941f),
+	Color(0.71373f, 0.52157f, 0.13333f),
+	Color(0.70588f, 0.50980f, 0.13333f),
+	Color(0.69804f, 0.50196f, 0.13725f),
+	Color(0.68627f, 0.49412f, 0.13725f),
+	Color(0.67843f, 0.48627f, 0.14118f),
+	Color(0.67059f, 0.47451f, 0.14118f),
+	Color(0.66275f, 0.46667f, 0.14510f),
+	Color(0.65098f, 0.45882f, 0.14510f),
+	Color(0.64314f, 0.45098f, 0.14902f),
+	Color(0.63529f, 0.43922f, 0.14902f),
+	Color(0.62353f, 0.43137f, 0.15294f),
+	Color(0.61569f, 0.42353f, 0.15294f),
+	Color(0.60784f, 0.41569f, 0.15686f),
+	Color(0.60000f, 0.40392f, 0.15686f),
+	Color(0.58824f, 0.39608f, 0.16078f),
+	Color(0.58039f, 0.38824f, 0.16078f),
+	Color(0.57255f, 0.38039f, 0.16471f),
+	Color(0.56471f, 0.36863f, 0.16471f),
+	Color(0.54510f, 0.35294f, 0.16863f),
+	Color(0.53725f, 0.34902f, 0.16471f),
+	Color(0.52941f, 0.34510f, 0.16471f),
+	Color(0.52157f, 0.33725f, 0.16078f),
+	Color(0.51373f, 0.33333f, 0.16078f),
+	Color(0.50588f, 0.32941f, 0.15686f),
+	Color(0.49804f, 0.32549f, 0.15294f),
+	Color(0.49020f, 0.31765f, 0.15294f),
+	Color(0.48627f, 0.31373f, 0.14902f),
+	Color(0.47843f, 0.30980f, 0.14902f),
+	Color(0.47059f, 0.30588f, 0.14510f),
+	Color(0.46275f, 0.29804f, 0.14510f),
+	Color(0.45490f, 0.29412f, 0.14118f),
+	Color(0.44706f, 0.29020f, 0.13725f),
+	Color(0.43922f, 0.28627f, 0.13725f),
+	Color(0.43137f, 0.27843f, 0.13333f),
+	Color(0.42353f, 0.27451f, 0.13333f),
+	Color(0.41569f, 0.27059f, 0.12941f),
+	Color(0.40784f, 0.26667f, 0.12549f),
+	Color(0.40000f, 0.25882f, 0.12549f),
+	Color(0.39216f, 0.25490f, 0.12157f),
+	Color(0.38431f, 0.25098f, 0.12157f),
+	Color(0.38039f, 0.24706f, 0.11765f),
+	Color(0.37255f, 0.23922f, 0.11765f),
+	Color(0.36471f, 0.23529f, 0.11373f),
+	Color(0.35686f, 0.23137f, 0.10980f),
+	Color(0.34902f, 0.22745f, 0.10980f),
+	Color(0.34118f, 0.21961f, 0.10588f),
+	Color(0.32549f, 0.21176f, 0.10196f),
+	Color(0.34902f, 0.23922f, 0.13333f),
+	Color(0.36863f, 0.26275f, 0.16471f),
+	Color(0.39216f, 0.29020f, 0.19608f),
+	Color(0.41569f, 0.31765f, 0.22745f),
+	Color(0.43529f, 0.34118f, 0.25490f),
+	Color(0.45882f, 0.36863f, 0.28627f),
+	Color(0.48235f, 0.39608f, 0.31765f),
+	Color(0.50588f, 0.42353f, 0.34902f),
+	Color(0.52549f, 0.44706f, 0.38039f),
+	Color(0.54902f, 0.47451f, 0.41176f),
+	Color(0.57255f, 0.50196f, 0.44314f),
+	Color(0.59216f, 0.52549f, 0.47451f),
+	Color(0.61569f, 0.55294f, 0.50588f),
+	Color(0.63922f, 0.58039f, 0.53725f),
+	Color(0.65882f, 0.60392f, 0.56471f),
+	Color(0.68235f, 0.63137f, 0.59608f),
+	Color(0.70588f, 0.65882f, 0.62745f),
+	Color(0.72549f, 0.68235f, 0.65882f),
+	Color(0.74902f, 0.70980f, 0.69020f),
+	Color(0.77255f, 0.73725f, 0.72157f),
+	Color(0.79216f, 0.76078f, 0.75294f),
+	Color(0.81569f, 0.78824f, 0.78431f),
+	Color(0.83922f, 0.81569f, 0.81569f),
+	Color(0.86275f, 0.84314f, 0.84706f),
+	Color(0.88235f, 0.86667f, 0.87451f),
+	Color(0.90588f, 0.89412f, 0.90588f),
+	Color(0.92941f, 0.92157f, 0.93725f),
+	Color(0.97255f, 0.97255f, 1.0000)
 }};
 
 // Generated from:
 // http://www.ncl.ucar.edu/Document/Graphics/ColorTables/Files/SVG_bhw3_22.rgb
 
-const std::array<const ci::Colorf, 220> SVGBhw322::palette{{
-	ci::Color(0.14118f, 0.078431f, 0.18039f),
-	ci::Color(0.14510f, 0.086275f, 0.19608f),
-	ci::Color(0.15294f, 0.098039f, 0.21176f),
-	ci::Color(0.15686f, 0.10980f, 0.22745f),
-	ci::Color(0.16471f, 0.12157f, 0.24314f),
-	ci::Color(0.17255f, 0.13333f, 0.25882f),
-	ci::Color(0.17647f, 0.14510f, 0.27451f),
-	ci::Color(0.18431f, 0.15686f, 0.29020f),
-	ci::Color(0.18824f, 0.16863f, 0.30588f),
-	ci::Color(0.19608f, 0.17647f, 0.32157f),
-	ci::Color(0.20392f, 0.18824f, 0.33725f),
-	ci::Color(0.20784f, 0.20000f, 0.35294f),
-	ci::Color(0.21569f, 0.21176f, 0.36863f),
-	ci::Color(0.22353f, 0.22353f, 0.38431f),
-	ci::Color(0.22745f, 0.23529f, 0.40000f),
-	ci::Color(0.23529f, 0.24706f, 0.41569f),
-	ci::Color(0.23922f, 0.25882f, 0.43137f),
-	ci::Color(0.24706f, 0.27059f, 0.44706f),
-	ci::Color(0.25490f, 0.27843f, 0.46275f),
-	ci::Color(0.25882f, 0.29020f, 0.47843f),
-	ci::Color(0.26667f, 0.30196f, 0.49412f),
-	ci::Color(0.27059f, 0.31373f, 0.50980f),
-	ci::Color(0.27843f, 0.32549f, 0.52549f),
-	ci::Color(0.28627f, 0.33725f, 0.54118f),
-	ci::Color(0.29020f, 0.34902f, 0.56078f),
-	ci::Color(0.29804f, 0.36078f, 0.57647f),
-	ci::Color(0.30588f, 0.36863f, 0.59216f),
-	ci::Color(0.30980f, 0.38039f, 0.60784f),
-	ci::Color(0.31765f, 0.39216f, 0.62353f),
-	ci::Color(0.32549f, 0.40000f, 0.63137f),
-	ci::Color(0.33333f, 0.40392f, 0.63529f),
-	ci::Color(0.34118f, 0.40784f, 0.63922f),
-	ci::Color(0.34902f, 0.41176f, 0.64314f),
-	ci::Color(0.35686f, 0.41569f, 0.64706f),
-	ci::Color(0.36471f, 0.41961f, 0.65098f),
-	ci::Color(0.37255f, 0.42353f, 0.65098f),
-	ci::Color(0.38039f, 0.42745f, 0.65490f),
-	ci::Color(0.38824f, 0.43137f, 0.65882f),
-	ci::Color(0.39608f, 0.43529f, 0.66275f),
-	ci::Color(0.40392f, 0.43922f, 0.66667f),
-	ci::Color(0.41176f, 0.44314f, 0.67059f),
-	ci::Color(0.41961f, 0.44706f, 0.67451f),
-	ci::Color(0.42745f, 0.45098f, 0.67843f),
-	ci::Color(0.43529f, 0.45490f, 0.68235f),
-	ci::Color(0.44314f, 0.45490f, 0.68627f),
-	ci::Color(0.45098f, 0.45882f, 0.69020f),
-	ci::Color(0.45882f, 0.46275f, 0.69412f),
-	ci::Color(0.46667f, 0.46667f, 0.69412f),
-	ci::Color(0.47451f, 0.47059f, 0.69804f),
-	ci::Color(0.47451f, 0.46667f, 0.69412f),
-	ci::Color(0.47059f, 0.46275f, 0.68627f),
-	ci::Color(0.46275f, 0.45490f, 0.67451f),
-	ci::Color(0.45882f, 0.44706f, 0.66667f),
-	ci::Color(0.45490f, 0.44314f, 0.65882f),
-	ci::Color(0.45098f, 0.43529f, 0.65098f),
-	ci::Color(0.44706f, 0.42745f, 0.64314f),
-	ci::Color(0.44314f, 0.42353f, 0.63529f),
-	ci::Color(0.43922f, 0.41569f, 0.62745f),
-	ci::Color(0.43529f, 0.40784f, 0.61569f),
-	ci::Color(0.43137f, 0.40392f, 0.60784f),
-	ci::Color(0.42745f, 0.39608f, 0.60000f),
-	ci::Color(0.42353f, 0.39216f, 0.59216f),
-	ci::Color(0.41961f, 0.38431f, 0.58431f),
-	ci::Color(0.41569f, 0.37647f, 0.57647f),
-	ci::Color(0.40784f, 0.37255f, 0.56471f),
-	ci::Color(0.40392f, 0.36471f, 0.55686f),
-	ci::Color(0.40000f, 0.35686f, 0.54902f),
-	ci::Color(0.39608f, 0.35294f, 0.54118f),
-	ci::Color(0.39216f, 0.34510f, 0.53333f),
-	ci::Color(0.38824f, 0.34118f, 0.52549f),
-	ci::Color(0.38431f, 0.33333f, 0.51765f),
-	ci::Color(0.38039f, 0.32549f, 0.50588f),
-	ci::Color(0.37647f, 0.32157f, 0.49804f),
-	ci::Color(0.37255f, 0.31373f, 0.49020f),
-	ci::Color(0.36863f, 0.30588f, 0.48235f),
-	ci::Color(0.36471f, 0.30196f, 0.47451f),
-	ci::Color(0.36078f, 0.29412f, 0.46667f),
-	ci::Color(0.35686f, 0.29020f, 0.45882f),
-	ci::Color(0.34902f, 0.28235f, 0.44706f),
-	ci::Color(0.34902f, 0.27843f, 0.44314f),
-	ci::Color(0.36471f, 0.29412f, 0.45882f),
-	ci::Color(0.38431f, 0.30980f, 0.47059f),
-	ci::Color(0.40000f, 0.32549f, 0.48627f),
-	ci::Color(0.41569f, 0.34510f, 0.50196f),
-	ci::Color(0.43529f, 0.36078f, 0.51765f),
-	ci::Color(0.45098f, 0.37647f, 0.52941f),
-	ci::Color(0.46667f, 0.39216f, 0.54510f),
-	ci::Color(0.48235f, 0.40784f, 0.56078f),
-	ci::Color(0.50196f, 0.42353f, 0.57255f),
-	ci::Color(0.51765f, 0.43922f, 0.58824f),
-	ci::Color(0.53333f, 0.45882f, 0.60392f),
-	ci::Color(0.55294f, 0.47451f, 0.61961f),
-	ci::Color(0.56863f, 0.49020f, 0.63137f),
-	ci::Color(0.58431f, 0.50588f, 0.64706f),
-	ci::Color(0.60392f, 0.52157f, 0.66275f),
-	ci::Color(0.61961f, 0.53725f, 0.67451f),
-	ci::Color(0.63529f, 0.55294f, 0.69020f),
-	ci::Color(0.65098f, 0.57255f, 0.70588f),
-	ci::Color(0.67059f, 0.58824f, 0.71765f),
-	ci::Color(0.68627f, 0.60392f, 0.73333f),
-	ci::Color(0.70196f, 0.61961f, 0.74902f),
-	ci::Color(0.72157f, 0.63529f, 0.76471f),
-	ci::Color(0.73725f, 0.65098f, 0.77647f),
-	ci::Color(0.75294f, 0.66667f, 0.79216f),
-	ci::Color(0.77255f, 0.68627f, 0.80784f),
-	ci::Color(0.78824f, 0.70196f, 0.81961f),
-	ci::Color(0.80392f, 0.71765f, 0.83529f),
-	ci::Color(0.81961f, 0.73333f, 0.85098f),
-	ci::Color(0.83922f, 0.74902f, 0.86667f),
-	ci::Color(0.85490f, 0.76471f, 0.87843f),
-	ci::Color(0.87059f, 0.78039f, 0.89412f),
-	ci::Color(0.89020f, 0.80000f, 0.90980f),
-	ci::Color(0.90588f, 0.81569f, 0.92157f),
-	ci::Color(0.92157f, 0.83137f, 0.93725f),
-	ci::Color(0.94118f, 0.84706f, 0.95294f),
-	ci::Color(0.95686f, 0.86275f, 0.96863f),
-	ci::Color(0.97255f, 0.87843f, 0.98039f),
-	ci::Color(0.96863f, 0.86667f, 0.96863f),
-	ci::Color(0.95686f, 0.85490f, 0.95294f),
-	ci::Color(0.94902f, 0.84314f, 0.93725f),
-	ci::Color(0.94118f, 0.82745f, 0.92157f),
-	ci::Color(0.93333f, 0.81569f, 0.90588f),
-	ci::Color(0.92549f, 0.80000f, 0.89020f),
-	ci::Color(0.91765f, 0.78824f, 0.87059f),
-	ci::Color(0.90588f, 0.77255f, 0.85490f),
-	ci::Color(0.89804f, 0.76078f, 0.83922f),
-	ci::Color(0.89020f, 0.74902f, 0.82353f),
-	ci::Color(0.88235f, 0.73333f, 0.80784f),
-	ci::Color(0.87451f, 0.72157f, 0.79216f),
-	ci::Color(0.86667f, 0.70588f, 0.77647f),
-	ci::Color(0.85882f, 0.69412f, 0.76078f),
-	ci::Color(0.84706f, 0.68235f, 0.74510f),
-	ci::Color(0.83922f, 0.66667f, 0.72941f),
-	ci::Color(0.83137f, 0.65490f, 0.71373f),
-	ci::Color(0.82353f, 0.63922f, 0.69804f),
-	ci::Color(0.81569f, 0.62745f, 0.68235f),
-	ci::Color(0.80784f, 0.61569f, 0.66667f),
-	ci::Color(0.80000f, 0.60000f, 0.65098f),
-	ci::Color(0.78824f, 0.58824f, 0.63529f),
-	ci::Color(0.78039f, 0.57255f, 0.61961f),
-	ci::Color(0.77255f, 0.56078f, 0.60392f),
-	ci::Color(0.76471f, 0.54510f, 0.58824f),
-	ci::Color(0.75686f, 0.53333f, 0.57255f),
-	ci::Color(0.74902f, 0.52157f, 0.55686f),
-	ci::Color(0.74118f, 0.50588f, 0.54118f),
-	ci::Color(0.74118f, 0.50196f, 0.52941f),
-	ci::Color(0.75294f, 0.50980f, 0.52157f),
-	ci::Color(0.76078f, 0.51765f, 0.51373f),
-	ci::Color(0.77255f, 0.52549f, 0.50588f),
-	ci::Color(0.78431f, 0.52941f, 0.49804f),
-	ci::Color(0.79608f, 0.53725f, 0.49020f),
-	ci::Color(0.80392f, 0.54510f, 0.48235f),
-	ci::Color(0.81569f, 0.55294f, 0.47451f),
-	ci::Color(0.82745f, 0.55686f, 0.47059f),
-	ci::Color(0.83529f, 0.56471f, 0.46275f),
-	ci::Color(0.84706f, 0.57255f, 0.45490f),
-	ci::Color(0.85882f, 0.58039f, 0.44706f),
-	ci::Color(0.87059f, 0.58824f, 0.43922f),
-	ci::Color(0.87843f, 0.59216f, 0.43137f),
-	ci::Color(0.89020f, 0.60000f, 0.42353f),
-	ci::Color(0.90196f, 0.60784f, 0.41569f),
-	ci::Color(0.91373f, 0.61569f, 0.40784f),
-	ci::Color(0.92157f, 0.61961f, 0.40392f),
-	ci::Color(0.91765f, 0.61176f, 0.40000f),
-	ci::Color(0.90980f, 0.60392f, 0.39608f),
-	ci::Color(0.90196f, 0.59216f, 0.39216f),
-	ci::Color(0.89804f, 0.58431f, 0.38824f),
-	ci::Color(0.89020f, 0.57255f, 0.38431f),
-	ci::Color(0.88235f, 0.56471f, 0.38039f),
-	ci::Color(0.87451f, 0.55686f, 0.37647f),
-	ci::Color(0.86667f, 0.54510f, 0.37255f),
-	ci::Color(0.86275f, 0.53725f, 0.36863f),
-	ci::Color(0.85490f, 0.52549f, 0.36471f),
-	ci::Color(0.84706f, 0.51765f, 0.36078f),
-	ci::Color(0.83922f, 0.50588f, 0.35686f),
-	ci::Color(0.83529f, 0.49804f, 0.35294f),
-	ci::Color(0.82745f, 0.49020f, 0.34902f),
-	ci::Color(0.81961f, 0.47843f, 0.34510f),
-	ci::Color(0.81176f, 0.47059f, 0.34118f),
-	ci::Color(0.80392f, 0.45882f, 0.33725f),
-	ci::Color(0.80000f, 0.45098f, 0.33333f),
-	ci::Color(0.79216f, 0.43922f, 0.32941f),
-	ci::Color(0.78431f, 0.43137f, 0.32549f),
-	ci::Color(0.76863f, 0.41961f, 0.31765f),
-	ci::Color(0.75686f, 0.40784f, 0.31373f),
-	ci::Color(0.74118f, 0.39608f, 0.30588f),
-	ci::Color(0.72941f, 0.38431f, 0.29804f),
-	ci::Color(0.71373f, 0.37255f, 0.29020f),
-	ci::Color(0.70196f, 0.36078f, 0.28235f),
-	ci::Color(0.69020f, 0.34902f, 0.27843f),
-	ci::Color(0.67451f, 0.33725f, 0.27059f),
-	ci::Color(0.66275f, 0.32549f, 0.26275f),
-	ci::Color(0.64706f, 0.31373f, 0.25490f),
-	ci::Color(0.63529f, 0.30196f, 0.25098f),
-	ci::Color(0.61961f, 0.29020f, 0.24314f),
-	ci::Color(0.60784f, 0.27843f, 0.23529f),
-	ci::Color(0.59216f, 0.26667f, 0.22745f),
-	ci::Color(0.58039f, 0.25490f, 0.21961f),
-	ci::Color(0.56471f, 0.24314f, 0.21569f),
-	ci::Color(0.55294f, 0.23137f, 0.20784f),
-	ci::Color(0.54118f, 0.21961f, 0.20000f),
-	ci::Color(0.52549f, 0.20784f, 0.19216f),
-	ci::Color(0.51373f, 0.20392f, 0.19216f),
-	ci::Color(0.50588f, 0.20392f, 0.20000f),
-	ci::Color(0.49804f, 0.20784f, 0.20784f),
-	ci::Color(0.48627f, 0.20784f, 0.21176f),
-	ci::Color(0.47843f, 0.21176f, 0.21961f),
-	ci::Color(0.47059f, 0.21176f, 0.22353f),
-	ci::Color(0.46275f, 0.21176f, 0.23137f),
-	ci::Color(0.45098f, 0.21569f, 0.23922f),
-	ci::Color(0.44314f, 0.21569f, 0.24314f),
-	ci::Color(0.43529f, 0.21961f, 0.25098f),
-	ci::Color(0.42353f, 0.21961f, 0.25490f),
-	ci::Color(0.41569f, 0.22353f, 0.26275f),
-	ci::Color(0.40784f, 0.22353f, 0.27059f),
-	ci::Color(0.40000f, 0.22745f, 0.27451f),
-	ci::Color(0.38824f, 0.22745f, 0.28235f),
-	ci::Color(0.38039f, 0.23137f, 0.28627f),
-	ci::Color(0.37255f, 0.23137f, 0.29412f),
-	ci::Color(0.36471f, 0.23529f, 0.30196f)
+const std::array<const Color, 220> SVGBhw322::palette{{
+	Color(0.14118f, 0.078431f, 0.18039f),
+	Color(0.14510f, 0.086275f, 0.19608f),
+	Color(0.15294f, 0.098039f, 0.21176f),
+	Color(0.15686f, 0.10980f, 0.22745f),
+	Color(0.16471f, 0.12157f, 0.24314f),
+	Color(0.17255f, 0.13333f, 0.25882f),
+	Color(0.17647f, 0.14510f, 0.27451f),
+	Color(0.18431f, 0.15686f, 0.29020f),
+	Color(0.18824f, 0.16863f, 0.30588f),
+	Color(0.19608f, 0.17647f, 0.32157f),
+	Color(0.20392f, 0.18824f, 0.33725f),
+	Color(0.20784f, 0.20000f, 0.35294f),
+	Color(0.21569f, 0.21176f, 0.36863f),
+	Color(0.22353f, 0.22353f, 0.38431f),
+	Color(0.22745f, 0.23529f, 0.40000f),
+	Color(0.23529f, 0.24706f, 0.41569f),
+	Color(0.23922f, 0.25882f, 0.43137f),
+	Color(0.24706f, 0.27059f, 0.44706f),
+	Color(0.25490f, 0.27843f, 0.46275f),
+	Color(0.25882f, 0.29020f, 0.47843f),
+	Color(0.26667f, 0.30196f, 0.49412f),
+	Color(0.27059f, 0.31373f, 0.50980f),
+	Color(0.27843f, 0.32549f, 0.52549f),
+	Color(0.28627f, 0.33725f, 0.54118f),
+	Color(0.29020f, 0.34902f, 0.56078f),
+	Color(0.29804f, 0.36078f, 0.57647f),
+	Color(0.30588f, 0.36863f, 0.59216f),
+	Color(0.30980f, 0.38039f, 0.60784f),
+	Color(0.31765f, 0.39216f, 0.62353f),
+	Color(0.32549f, 0.40000f, 0.63137f),
+	Color(0.33333f, 0.40392f, 0.63529f),
+	Color(0.34118f, 0.40784f, 0.63922f),
+	Color(0.34902f, 0.41176f, 0.64314f),
+	Color(0.35686f, 0.41569f, 0.64706f),
+	Color(0.36471f, 0.41961f, 0.65098f),
+	Color(0.37255f, 0.42353f, 0.65098f),
+	Color(0.38039f, 0.42745f, 0.65490f),
+	Color(0.38824f, 0.43137f, 0.65882f),
+	Color(0.39608f, 0.43529f, 0.66275f),
+	Color(0.40392f, 0.43922f, 0.66667f),
+	Color(0.41176f, 0.44314f, 0.67059f),
+	Color(0.41961f, 0.44706f, 0.67451f),
+	Color(0.42745f, 0.45098f, 0.67843f),
+	Color(0.43529f, 0.45490f, 0.68235f),
+	Color(0.44314f, 0.45490f, 0.68627f),
+	Color(0.45098f, 0.45882f, 0.69020f),
+	Color(0.45882f, 0.46275f, 0.69412f),
+	Color(0.46667f, 0.46667f, 0.69412f),
+	Color(0.47451f, 0.47059f, 0.69804f),
+	Color(0.47451f, 0.46667f, 0.69412f),
+	Color(0.47059f, 0.46275f, 0.68627f),
+	Color(0.46275f, 0.45490f, 0.67451f),
+	Color(0.45882f, 0.44706f, 0.66667f),
+	Color(0.45490f, 0.44314f, 0.65882f),
+	Color(0.45098f, 0.43529f, 0.65098f),
+	Color(0.44706f, 0.42745f, 0.64314f),
+	Color(0.44314f, 0.42353f, 0.63529f),
+	Color(0.43922f, 0.41569f, 0.62745f),
+	Color(0.43529f, 0.40784f, 0.61569f),
+	Color(0.43137f, 0.40392f, 0.60784f),
+	Color(0.42745f, 0.39608f, 0.60000f),
+	Color(0.42353f, 0.39216f, 0.59216f),
+	Color(0.41961f, 0.38431f, 0.58431f),
+	Color(0.41569f, 0.37647f, 0.57647f),
+	Color(0.40784f, 0.37255f, 0.56471f),
+	Color(0.40392f, 0.36471f, 0.55686f),
+	Color(0.40000f, 0.35686f, 0.54902f),
+	Color(0.39608f, 0.35294f, 0.54118f),
+	Color(0.39216f, 0.34510f, 0.53333f),
+	Color(0.38824f, 0.34118f, 0.52549f),
+	Color(0.38431f, 0.33333f, 0.51765f),
+	Color(0.38039f, 0.32549f, 0.50588f),
+	Color(0.37647f, 0.32157f, 0.49804f),
+	Color(0.37255f, 0.31373f, 0.49020f),
+	Color(0.36863f, 0.30588f, 0.48235f),
+	Color(0.36471f, 0.30196f, 0.47451f),
+	Color(0.36078f, 0.29412f, 0.46667f),
+	Color(0.35686f, 0.29020f, 0.45882f),
+	Color(0.34902f, 0.28235f, 0.44706f),
+	Color(0.34902f, 0.27843f, 0.44314f),
+	Color(0.36471f, 0.29412f, 0.45882f),
+	Color(0.38431f, 0.30980f, 0.47059f),
+	Color(0.40000f, 0.32549f, 0.48627f),
+	Color(0.41569f, 0.34510f, 0.50196f),
+	Color(0.43529f, 0.36078f, 0.51765f),
+	Color(0.45098f, 0.37647f, 0.52941f),
+	Color(0.46667f, 0.39216f, 0.54510f),
+	Color(0.48235f, 0.40784f, 0.56078f),
+	Color(0.50196f, 0.42353f, 0.57255f),
+	Color(0.51765f, 0.43922f, 0.58824f),
+	Color(0.53333f, 0.45882f, 0.60392f),
+	Color(0.55294f, 0.47451f, 0.61961f),
+	Color(0.56863f, 0.49020f, 0.63137f),
+	Color(0.58431f, 0.50588f, 0.64706f),
+	Color(0.60392f, 0.52157f, 0.66275f),
+	Color(0.61961f, 0.53725f, 0.67451f),
+	Color(0.63529f, 0.55294f, 0.69020f),
+	Color(0.65098f, 0.57255f, 0.70588f),
+	Color(0.67059f, 0.58824f, 0.71765f),
+	Color(0.68627f, 0.60392f, 0.73333f),
+	Color(0.70196f, 0.61961f, 0.74902f),
+	Color(0.72157f, 0.63529f, 0.76471f),
+	Color(0.73725f, 0.65098f, 0.77647f),
+	Color(0.75294f, 0.66667f, 0.79216f),
+	Color(0.77255f, 0.68627f, 0.80784f),
+	Color(0.78824f, 0.70196f, 0.81961f),
+	Color(0.80392f, 0.71765f, 0.83529f),
+	Color(0.81961f, 0.73333f, 0.85098f),
+	Color(0.83922f, 0.74902f, 0.86667f),
+	Color(0.85490f, 0.76471f, 0.87843f),
+	Color(0.87059f, 0.78039f, 0.89412f),
+	Color(0.89020f, 0.80000f, 0.90980f),
+	Color(0.90588f, 0.81569f, 0.92157f),
+	Color(0.92157f, 0.83137f, 0.93725f),
+	Color(0.94118f, 0.84706f, 0.95294f),
+	Color(0.95686f, 0.86275f, 0.96863f),
+	Color(0.97255f, 0.87843f, 0.98039f),
+	Color(0.96863f, 0.86667f, 0.96863f),
+	Color(0.95686f, 0.85490f, 0.95294f),
+	Color(0.94902f, 0.84314f, 0.93725f),
+	Color(0.94118f, 0.82745f, 0.92157f),
+	Color(0.93333f, 0.81569f, 0.90588f),
+	Color(0.92549f, 0.80000f, 0.89020f),
+	Color(0.91765f, 0.78824f, 0.87059f),
+	Color(0.90588f, 0.77255f, 0.85490f),
+	Color(0.89804f, 0.76078f, 0.83922f),
+	Color(0.89020f, 0.74902f, 0.82353f),
+	Color(0.88235f, 0.73333f, 0.80784f),
+	Color(0.87451f, 0.72157f, 0.79216f),
+	Color(0.86667f, 0.70588f, 0.77647f),
+	Color(0.85882f, 0.69412f, 0.76078f),
+	Color(0.84706f, 0.68235f, 0.74510f),
+	Color(0.83922f, 0.66667f, 0.72941f),
+	Color(0.83137f, 0.65490f, 0.71373f),
+	Color(0.82353f, 0.63922f, 0.69804f),
+	Color(0.81569f, 0.62745f, 0.68235f),
+	Color(0.80784f, 0.61569f, 0.66667f),
+	Color(0.80000f, 0.60000f, 0.65098f),
+	Color(0.78824f, 0.58824f, 0.63529f),
+	Color(0.78039f, 0.57255f, 0.61961f),
+	Color(0.77255f, 0.56078f, 0.60392f),
+	Color(0.76471f, 0.54510f, 0.58824f),
+	Color(0.75686f, 0.53333f, 0.57255f),
+	Color(0.74902f, 0.52157f, 0.55686f),
+	Color(0.74118f, 0.50588f, 0.54118f),
+	Color(0.74118f, 0.50196f, 0.52941f),
+	Color(0.75294f, 0.50980f, 0.52157f),
+	Color(0.76078f, 0.51765f, 0.51373f),
+	Color(0.77255f, 0.52549f, 0.50588f),
+	Color(0.78431f, 0.52941f, 0.49804f),
+	Color(0.79608f, 0.53725f, 0.49020f),
+	Color(0.80392f, 0.54510f, 0.48235f),
+	Color(0.81569f, 0.55294f, 0.47451f),
+	Color(0.82745f, 0.55686f, 0.47059f),
+	Color(0.83529f, 0.56471f, 0.46275f),
+	Color(0.84706f, 0.57255f, 0.45490f),
+	Color(0.85882f, 0.58039f, 0.44706f),
+	Color(0.87059f, 0.58824f, 0.43922f),
+	Color(0.87843f, 0.59216f, 0.43137f),
+	Color(0.89020f, 0.60000f, 0.42353f),
+	Color(0.90196f, 0.60784f, 0.41569f),
+	Color(0.91373f, 0.61569f, 0.40784f),
+	Color(0.92157f, 0.61961f, 0.40392f),
+	Color(0.91765f, 0.61176f, 0.40000f),
+	Color(0.90980f, 0.60392f, 0.39608f),
+	Color(0.90196f, 0.59216f, 0.39216f),
+	Color(0.89804f, 0.58431f, 0.38824f),
+	Color(0.89020f, 0.57255f, 0.38431f),
+	Color(0.88235f, 0.56471f, 0.38039f),
+	Color(0.87451f, 0.55686f, 0.37647f),
+	Color(0.86667f, 0.54510f, 0.37255f),
+	Color(0.86275f, 0.53725f, 0.36863f),
+	Color(0.85490f, 0.52549f, 0.36471f),
+	Color(0.84706f, 0.51765f, 0.36078f),
+	Color(0.83922f, 0.50588f, 0.35686f),
+	Color(0.83529f, 0.49804f, 0.35294f),
+	Color(0.82745f, 0.49020f, 0.34902f),
+	Color(0.81961f, 0.47843f, 0.34510f),
+	Color(0.81176f, 0.47059f, 0.34118f),
+	Color(0.80392f, 0.45882f, 0.33725f),
+	Color(0.80000f, 0.45098f, 0.33333f),
+	Color(0.79216f, 0.43922f, 0.32941f),
+	Color(0.78431f, 0.43137f, 0.32549f),
+	Color(0.76863f, 0.41961f, 0.31765f),
+	Color(0.75686f, 0.40784f, 0.31373f),
+	Color(0.74118f, 0.39608f, 0.30588f),
+	Color(0.72941f, 0.38431f, 0.29804f),
+	Color(0.71373f, 0.37255f, 0.29020f),
+	Color(0.70196f, 0.36078f, 0.28235f),
+	Color(0.69020f, 0.34902f, 0.27843f),
+	Color(0.67451f, 0.33725f, 0.27059f),
+	Color(0.66275f, 0.32549f, 0.26275f),
+	Color(0.64706f, 0.31373f, 0.25490f),
+	Color(0.63529f, 0.30196f, 0.25098f),
+	Color(0.61961f, 0.29020f, 0.24314f),
+	Color(0.60784f, 0.27843f, 0.23529f),
+	Color(0.59216f, 0.26667f, 0.22745f),
+	Color(0.58039f, 0.25490f, 0.21961f),
+	Color(0.56471f, 0.24314f, 0.21569f),
+	Color(0.55294f, 0.23137f, 0.20784f),
+	Color(0.54118f, 0.21961f, 0.20000f),
+	Color(0.52549f, 0.20784f, 0.19216f),
+	Color(0.51373f, 0.20392f, 0.19216f),
+	Color(0.50588f, 0.20392f, 0.20000f),
+	Color(0.49804f, 0.20784f, 0.20784f),
+	Color(0.48627f, 0.20784f, 0.21176f),
+	Color(0.47843f, 0.21176f, 0.21961f),
+	Color(0.47059f, 0.21176f, 0.22353f),
+	Color(0.46275f, 0.21176f, 0.23137f),
+	Color(0.45098f, 0.21569f, 0.23922f),
+	Color(0.44314f, 0.21569f, 0.24314f),
+	Color(0.43529f, 0.21961f, 0.25098f),
+	Color(0.42353f, 0.21961f, 0.25490f),
+	Color(0.41569f, 0.22353f, 0.26275f),
+	Color(0.40784f, 0.22353f, 0.27059f),
+	Color(0.40000f, 0.22745f, 0.27451f),
+	Color(0.38824f, 0.22745f, 0.28235f),
+	Color(0.38039f, 0.23137f, 0.28627f),
+	Color(0.37255f, 0.23137f, 0.29412f),
+	Color(0.36471f, 0.23529f, 0.30196f)
 }};
 
 // Generated from:
 // http://www.ncl.ucar.edu/Document/Graphics/ColorTables/Files/MPL_gnuplot.rgb
 
-const std::array<const ci::Colorf, 128> MPLGnuplot::palette{{
-	ci::Color(0.062622f, 0.000000f, 0.024637f),
-	ci::Color(0.108465f, 0.000002f, 0.073853f),
-	ci::Color(0.140028f, 0.000008f, 0.122888f),
-	ci::Color(0.165683f, 0.000021f, 0.171626f),
-	ci::Color(0.187867f, 0.000044f, 0.219946f),
-	ci::Color(0.207695f, 0.000080f, 0.267733f),
-	ci::Color(0.225788f, 0.000132f, 0.314870f),
-	ci::Color(0.242536f, 0.000204f, 0.361242f),
-	ci::Color(0.258199f, 0.000296f, 0.406737f),
-	ci::Color(0.265684f, 0.000352f, 0.429121f),
-	ci::Color(0.286972f, 0.000559f, 0.494656f),
-	ci::Color(0.293725f, 0.000642f, 0.515918f),
-	ci::Color(0.313112f, 0.000942f, 0.577774f),
-	ci::Color(0.319313f, 0.001060f, 0.597707f),
-	ci::Color(0.337232f, 0.001471f, 0.655284f),
-	ci::Color(0.342997f, 0.001628f, 0.673696f),
-	ci::Color(0.359738f, 0.002167f, 0.726434f),
-	ci::Color(0.370479f, 0.002586f, 0.759405f),
-	ci::Color(0.375735f, 0.002814f, 0.775204f),
-	ci::Color(0.391077f, 0.003577f, 0.819740f),
-	ci::Color(0.400979f, 0.004157f, 0.846958f),
-	ci::Color(0.410643f, 0.004795f, 0.872120f),
-	ci::Color(0.415390f, 0.005137f, 0.883910f),
-	ci::Color(0.429318f, 0.006261f, 0.916034f),
-	ci::Color(0.438357f, 0.007095f, 0.934680f),
-	ci::Color(0.447214f, 0.008000f, 0.951057f),
-	ci::Color(0.451577f, 0.008480f, 0.958381f),
-	ci::Color(0.464420f, 0.010034f, 0.976848f),
-	ci::Color(0.472789f, 0.011169f, 0.986201f),
-	ci::Color(0.481012f, 0.012386f, 0.993159f),
-	ci::Color(0.485071f, 0.013027f, 0.995734f),
-	ci::Color(0.497050f, 0.015080f, 0.999829f),
-	ci::Color(0.504878f, 0.016562f, 0.999526f),
-	ci::Color(0.512587f, 0.018139f, 0.996795f),
-	ci::Color(0.520181f, 0.019812f, 0.991645f),
-	ci::Color(0.527666f, 0.021585f, 0.984086f),
-	ci::Color(0.535046f, 0.023461f, 0.974139f),
-	ci::Color(0.538699f, 0.024439f, 0.968276f),
-	ci::Color(0.549510f, 0.027533f, 0.947177f),
-	ci::Color(0.556600f, 0.029735f, 0.930229f),
-	ci::Color(0.563602f, 0.032050f, 0.911023f),
-	ci::Color(0.570517f, 0.034484f, 0.889604f),
-	ci::Color(0.577350f, 0.037037f, 0.866025f),
-	ci::Color(0.584103f, 0.039713f, 0.840344f),
-	ci::Color(0.590779f, 0.042516f, 0.812622f),
-	ci::Color(0.594089f, 0.043965f, 0.798017f),
-	ci::Color(0.603909f, 0.048510f, 0.751332f),
-	ci::Color(0.610368f, 0.051707f, 0.717912f),
-	ci::Color(0.616759f, 0.055042f, 0.682749f),
-	ci::Color(0.623085f, 0.058517f, 0.645928f),
-	ci::Color(0.629348f, 0.062136f, 0.607539f),
-	ci::Color(0.635548f, 0.065901f, 0.567675f),
-	ci::Color(0.641689f, 0.069815f, 0.526432f),
-	ci::Color(0.644737f, 0.071829f, 0.505325f),
-	ci::Color(0.653797f, 0.078101f, 0.440216f),
-	ci::Color(0.659768f, 0.082480f, 0.395451f),
-	ci::Color(0.665686f, 0.087019f, 0.349727f),
-	ci::Color(0.671551f, 0.091722f, 0.303153f),
-	ci::Color(0.677365f, 0.096591f, 0.255843f),
-	ci::Color(0.683130f, 0.101630f, 0.207912f),
-	ci::Color(0.688847f, 0.106840f, 0.159476f),
-	ci::Color(0.691687f, 0.109511f, 0.135105f),
-	ci::Color(0.700140f, 0.117790f, 0.061561f),
-	ci::Color(0.705719f, 0.123535f, 0.012320f),
-	ci::Color(0.711254f, 0.129464f, 0.000000f),
-	ci::Color(0.716746f, 0.135579f, 0.000000f),
-	ci::Color(0.722197f, 0.141884f, 0.000000f),
-	ci::Color(0.727607f, 0.148382f, 0.000000f),
-	ci::Color(0.732977f, 0.155075f, 0.000000f),
-	ci::Color(0.738308f, 0.161966f, 0.000000f),
-	ci::Color(0.743600f, 0.169058f, 0.000000f),
-	ci::Color(0.748855f, 0.176355f, 0.000000f),
-	ci::Color(0.754074f, 0.183858f, 0.000000f),
-	ci::Color(0.759257f, 0.191572f, 0.000000f),
-	ci::Color(0.764404f, 0.199498f, 0.000000f),
-	ci::Color(0.766965f, 0.203542f, 0.000000f),
-	ci::Color(0.774597f, 0.216000f, 0.000000f),
-	ci::Color(0.779643f, 0.224582f, 0.000000f),
-	ci::Color(0.784657f, 0.233388f, 0.000000f),
-	ci::Color(0.789639f, 0.242421f, 0.000000f),
-	ci::Color(0.794590f, 0.251685f, 0.000000f),
-	ci::Color(0.799510f, 0.261181f, 0.000000f),
-	ci::Color(0.804400f, 0.270914f, 0.000000f),
-	ci::Color(0.809260f, 0.280885f, 0.000000f),
-	ci::Color(0.814092f, 0.291098f, 0.000000f),
-	ci::Color(0.818895f, 0.301556f, 0.000000f),
-	ci::Color(0.823669f, 0.312261f, 0.000000f),
-	ci::Color(0.828417f, 0.323217f, 0.000000f),
-	ci::Color(0.833137f, 0.334425f, 0.000000f),
-	ci::Color(0.837831f, 0.345890f, 0.000000f),
-	ci::Color(0.842499f, 0.357615f, 0.000000f),
-	ci::Color(0.844823f, 0.363575f, 0.000000f),
-	ci::Color(0.851757f, 0.381852f, 0.000000f),
-	ci::Color(0.856349f, 0.394370f, 0.000000f),
-	ci::Color(0.860916f, 0.407160f, 0.000000f),
-	ci::Color(0.865459f, 0.420223f, 0.000000f),
-	ci::Color(0.869979f, 0.433562f, 0.000000f),
-	ci::Color(0.874475f, 0.447181f, 0.000000f),
-	ci::Color(0.878948f, 0.461082f, 0.000000f),
-	ci::Color(0.883398f, 0.475268f, 0.000000f),
-	ci::Color(0.887826f, 0.489742f, 0.000000f),
-	ci::Color(0.892232f, 0.504507f, 0.000000f),
-	ci::Color(0.896617f, 0.519566f, 0.000000f),
-	ci::Color(0.900980f, 0.534922f, 0.000000f),
-	ci::Color(0.905322f, 0.550577f, 0.000000f),
-	ci::Color(0.909643f, 0.566535f, 0.000000f),
-	ci::Color(0.913944f, 0.582798f, 0.000000f),
-	ci::Color(0.916087f, 0.591045f, 0.000000f),
-	ci::Color(0.922486f, 0.616252f, 0.000000f),
-	ci::Color(0.926727f, 0.633449f, 0.000000f),
-	ci::Color(0.930949f, 0.650963f, 0.000000f),
-	ci::Color(0.935152f, 0.668797f, 0.000000f),
-	ci::Color(0.939336f, 0.686953f, 0.000000f),
-	ci::Color(0.943502f, 0.705435f, 0.000000f),
-	ci::Color(0.947649f, 0.724246f, 0.000000f),
-	ci::Color(0.951779f, 0.743388f, 0.000000f),
-	ci::Color(0.955890f, 0.762864f, 0.000000f),
-	ci::Color(0.959984f, 0.782678f, 0.000000f),
-	ci::Color(0.964060f, 0.802832f, 0.000000f),
-	ci::Color(0.968119f, 0.823329f, 0.000000f),
-	ci::Color(0.972162f, 0.844171f, 0.000000f),
-	ci::Color(0.976187f, 0.865363f, 0.000000f),
-	ci::Color(0.980196f, 0.886906f, 0.000000f),
-	ci::Color(0.982194f, 0.897811f, 0.000000f),
-	ci::Color(0.988165f, 0.931060f, 0.000000f),
-	ci::Color(0.992126f, 0.953675f, 0.000000f),
-	ci::Color(0.996071f, 0.976655f, 0.000000f),
-	ci::Color(1.000000f, 1.000000f, 0.000000)
+const std::array<const Color, 128> MPLGnuplot::palette{{
+	Color(0.062622f, 0.000000f, 0.024637f),
+	Color(0.108465f, 0.000002f, 0.073853f),
+	Color(0.140028f, 0.000008f, 0.122888f),
+	Color(0.165683f, 0.000021f, 0.171626f),
+	Color(0.187867f, 0.000044f, 0.219946f),
+	Color(0.207695f, 0.000080f, 0.267733f),
+	Color(0.225788f, 0.000132f, 0.314870f),
+	Color(0.242536f, 0.000204f, 0.361242f),
+	Color(0.258199f, 0.000296f, 0.406737f),
+	Color(0.265684f, 0.000352f, 0.429121f),
+	Color(0.286972f, 0.000559f, 0.494656f),
+	Color(0.293725f, 0.000642f, 0.515918f),
+	Color(0.313112f, 0.000942f, 0.577774f),
+	Color(0.319313f, 0.001060f, 0.597707f),
+	Color(0.337232f, 0.001471f, 0.655284f),
+	Color(0.342997f, 0.001628f, 0.673696f),
+	Color(0.359738f, 0.002167f, 0.726434f),
+	Color(0.370479f, 0.002586f, 0.759405f),
+	Color(0.375735f, 0.002814f, 0.775204f),
+	Color(0.391077f, 0.003577f, 0.819740f),
+	Color(0.400979f, 0.004157f, 0.846958f),
+	Color(0.410643f, 0.004795f, 0.872120f),
+	Color(0.415390f, 0.005137f, 0.883910f),
+	Color(0.429318f, 0.006261f, 0.916034f),
+	Color(0.438357f, 0.007095f, 0.934680f),
+	Color(0.447214f, 0.008000f, 0.951057f),
+	Color(0.451577f, 0.008480f, 0.958381f),
+	Color(0.464420f, 0.010034f, 0.976848f),
+	Color(0.472789f, 0.011169f, 0.986201f),
+	Color(0.481012f, 0.012386f, 0.993159f),
+	Color(0.485071f, 0.013027f, 0.995734f),
+	Color(0.497050f, 0.015080f, 0.999829f),
+	Color(0.504878f, 0.016562f, 0.999526f),
+	Color(0.512587f, 0.018139f, 0.996795f),
+	Color(0.520181f, 0.019812f, 0.991645f),
+	Color(0.527666f, 0.021585f, 0.984086f),
+	Color(0.535046f, 0.023461f, 0.974139f),
+	Color(0.538699f, 0.024439f, 0.968276f),
+	Color(0.549510f, 0.027533f, 0.947177f),
+	Color(0.556600f, 0.029735f, 0.930229f),
+	Color(0.563602f, 0.032050f, 0.911023f),
+	Color(0.570517f, 0.034484f, 0.889604f),
+	Color(0.577350f, 0.037037f, 0.866025f),
+	Color(0.584103f, 0.039713f, 0.840344f),
+	Color(0.590779f, 0.042516f, 0.812622f),
+	Color(0.594089f, 0.043965f, 0.798017f),
+	Color(0.603909f, 0.048510f, 0.751332f),
+	Color(0.610368f, 0.051707f, 0.717912f),
+	Color(0.616759f, 0.055042f, 0.682749f),
+	Color(0.623085f, 0.058517f, 0.645928f),
+	Color(0.629348f, 0.062136f, 0.607539f),
+	Color(0.635548f, 0.065901f, 0.567675f),
+	Color(0.641689f, 0.069815f, 0.526432f),
+	Color(0.644737f, 0.071829f, 0.505325f),
+	Color(0.653797f, 0.078101f, 0.440216f),
+	Color(0.659768f, 0.082480f, 0.395451f),
+	Color(0.665686f, 0.087019f, 0.349727f),
+	Color(0.671551f, 0.091722f, 0.303153f),
+	Color(0.677365f, 0.096591f, 0.255843f),
+	Color(0.683130f, 0.101630f, 0.207912f),
+	Color(0.688847f, 0.106840f, 0.159476f),
+	Color(0.691687f, 0.109511f, 0.135105f),
+	Color(0.700140f, 0.117790f, 0.061561f),
+	Color(0.705719f, 0.123535f, 0.012320f),
+	Color(0.711254f, 0.129464f, 0.000000f),
+	Color(0.716746f, 0.135579f, 0.000000f),
+	Color(0.722197f, 0.141884f, 0.000000f),
+	Color(0.727607f, 0.148382f, 0.000000f),
+	Color(0.732977f, 0.155075f, 0.000000f),
+	Color(0.738308f, 0.161966f, 0.000000f),
+	Color(0.743600f, 0.169058f, 0.000000f),
+	Color(0.748855f, 0.176355f, 0.000000f),
+	Color(0.754074f, 0.183858f, 0.000000f),
+	Color(0.759257f, 0.191572f, 0.000000f),
+	Color(0.764404f, 0.199498f, 0.000000f),
+	Color(0.766965f, 0.203542f, 0.000000f),
+	Color(0.774597f, 0.216000f, 0.000000f),
+	Color(0.779643f, 0.224582f, 0.000000f),
+	Color(0.784657f, 0.233388f, 0.000000f),
+	Color(0.789639f, 0.242421f, 0.000000f),
+	Color(0.794590f, 0.251685f, 0.000000f),
+	Color(0.799510f, 0.261181f, 0.000000f),
+	Color(0.804400f, 0.270914f, 0.000000f),
+	Color(0.809260f, 0.280885f, 0.000000f),
+	Color(0.814092f, 0.291098f, 0.000000f),
+	Color(0.818895f, 0.301556f, 0.000000f),
+	Color(0.823669f, 0.312261f, 0.000000f),
+	Color(0.828417f, 0.323217f, 0.000000f),
+	Color(0.833137f, 0.334425f, 0.000000f),
+	Color(0.837831f, 0.345890f, 0.000000f),
+	Color(0.842499f, 0.357615f, 0.000000f),
+	Color(0.844823f, 0.363575f, 0.000000f),
+	Color(0.851757f, 0.381852f, 0.000000f),
+	Color(0.856349f, 0.394370f, 0.000000f),
+	Color(0.860916f, 0.407160f, 0.000000f),
+	Color(0.865459f, 0.420223f, 0.000000f),
+	Color(0.869979f, 0.433562f, 0.000000f),
+	Color(0.874475f, 0.447181f, 0.000000f),
+	Color(0.878948f, 0.461082f, 0.000000f),
+	Color(0.883398f, 0.475268f, 0.000000f),
+	Color(0.887826f, 0.489742f, 0.000000f),
+	Color(0.892232f, 0.504507f, 0.000000f),
+	Color(0.896617f, 0.519566f, 0.000000f),
+	Color(0.900980f, 0.534922f, 0.000000f),
+	Color(0.905322f, 0.550577f, 0.000000f),
+	Color(0.909643f, 0.566535f, 0.000000f),
+	Color(0.913944f, 0.582798f, 0.000000f),
+	Color(0.916087f, 0.591045f, 0.000000f),
+	Color(0.922486f, 0.616252f, 0.000000f),
+	Color(0.926727f, 0.633449f, 0.000000f),
+	Color(0.930949f, 0.650963f, 0.000000f),
+	Color(0.935152f, 0.668797f, 0.000000f),
+	Color(0.939336f, 0.686953f, 0.000000f),
+	Color(0.943502f, 0.705435f, 0.000000f),
+	Color(0.947649f, 0.724246f, 0.000000f),
+	Color(0.951779f, 0.743388f, 0.000000f),
+	Color(0.955890f, 0.762864f, 0.000000f),
+	Color(0.959984f, 0.782678f, 0.000000f),
+	Color(0.964060f, 0.802832f, 0.000000f),
+	Color(0.968119f, 0.823329f, 0.000000f),
+	Color(0.972162f, 0.844171f, 0.000000f),
+	Color(0.976187f, 0.865363f, 0.000000f),
+	Color(0.980196f, 0.886906f, 0.000000f),
+	Color(0.982194f, 0.897811f, 0.000000f),
+	Color(0.988165f, 0.931060f, 0.000000f),
+	Color(0.992126f, 0.953675f, 0.000000f),
+	Color(0.996071f, 0.976655f, 0.000000f),
+	Color(1.000000f, 1.000000f, 0.000000)
 }};
 
 // Generated from:
 // http://www.ncl.ucar.edu/Document/Graphics/ColorTables/Files/MPL_flag.rgb
 
-const std::array<const ci::Colorf, 128> MPLFlag::palette{{
-	ci::Color(1.000000f, 0.378411f, 0.209789f),
-	ci::Color(1.000000f, 0.918487f, 0.777382f),
-	ci::Color(0.802941f, 0.932472f, 1.000000f),
-	ci::Color(0.235542f, 0.412356f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.815567f),
-	ci::Color(0.000000f, 0.000000f, 0.248556f),
-	ci::Color(0.171914f, 0.000000f, 0.000000f),
-	ci::Color(0.738344f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.309017f, 0.159507f),
-	ci::Color(1.000000f, 0.645928f, 0.437702f),
-	ci::Color(0.852783f, 0.956604f, 1.000000f),
-	ci::Color(0.576099f, 0.775204f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.864953f),
-	ci::Color(0.000000f, 0.000000f, 0.589873f),
-	ci::Color(0.123001f, 0.000000f, 0.000000f),
-	ci::Color(0.396383f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.237935f, 0.111085f),
-	ci::Color(1.000000f, 0.850217f, 0.671713f),
-	ci::Color(1.000000f, 0.986201f, 0.935214f),
-	ci::Color(0.341807f, 0.542053f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.912346f),
-	ci::Color(0.000000f, 0.000000f, 0.355382f),
-	ci::Color(0.000000f, 0.000000f, 0.087654f),
-	ci::Color(0.630994f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.165554f, 0.064786f),
-	ci::Color(1.000000f, 0.809017f, 0.617326f),
-	ci::Color(1.000000f, 0.971281f, 0.888915f),
-	ci::Color(0.396383f, 0.602635f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.957487f),
-	ci::Color(0.000000f, 0.000000f, 0.410127f),
-	ci::Color(0.000000f, 0.000000f, 0.135047f),
-	ci::Color(0.576099f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.092268f, 0.020865f),
-	ci::Color(1.000000f, 0.763398f, 0.562298f),
-	ci::Color(0.989716f, 0.997269f, 1.000000f),
-	ci::Color(0.451524f, 0.659925f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.751444f),
-	ci::Color(0.000000f, 0.000000f, 0.000000f),
-	ci::Color(0.520787f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.018479f, 0.000000f),
-	ci::Color(1.000000f, 0.713610f, 0.506930f),
-	ci::Color(1.000000f, 1.000000f, 1.000000f),
-	ci::Color(0.506930f, 0.713610f, 1.000000f),
-	ci::Color(0.000000f, 0.018479f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.802941f),
-	ci::Color(0.000000f, 0.000000f, 0.000000f),
-	ci::Color(0.465362f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.659925f, 0.451524f),
-	ci::Color(1.000000f, 0.997269f, 0.989716f),
-	ci::Color(0.562298f, 0.763398f, 1.000000f),
-	ci::Color(0.020865f, 0.092268f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.852783f),
-	ci::Color(0.000000f, 0.000000f, 0.031609f),
-	ci::Color(0.410127f, 0.000000f, 0.000000f),
-	ci::Color(0.957487f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.602635f, 0.396383f),
-	ci::Color(1.000000f, 0.989092f, 0.946427f),
-	ci::Color(0.617326f, 0.809017f, 1.000000f),
-	ci::Color(0.064786f, 0.165554f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.900699f),
-	ci::Color(0.000000f, 0.000000f, 0.076148f),
-	ci::Color(0.355382f, 0.000000f, 0.000000f),
-	ci::Color(0.912346f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.542053f, 0.341807f),
-	ci::Color(1.000000f, 0.975512f, 0.900699f),
-	ci::Color(0.671713f, 0.850217f, 1.000000f),
-	ci::Color(0.111085f, 0.237935f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.685175f),
-	ci::Color(0.000000f, 0.000000f, 0.123001f),
-	ci::Color(0.301427f, 0.000000f, 0.000000f),
-	ci::Color(0.864953f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.478512f, 0.288096f),
-	ci::Color(1.000000f, 0.956604f, 0.852783f),
-	ci::Color(0.979135f, 0.995734f, 1.000000f),
-	ci::Color(0.159507f, 0.309017f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.738344f),
-	ci::Color(0.000000f, 0.000000f, 0.171914f),
-	ci::Color(0.248556f, 0.000000f, 0.000000f),
-	ci::Color(0.815567f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.412356f, 0.235542f),
-	ci::Color(1.000000f, 0.932472f, 0.802941f),
-	ci::Color(0.777382f, 0.918487f, 1.000000f),
-	ci::Color(0.209789f, 0.378411f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.790211f),
-	ci::Color(0.000000f, 0.000000f, 0.222618f),
-	ci::Color(0.197059f, 0.000000f, 0.000000f),
-	ci::Color(0.764458f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.343949f, 0.184433f),
-	ci::Color(1.000000f, 0.903247f, 0.751444f),
-	ci::Color(1.000000f, 0.998464f, 1.000000f),
-	ci::Color(0.261656f, 0.445738f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.840493f),
-	ci::Color(0.000000f, 0.000000f, 0.274838f),
-	ci::Color(0.147217f, 0.000000f, 0.000000f),
-	ci::Color(0.711904f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.273663f, 0.135047f),
-	ci::Color(1.000000f, 0.869089f, 0.698573f),
-	ci::Color(0.876999f, 0.966718f, 1.000000f),
-	ci::Color(0.314825f, 0.510631f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.888915f),
-	ci::Color(0.000000f, 0.000000f, 0.328287f),
-	ci::Color(0.099301f, 0.000000f, 0.000000f),
-	ci::Color(0.658193f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.201882f, 0.087654f),
-	ci::Color(1.000000f, 0.830184f, 0.644618f),
-	ci::Color(1.000000f, 0.979410f, 0.912346f),
-	ci::Color(0.369006f, 0.572735f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.935214f),
-	ci::Color(0.000000f, 0.000000f, 0.382674f),
-	ci::Color(0.053573f, 0.000000f, 0.000000f),
-	ci::Color(0.603617f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.128999f, 0.042513f),
-	ci::Color(1.000000f, 0.786745f, 0.589873f),
-	ci::Color(0.968391f, 0.993859f, 1.000000f),
-	ci::Color(0.423901f, 0.631711f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.979135f),
-	ci::Color(0.000000f, 0.000000f, 0.437702f),
-	ci::Color(0.010284f, 0.000000f, 0.000000f),
-	ci::Color(0.548476f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.055411f, 0.000000f),
-	ci::Color(1.000000f, 0.739009f, 0.534638f),
-	ci::Color(1.000000f, 0.938988f, 0.815567f),
-	ci::Color(0.479213f, 0.687237f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 1.000000f),
-	ci::Color(0.000000f, 0.000000f, 0.493070f),
-	ci::Color(0.000000f, 0.000000f, 0.000000)
+const std::array<const Color, 128> MPLFlag::palette{{
+	Color(1.000000f, 0.378411f, 0.209789f),
+	Color(1.000000f, 0.918487f, 0.777382f),
+	Color(0.802941f, 0.932472f, 1.000000f),
+	Color(0.235542f, 0.412356f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.815567f),
+	Color(0.000000f, 0.000000f, 0.248556f),
+	Color(0.171914f, 0.000000f, 0.000000f),
+	Color(0.738344f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.309017f, 0.159507f),
+	Color(1.000000f, 0.645928f, 0.437702f),
+	Color(0.852783f, 0.956604f, 1.000000f),
+	Color(0.576099f, 0.775204f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.864953f),
+	Color(0.000000f, 0.000000f, 0.589873f),
+	Color(0.123001f, 0.000000f, 0.000000f),
+	Color(0.396383f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.237935f, 0.111085f),
+	Color(1.000000f, 0.850217f, 0.671713f),
+	Color(1.000000f, 0.986201f, 0.935214f),
+	Color(0.341807f, 0.542053f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.912346f),
+	Color(0.000000f, 0.000000f, 0.355382f),
+	Color(0.000000f, 0.000000f, 0.087654f),
+	Color(0.630994f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.165554f, 0.064786f),
+	Color(1.000000f, 0.809017f, 0.617326f),
+	Color(1.000000f, 0.971281f, 0.888915f),
+	Color(0.396383f, 0.602635f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.957487f),
+	Color(0.000000f, 0.000000f, 0.410127f),
+	Color(0.000000f, 0.000000f, 0.135047f),
+	Color(0.576099f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.092268f, 0.020865f),
+	Color(1.000000f, 0.763398f, 0.562298f),
+	Color(0.989716f, 0.997269f, 1.000000f),
+	Color(0.451524f, 0.659925f, 1.000000f),
+	Color(0.000000f, 0.000000f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.751444f),
+	Color(0.000000f, 0.000000f, 0.000000f),
+	Color(0.520787f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.018479f, 0.000000f),
+	Color(1.000000f, 0.713610f, 0.506930f),
+	Color(1.000000f, 1.000000f, 1.000000f),
+	Color(0.506930f, 0.713610f, 1.000000f),
+	Color(0.000000f, 0.018479f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.802941f),
+	Color(0.000000f, 0.000000f, 0.000000f),
+	Color(0.465362f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.659925f, 0.451524f),
+	Color(1.000000f, 0.997269f, 0.989716f),
+	Color(0.562298f, 0.763398f, 1.000000f),
+	Color(0.020865f, 0.092268f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.852783f),
+	Color(0.000000f, 0.000000f, 0.031609f),
+	Color(0.410127f, 0.000000f, 0.000000f),
+	Color(0.957487f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.602635f, 0.396383f),
+	Color(1.000000f, 0.989092f, 0.946427f),
+	Color(0.617326f, 0.809017f, 1.000000f),
+	Color(0.064786f, 0.165554f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.900699f),
+	Color(0.000000f, 0.000000f, 0.076148f),
+	Color(0.355382f, 0.000000f, 0.000000f),
+	Color(0.912346f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.542053f, 0.341807f),
+	Color(1.000000f, 0.975512f, 0.900699f),
+	Color(0.671713f, 0.850217f, 1.000000f),
+	Color(0.111085f, 0.237935f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.685175f),
+	Color(0.000000f, 0.000000f, 0.123001f),
+	Color(0.301427f, 0.000000f, 0.000000f),
+	Color(0.864953f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.478512f, 0.288096f),
+	Color(1.000000f, 0.956604f, 0.852783f),
+	Color(0.979135f, 0.995734f, 1.000000f),
+	Color(0.159507f, 0.309017f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.738344f),
+	Color(0.000000f, 0.000000f, 0.171914f),
+	Color(0.248556f, 0.000000f, 0.000000f),
+	Color(0.815567f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.412356f, 0.235542f),
+	Color(1.000000f, 0.932472f, 0.802941f),
+	Color(0.777382f, 0.918487f, 1.000000f),
+	Color(0.209789f, 0.378411f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.790211f),
+	Color(0.000000f, 0.000000f, 0.222618f),
+	Color(0.197059f, 0.000000f, 0.000000f),
+	Color(0.764458f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.343949f, 0.184433f),
+	Color(1.000000f, 0.903247f, 0.751444f),
+	Color(1.000000f, 0.998464f, 1.000000f),
+	Color(0.261656f, 0.445738f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.840493f),
+	Color(0.000000f, 0.000000f, 0.274838f),
+	Color(0.147217f, 0.000000f, 0.000000f),
+	Color(0.711904f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.273663f, 0.135047f),
+	Color(1.000000f, 0.869089f, 0.698573f),
+	Color(0.876999f, 0.966718f, 1.000000f),
+	Color(0.314825f, 0.510631f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.888915f),
+	Color(0.000000f, 0.000000f, 0.328287f),
+	Color(0.099301f, 0.000000f, 0.000000f),
+	Color(0.658193f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.201882f, 0.087654f),
+	Color(1.000000f, 0.830184f, 0.644618f),
+	Color(1.000000f, 0.979410f, 0.912346f),
+	Color(0.369006f, 0.572735f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.935214f),
+	Color(0.000000f, 0.000000f, 0.382674f),
+	Color(0.053573f, 0.000000f, 0.000000f),
+	Color(0.603617f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.128999f, 0.042513f),
+	Color(1.000000f, 0.786745f, 0.589873f),
+	Color(0.968391f, 0.993859f, 1.000000f),
+	Color(0.423901f, 0.631711f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.979135f),
+	Color(0.000000f, 0.000000f, 0.437702f),
+	Color(0.010284f, 0.000000f, 0.000000f),
+	Color(0.548476f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.055411f, 0.000000f),
+	Color(1.000000f, 0.739009f, 0.534638f),
+	Color(1.000000f, 0.938988f, 0.815567f),
+	Color(0.479213f, 0.687237f, 1.000000f),
+	Color(0.000000f, 0.000000f, 1.000000f),
+	Color(0.000000f, 0.000000f, 0.493070f),
+	Color(0.000000f, 0.000000f, 0.000000)
 }};
 
 // Generated from:
 // http://www.ncl.ucar.edu/Document/Graphics/ColorTables/Files/NCV_manga.rgb
 
-const std::array<const ci::Colorf, 256> NCVManga::palette{{
-	ci::Color(0.18431f, 0.21569f, 0.62353f),
-	ci::Color(0.16863f, 0.20392f, 0.62745f),
-	ci::Color(0.12941f, 0.16863f, 0.63529f),
-	ci::Color(0.082353f, 0.12549f, 0.63922f),
-	ci::Color(0.043137f, 0.090196f, 0.64706f),
-	ci::Color(0.019608f, 0.070588f, 0.65098f),
-	ci::Color(0.0078431f, 0.062745f, 0.65882f),
-	ci::Color(0.0000f, 0.058824f, 0.66275f),
-	ci::Color(0.0000f, 0.062745f, 0.66667f),
-	ci::Color(0.0000f, 0.062745f, 0.66667f),
-	ci::Color(0.0000f, 0.062745f, 0.66667f),
-	ci::Color(0.0000f, 0.062745f, 0.65098f),
-	ci::Color(0.0000f, 0.062745f, 0.61961f),
-	ci::Color(0.0000f, 0.058824f, 0.56471f),
-	ci::Color(0.0000f, 0.050980f, 0.49020f),
-	ci::Color(0.0000f, 0.047059f, 0.43137f),
-	ci::Color(0.0000f, 0.047059f, 0.41176f),
-	ci::Color(0.0000f, 0.050980f, 0.44706f),
-	ci::Color(0.0000f, 0.062745f, 0.52157f),
-	ci::Color(0.0000f, 0.074510f, 0.60392f),
-	ci::Color(0.0000f, 0.086275f, 0.66667f),
-	ci::Color(0.0000f, 0.094118f, 0.70588f),
-	ci::Color(0.0000f, 0.10196f, 0.72941f),
-	ci::Color(0.0000f, 0.10588f, 0.74118f),
-	ci::Color(0.0000f, 0.11373f, 0.74902f),
-	ci::Color(0.0039216f, 0.12157f, 0.75686f),
-	ci::Color(0.011765f, 0.12941f, 0.76078f),
-	ci::Color(0.027451f, 0.14902f, 0.76471f),
-	ci::Color(0.058824f, 0.17647f, 0.76863f),
-	ci::Color(0.10588f, 0.22353f, 0.77255f),
-	ci::Color(0.16863f, 0.27843f, 0.78039f),
-	ci::Color(0.21961f, 0.32157f, 0.78431f),
-	ci::Color(0.23529f, 0.34118f, 0.78824f),
-	ci::Color(0.21176f, 0.32549f, 0.79216f),
-	ci::Color(0.15686f, 0.28627f, 0.79608f),
-	ci::Color(0.098039f, 0.24314f, 0.80000f),
-	ci::Color(0.054902f, 0.21569f, 0.80392f),
-	ci::Color(0.027451f, 0.20000f, 0.80784f),
-	ci::Color(0.011765f, 0.19608f, 0.81176f),
-	ci::Color(0.0078431f, 0.19608f, 0.81569f),
-	ci::Color(0.0078431f, 0.20392f, 0.81961f),
-	ci::Color(0.0078431f, 0.20784f, 0.81961f),
-	ci::Color(0.0078431f, 0.21569f, 0.81176f),
-	ci::Color(0.0078431f, 0.21569f, 0.79608f),
-	ci::Color(0.0078431f, 0.21176f, 0.76078f),
-	ci::Color(0.0078431f, 0.20000f, 0.69804f),
-	ci::Color(0.0078431f, 0.18824f, 0.62745f),
-	ci::Color(0.0078431f, 0.17255f, 0.56863f),
-	ci::Color(0.0078431f, 0.17647f, 0.55294f),
-	ci::Color(0.011765f, 0.19608f, 0.59608f),
-	ci::Color(0.015686f, 0.22745f, 0.67059f),
-	ci::Color(0.019608f, 0.26275f, 0.74902f),
-	ci::Color(0.023529f, 0.29020f, 0.80784f),
-	ci::Color(0.027451f, 0.31373f, 0.84314f),
-	ci::Color(0.031373f, 0.32941f, 0.86275f),
-	ci::Color(0.031373f, 0.34510f, 0.87059f),
-	ci::Color(0.039216f, 0.36078f, 0.87843f),
-	ci::Color(0.047059f, 0.37647f, 0.88235f),
-	ci::Color(0.058824f, 0.39608f, 0.88627f),
-	ci::Color(0.082353f, 0.41961f, 0.89020f),
-	ci::Color(0.12157f, 0.45098f, 0.89412f),
-	ci::Color(0.18039f, 0.49804f, 0.89412f),
-	ci::Color(0.25098f, 0.54510f, 0.89804f),
-	ci::Color(0.30588f, 0.58431f, 0.90196f),
-	ci::Color(0.32157f, 0.60000f, 0.90588f),
-	ci::Color(0.29412f, 0.59608f, 0.90980f),
-	ci::Color(0.23922f, 0.58039f, 0.90980f),
-	ci::Color(0.18431f, 0.56471f, 0.91373f),
-	ci::Color(0.14902f, 0.56078f, 0.91765f),
-	ci::Color(0.12941f, 0.56471f, 0.91765f),
-	ci::Color(0.12549f, 0.57647f, 0.92157f),
-	ci::Color(0.12941f, 0.59216f, 0.92157f),
-	ci::Color(0.13725f, 0.60784f, 0.92549f),
-	ci::Color(0.14902f, 0.62353f, 0.92157f),
-	ci::Color(0.15686f, 0.63137f, 0.91373f),
-	ci::Color(0.16078f, 0.63529f, 0.89412f),
-	ci::Color(0.16471f, 0.61961f, 0.85098f),
-	ci::Color(0.16078f, 0.58824f, 0.78824f),
-	ci::Color(0.15686f, 0.54510f, 0.71373f),
-	ci::Color(0.15294f, 0.51373f, 0.65882f),
-	ci::Color(0.16078f, 0.52157f, 0.64706f),
-	ci::Color(0.18039f, 0.56863f, 0.69412f),
-	ci::Color(0.21569f, 0.64314f, 0.76863f),
-	ci::Color(0.24706f, 0.72157f, 0.84706f),
-	ci::Color(0.27843f, 0.78431f, 0.89804f),
-	ci::Color(0.30588f, 0.82745f, 0.93333f),
-	ci::Color(0.32941f, 0.85882f, 0.94902f),
-	ci::Color(0.34902f, 0.88235f, 0.95686f),
-	ci::Color(0.36863f, 0.90196f, 0.96078f),
-	ci::Color(0.39216f, 0.91765f, 0.96471f),
-	ci::Color(0.41569f, 0.93333f, 0.96471f),
-	ci::Color(0.44706f, 0.94902f, 0.96863f),
-	ci::Color(0.49020f, 0.96471f, 0.96863f),
-	ci::Color(0.54510f, 0.96863f, 0.96471f),
-	ci::Color(0.60000f, 0.97255f, 0.95686f),
-	ci::Color(0.64314f, 0.97255f, 0.95294f),
-	ci::Color(0.66275f, 0.97647f, 0.94902f),
-	ci::Color(0.65490f, 0.97647f, 0.94118f),
-	ci::Color(0.64314f, 0.97647f, 0.93333f),
-	ci::Color(0.63137f, 0.98039f, 0.92549f),
-	ci::Color(0.63529f, 0.98039f, 0.91765f),
-	ci::Color(0.64314f, 0.98039f, 0.90980f),
-	ci::Color(0.66275f, 0.98431f, 0.90588f),
-	ci::Color(0.67843f, 0.98431f, 0.90196f),
-	ci::Color(0.69804f, 0.98039f, 0.89804f),
-	ci::Color(0.71765f, 0.97647f, 0.89412f),
-	ci::Color(0.72941f, 0.96863f, 0.88235f),
-	ci::Color(0.72941f, 0.94118f, 0.86275f),
-	ci::Color(0.70980f, 0.89804f, 0.81961f),
-	ci::Color(0.67059f, 0.83137f, 0.76078f),
-	ci::Color(0.62353f, 0.75294f, 0.69412f),
-	ci::Color(0.59216f, 0.70196f, 0.64706f),
-	ci::Color(0.60000f, 0.69804f, 0.64706f),
-	ci::Color(0.65490f, 0.74902f, 0.69804f),
-	ci::Color(0.73725f, 0.82353f, 0.77255f),
-	ci::Color(0.81176f, 0.89412f, 0.84314f),
-	ci::Color(0.87059f, 0.94510f, 0.89804f),
-	ci::Color(0.90980f, 0.97255f, 0.92941f),
-	ci::Color(0.93333f, 0.98824f, 0.94902f),
-	ci::Color(0.94902f, 0.99216f, 0.96078f),
-	ci::Color(0.96078f, 0.99608f, 0.96863f),
-	ci::Color(0.97255f, 0.99608f, 0.97647f),
-	ci::Color(0.98039f, 0.99608f, 0.98039f),
-	ci::Color(0.98431f, 0.99608f, 0.98824f),
-	ci::Color(0.99216f, 0.99608f, 0.99216f),
-	ci::Color(0.99608f, 0.99608f, 0.99608f),
-	ci::Color(0.99608f, 0.99608f, 0.99608f),
-	ci::Color(0.99608f, 0.99608f, 0.99608f),
-	ci::Color(0.99608f, 0.99608f, 0.99608f),
-	ci::Color(0.99608f, 0.99608f, 0.99608f),
-	ci::Color(0.99608f, 0.99608f, 0.99608f),
-	ci::Color(0.99216f, 0.99608f, 0.99216f),
-	ci::Color(0.98824f, 0.99608f, 0.98431f),
-	ci::Color(0.98039f, 0.99608f, 0.98039f),
-	ci::Color(0.97647f, 0.99608f, 0.97255f),
-	ci::Color(0.96863f, 0.99608f, 0.96078f),
-	ci::Color(0.96078f, 0.99216f, 0.94902f),
-	ci::Color(0.94902f, 0.98824f, 0.93333f),
-	ci::Color(0.92941f, 0.97255f, 0.90980f),
-	ci::Color(0.89804f, 0.94510f, 0.87059f),
-	ci::Color(0.84314f, 0.89412f, 0.81176f),
-	ci::Color(0.77255f, 0.82353f, 0.73725f),
-	ci::Color(0.69804f, 0.74902f, 0.65490f),
-	ci::Color(0.64706f, 0.69804f, 0.60000f),
-	ci::Color(0.64706f, 0.70196f, 0.59216f),
-	ci::Color(0.69412f, 0.75294f, 0.62353f),
-	ci::Color(0.76078f, 0.83137f, 0.67059f),
-	ci::Color(0.81961f, 0.89804f, 0.70980f),
-	ci::Color(0.86275f, 0.94118f, 0.72941f),
-	ci::Color(0.88235f, 0.96863f, 0.72941f),
-	ci::Color(0.89412f, 0.97647f, 0.71765f),
-	ci::Color(0.89804f, 0.98039f, 0.69804f),
-	ci::Color(0.90196f, 0.98431f, 0.67843f),
-	ci::Color(0.90588f, 0.98431f, 0.66275f),
-	ci::Color(0.90980f, 0.98039f, 0.64314f),
-	ci::Color(0.91765f, 0.98039f, 0.63529f),
-	ci::Color(0.92549f, 0.98039f, 0.63137f),
-	ci::Color(0.93333f, 0.97647f, 0.64314f),
-	ci::Color(0.94118f, 0.97647f, 0.65490f),
-	ci::Color(0.94902f, 0.97647f, 0.66275f),
-	ci::Color(0.95294f, 0.97255f, 0.64314f),
-	ci::Color(0.95686f, 0.97255f, 0.60000f),
-	ci::Color(0.96471f, 0.96863f, 0.54510f),
-	ci::Color(0.96863f, 0.96471f, 0.49020f),
-	ci::Color(0.96863f, 0.94902f, 0.44706f),
-	ci::Color(0.96471f, 0.93333f, 0.41569f),
-	ci::Color(0.96471f, 0.91765f, 0.39216f),
-	ci::Color(0.96078f, 0.90196f, 0.36863f),
-	ci::Color(0.95686f, 0.88235f, 0.34902f),
-	ci::Color(0.94902f, 0.85882f, 0.32941f),
-	ci::Color(0.93333f, 0.82745f, 0.30588f),
-	ci::Color(0.89804f, 0.78431f, 0.27843f),
-	ci::Color(0.84706f, 0.72157f, 0.24706f),
-	ci::Color(0.76863f, 0.64314f, 0.21569f),
-	ci::Color(0.69412f, 0.56863f, 0.18039f),
-	ci::Color(0.64706f, 0.52157f, 0.16078f),
-	ci::Color(0.65882f, 0.51373f, 0.15294f),
-	ci::Color(0.71373f, 0.54510f, 0.15686f),
-	ci::Color(0.78824f, 0.58824f, 0.16078f),
-	ci::Color(0.85098f, 0.61961f, 0.16471f),
-	ci::Color(0.89412f, 0.63529f, 0.16078f),
-	ci::Color(0.91373f, 0.63137f, 0.15686f),
-	ci::Color(0.92157f, 0.62353f, 0.14902f),
-	ci::Color(0.92549f, 0.60784f, 0.13725f),
-	ci::Color(0.92157f, 0.59216f, 0.12941f),
-	ci::Color(0.92157f, 0.57647f, 0.12549f),
-	ci::Color(0.91765f, 0.56471f, 0.12941f),
-	ci::Color(0.91765f, 0.56078f, 0.14902f),
-	ci::Color(0.91373f, 0.56471f, 0.18431f),
-	ci::Color(0.90980f, 0.58039f, 0.23922f),
-	ci::Color(0.90980f, 0.59608f, 0.29412f),
-	ci::Color(0.90588f, 0.60000f, 0.32157f),
-	ci::Color(0.90196f, 0.58431f, 0.30588f),
-	ci::Color(0.89804f, 0.54510f, 0.25098f),
-	ci::Color(0.89412f, 0.49804f, 0.18039f),
-	ci::Color(0.89412f, 0.45098f, 0.12157f),
-	ci::Color(0.89020f, 0.41961f, 0.082353f),
-	ci::Color(0.88627f, 0.39608f, 0.058824f),
-	ci::Color(0.88235f, 0.37647f, 0.047059f),
-	ci::Color(0.87843f, 0.36078f, 0.039216f),
-	ci::Color(0.87059f, 0.34510f, 0.031373f),
-	ci::Color(0.86275f, 0.32941f, 0.031373f),
-	ci::Color(0.84314f, 0.31373f, 0.027451f),
-	ci::Color(0.80784f, 0.29020f, 0.023529f),
-	ci::Color(0.74902f, 0.26275f, 0.019608f),
-	ci::Color(0.67059f, 0.22745f, 0.015686f),
-	ci::Color(0.59608f, 0.19608f, 0.011765f),
-	ci::Color(0.55294f, 0.17647f, 0.0078431f),
-	ci::Color(0.56863f, 0.17255f, 0.0078431f),
-	ci::Color(0.62745f, 0.18824f, 0.0078431f),
-	ci::Color(0.69804f, 0.20000f, 0.0078431f),
-	ci::Color(0.76078f, 0.21176f, 0.0078431f),
-	ci::Color(0.79608f, 0.21569f, 0.0078431f),
-	ci::Color(0.81176f, 0.21569f, 0.0078431f),
-	ci::Color(0.81961f, 0.20784f, 0.0078431f),
-	ci::Color(0.81961f, 0.20392f, 0.0078431f),
-	ci::Color(0.81569f, 0.19608f, 0.0078431f),
-	ci::Color(0.81176f, 0.19608f, 0.011765f),
-	ci::Color(0.80784f, 0.20000f, 0.027451f),
-	ci::Color(0.80392f, 0.21569f, 0.054902f),
-	ci::Color(0.80000f, 0.24314f, 0.098039f),
-	ci::Color(0.79608f, 0.28627f, 0.15686f),
-	ci::Color(0.79216f, 0.32549f, 0.21176f),
-	ci::Color(0.78824f, 0.34118f, 0.23529f),
-	ci::Color(0.78431f, 0.32157f, 0.21961f),
-	ci::Color(0.78039f, 0.27843f, 0.16863f),
-	ci::Color(0.77255f, 0.22353f, 0.10588f),
-	ci::Color(0.76863f, 0.17647f, 0.058824f),
-	ci::Color(0.76471f, 0.14902f, 0.027451f),
-	ci::Color(0.76078f, 0.12941f, 0.011765f),
-	ci::Color(0.75686f, 0.12157f, 0.0039216f),
-	ci::Color(0.74902f, 0.11373f, 0.0000f),
-	ci::Color(0.74118f, 0.10588f, 0.0000f),
-	ci::Color(0.72941f, 0.10196f, 0.0000f),
-	ci::Color(0.70588f, 0.094118f, 0.0000f),
-	ci::Color(0.66667f, 0.086275f, 0.0000f),
-	ci::Color(0.60392f, 0.074510f, 0.0000f),
-	ci::Color(0.52157f, 0.062745f, 0.0000f),
-	ci::Color(0.44706f, 0.050980f, 0.0000f),
-	ci::Color(0.41176f, 0.047059f, 0.0000f),
-	ci::Color(0.43137f, 0.047059f, 0.0000f),
-	ci::Color(0.49020f, 0.050980f, 0.0000f),
-	ci::Color(0.56471f, 0.058824f, 0.0000f),
-	ci::Color(0.61961f, 0.062745f, 0.0000f),
-	ci::Color(0.65098f, 0.062745f, 0.0000f),
-	ci::Color(0.66667f, 0.062745f, 0.0000f),
-	ci::Color(0.66667f, 0.062745f, 0.0000f),
-	ci::Color(0.66667f, 0.062745f, 0.0000f),
-	ci::Color(0.66275f, 0.058824f, 0.0000f),
-	ci::Color(0.65882f, 0.062745f, 0.0078431f),
-	ci::Color(0.65098f, 0.070588f, 0.019608f),
-	ci::Color(0.64706f, 0.090196f, 0.043137f),
-	ci::Color(0.63922f, 0.12549f, 0.082353f),
-	ci::Color(0.63529f, 0.16863f, 0.12941f),
-	ci::Color(0.62745f, 0.20392f, 0.16863f),
-	ci::Color(0.62353f, 0.21569f, 0.18431f)
+const std::array<const Color, 256> NCVManga::palette{{
+	Color(0.18431f, 0.21569f, 0.62353f),
+	Color(0.16863f, 0.20392f, 0.62745f),
+	Color(0.12941f, 0.16863f, 0.63529f),
+	Color(0.082353f, 0.12549f, 0.63922f),
+	Color(0.043137f, 0.090196f, 0.64706f),
+	Color(0.019608f, 0.070588f, 0.65098f),
+	Color(0.0078431f, 0.062745f, 0.65882f),
+	Color(0.0000f, 0.058824f, 0.66275f),
+	Color(0.0000f, 0.062745f, 0.66667f),
+	Color(0.0000f, 0.062745f, 0.66667f),
+	Color(0.0000f, 0.062745f, 0.66667f),
+	Color(0.0000f, 0.062745f, 0.65098f),
+	Color(0.0000f, 0.062745f, 0.61961f),
+	Color(0.0000f, 0.058824f, 0.56471f),
+	Color(0.0000f, 0.050980f, 0.49020f),
+	Color(0.0000f, 0.047059f, 0.43137f),
+	Color(0.0000f, 0.047059f, 0.41176f),
+	Color(0.0000f, 0.050980f, 0.44706f),
+	Color(0.0000f, 0.062745f, 0.52157f),
+	Color(0.0000f, 0.074510f, 0.60392f),
+	Color(0.0000f, 0.086275f, 0.66667f),
+	Color(0.0000f, 0.094118f, 0.70588f),
+	Color(0.0000f, 0.10196f, 0.72941f),
+	Color(0.0000f, 0.10588f, 0.74118f),
+	Color(0.0000f, 0.11373f, 0.74902f),
+	Color(0.0039216f, 0.12157f, 0.75686f),
+	Color(0.011765f, 0.12941f, 0.76078f),
+	Color(0.027451f, 0.14902f, 0.76471f),
+	Color(0.058824f, 0.17647f, 0.76863f),
+	Color(0.10588f, 0.22353f, 0.77255f),
+	Color(0.16863f, 0.27843f, 0.78039f),
+	Color(0.21961f, 0.32157f, 0.78431f),
+	Color(0.23529f, 0.34118f, 0.78824f),
+	Color(0.21176f, 0.32549f, 0.79216f),
+	Color(0.15686f, 0.28627f, 0.79608f),
+	Color(0.098039f, 0.24314f, 0.80000f),
+	Color(0.054902f, 0.21569f, 0.80392f),
+	Color(0.027451f, 0.20000f, 0.80784f),
+	Color(0.011765f, 0.19608f, 0.81176f),
+	Color(0.0078431f, 0.19608f, 0.81569f),
+	Color(0.0078431f, 0.20392f, 0.81961f),
+	Color(0.0078431f, 0.20784f, 0.81961f),
+	Color(0.0078431f, 0.21569f, 0.81176f),
+	Color(0.0078431f, 0.21569f, 0.79608f),
+	Color(0.0078431f, 0.21176f, 0.76078f),
+	Color(0.0078431f, 0.20000f, 0.69804f),
+	Color(0.0078431f, 0.18824f, 0.62745f),
+	Color(0.0078431f, 0.17255f, 0.56863f),
+	Color(0.0078431f, 0.17647f, 0.55294f),
+	Color(0.011765f, 0.19608f, 0.59608f),
+	Color(0.015686f, 0.22745f, 0.67059f),
+	Color(0.019608f, 0.26275f, 0.74902f),
+	Color(0.023529f, 0.29020f, 0.80784f),
+	Color(0.027451f, 0.31373f, 0.84314f),
+	Color(0.031373f, 0.32941f, 0.86275f),
+	Color(0.031373f, 0.34510f, 0.87059f),
+	Color(0.039216f, 0.36078f, 0.87843f),
+	Color(0.047059f, 0.37647f, 0.88235f),
+	Color(0.058824f, 0.39608f, 0.88627f),
+	Color(0.082353f, 0.41961f, 0.89020f),
+	Color(0.12157f, 0.45098f, 0.89412f),
+	Color(0.18039f, 0.49804f, 0.89412f),
+	Color(0.25098f, 0.54510f, 0.89804f),
+	Color(0.30588f, 0.58431f, 0.90196f),
+	Color(0.32157f, 0.60000f, 0.90588f),
+	Color(0.29412f, 0.59608f, 0.90980f),
+	Color(0.23922f, 0.58039f, 0.90980f),
+	Color(0.18431f, 0.56471f, 0.91373f),
+	Color(0.14902f, 0.56078f, 0.91765f),
+	Color(0.12941f, 0.56471f, 0.91765f),
+	Color(0.12549f, 0.57647f, 0.92157f),
+	Color(0.12941f, 0.59216f, 0.92157f),
+	Color(0.13725f, 0.60784f, 0.92549f),
+	Color(0.14902f, 0.62353f, 0.92157f),
+	Color(0.15686f, 0.63137f, 0.91373f),
+	Color(0.16078f, 0.63529f, 0.89412f),
+	Color(0.16471f, 0.61961f, 0.85098f),
+	Color(0.16078f, 0.58824f, 0.78824f),
+	Color(0.15686f, 0.54510f, 0.71373f),
+	Color(0.15294f, 0.51373f, 0.65882f),
+	Color(0.16078f, 0.52157f, 0.64706f),
+	Color(0.18039f, 0.56863f, 0.69412f),
+	Color(0.21569f, 0.64314f, 0.76863f),
+	Color(0.24706f, 0.72157f, 0.84706f),
+	Color(0.27843f, 0.78431f, 0.89804f),
+	Color(0.30588f, 0.82745f, 0.93333f),
+	Color(0.32941f, 0.85882f, 0.94902f),
+	Color(0.34902f, 0.88235f, 0.95686f),
+	Color(0.36863f, 0.90196f, 0.96078f),
+	Color(0.39216f, 0.91765f, 0.96471f),
+	Color(0.41569f, 0.93333f, 0.96471f),
+	Color(0.44706f, 0.94902f, 0.96863f),
+	Color(0.49020f, 0.96471f, 0.96863f),
+	Color(0.54510f, 0.96863f, 0.96471f),
+	Color(0.60000f, 0.97255f, 0.95686f),
+	Color(0.64314f, 0.97255f, 0.95294f),
+	Color(0.66275f, 0.97647f, 0.94902f),
+	Color(0.65490f, 0.97647f, 0.94118f),
+	Color(0.64314f, 0.97647f, 0.93333f),
+	Color(0.63137f, 0.98039f, 0.92549f),
+	Color(0.63529f, 0.98039f, 0.91765f),
+	Color(0.64314f, 0.98039f, 0.90980f),
+	Color(0.66275f, 0.98431f, 0.90588f),
+	Color(0.67843f, 0.98431f, 0.90196f),
+	Color(0.69804f, 0.98039f, 0.89804f),
+	Color(0.71765f, 0.97647f, 0.89412f),
+	Color(0.72941f, 0.96863f, 0.88235f),
+	Color(0.72941f, 0.94118f, 0.86275f),
+	Color(0.70980f, 0.89804f, 0.81961f),
+	Color(0.67059f, 0.83137f, 0.76078f),
+	Color(0.62353f, 0.75294f, 0.69412f),
+	Color(0.59216f, 0.70196f, 0.64706f),
+	Color(0.60000f, 0.69804f, 0.64706f),
+	Color(0.65490f, 0.74902f, 0.69804f),
+	Color(0.73725f, 0.82353f, 0.77255f),
+	Color(0.81176f, 0.89412f, 0.84314f),
+	Color(0.87059f, 0.94510f, 0.89804f),
+	Color(0.90980f, 0.97255f, 0.92941f),
+	Color(0.93333f, 0.98824f, 0.94902f),
+	Color(0.94902f, 0.99216f, 0.96078f),
+	Color(0.96078f, 0.99608f, 0.96863f),
+	Color(0.97255f, 0.99608f, 0.97647f),
+	Color(0.98039f, 0.99608f, 0.98039f),
+	Color(0.98431f, 0.99608f, 0.98824f),
+	Color(0.99216f, 0.99608f, 0.99216f),
+	Color(0.99608f, 0.99608f, 0.99608f),
+	Color(0.99608f, 0.99608f, 0.99608f),
+	Color(0.99608f, 0.99608f, 0.99608f),
+	Color(0.99608f, 0.99608f, 0.99608f),
+	Color(0.99608f, 0.99608f, 0.99608f),
+	Color(0.99608f, 0.99608f, 0.99608f),
+	Color(0.99216f, 0.99608f, 0.99216f),
+	Color(0.98824f, 0.99608f, 0.98431f),
+	Color(0.98039f, 0.99608f, 0.98039f),
+	Color(0.97647f, 0.99608f, 0.97255f),
+	Color(0.96863f, 0.99608f, 0.96078f),
+	Color(0.96078f, 0.99216f, 0.94902f),
+	Color(0.94902f, 0.98824f, 0.93333f),
+	Color(0.92941f, 0.97255f, 0.90980f),
+	Color(0.89804f, 0.94510f, 0.87059f),
+	Color(0.84314f, 0.89412f, 0.81176f),
+	Color(0.77255f, 0.82353f, 0.73725f),
+	Color(0.69804f, 0.74902f, 0.65490f),
+	Color(0.64706f, 0.69804f, 0.60000f),
+	Color(0.64706f, 0.70196f, 0.59216f),
+	Color(0.69412f, 0.75294f, 0.62353f),
+	Color(0.76078f, 0.83137f, 0.67059f),
+	Color(0.81961f, 0.89804f, 0.70980f),
+	Color(0.86275f, 0.94118f, 0.72941f),
+	Color(0.88235f, 0.96863f, 0.72941f),
+	Color(0.89412f, 0.97647f, 0.71765f),
+	Color(0.89804f, 0.98039f, 0.69804f),
+	Color(0.90196f, 0.98431f, 0.67843f),
+	Color(0.90588f, 0.98431f, 0.66275f),
+	Color(0.90980f, 0.98039f, 0.64314f),
+	Color(0.91765f, 0.98039f, 0.63529f),
+	Color(0.92549f, 0.98039f, 0.63137f),
+	Color(0.93333f, 0.97647f, 0.64314f),
+	Color(0.94118f, 0.97647f, 0.65490f),
+	Color(0.94902f, 0.97647f, 0.66275f),
+	Color(0.95294f, 0.97255f, 0.64314f),
+	Color(0.95686f, 0.97255f, 0.60000f),
+	Color(0.96471f, 0.96863f, 0.54510f),
+	Color(0.96863f, 0.96471f, 0.49020f),
+	Color(0.96863f, 0.94902f, 0.44706f),
+	Color(0.96471f, 0.93333f, 0.41569f),
+	Color(0.96471f, 0.91765f, 0.39216f),
+	Color(0.96078f, 0.90196f, 0.36863f),
+	Color(0.95686f, 0.88235f, 0.34902f),
+	Color(0.94902f, 0.85882f, 0.32941f),
+	Color(0.93333f, 0.82745f, 0.30588f),
+	Color(0.89804f, 0.78431f, 0.27843f),
+	Color(0.84706f, 0.72157f, 0.24706f),
+	Color(0.76863f, 0.64314f, 0.21569f),
+	Color(0.69412f, 0.56863f, 0.18039f),
+	Color(0.64706f, 0.52157f, 0.16078f),
+	Color(0.65882f, 0.51373f, 0.15294f),
+	Color(0.71373f, 0.54510f, 0.15686f),
+	Color(0.78824f, 0.58824f, 0.16078f),
+	Color(0.85098f, 0.61961f, 0.16471f),
+	Color(0.89412f, 0.63529f, 0.16078f),
+	Color(0.91373f, 0.63137f, 0.15686f),
+	Color(0.92157f, 0.62353f, 0.14902f),
+	Color(0.92549f, 0.60784f, 0.13725f),
+	Color(0.92157f, 0.59216f, 0.12941f),
+	Color(0.92157f, 0.57647f, 0.12549f),
+	Color(0.91765f, 0.56471f, 0.12941f),
+	Color(0.91765f, 0.56078f, 0.14902f),
+	Color(0.91373f, 0.56471f, 0.18431f),
+	Color(0.90980f, 0.58039f, 0.23922f),
+	Color(0.90980f, 0.59608f, 0.29412f),
+	Color(0.90588f, 0.60000f, 0.32157f),
+	Color(0.90196f, 0.58431f, 0.30588f),
+	Color(0.89804f, 0.54510f, 0.25098f),
+	Color(0.89412f, 0.49804f, 0.18039f),
+	Color(0.89412f, 0.45098f, 0.12157f),
+	Color(0.89020f, 0.41961f, 0.082353f),
+	Color(0.88627f, 0.39608f, 0.058824f),
+	Color(0.88235f, 0.37647f, 0.047059f),
+	Color(0.87843f, 0.36078f, 0.039216f),
+	Color(0.87059f, 0.34510f, 0.031373f),
+	Color(0.86275f, 0.32941f, 0.031373f),
+	Color(0.84314f, 0.31373f, 0.027451f),
+	Color(0.80784f, 0.29020f, 0.023529f),
+	Color(0.74902f, 0.26275f, 0.019608f),
+	Color(0.67059f, 0.22745f, 0.015686f),
+	Color(0.59608f, 0.19608f, 0.011765f),
+	Color(0.55294f, 0.17647f, 0.0078431f),
+	Color(0.56863f, 0.17255f, 0.0078431f),
+	Color(0.62745f, 0.18824f, 0.0078431f),
+	Color(0.69804f, 0.20000f, 0.0078431f),
+	Color(0.76078f, 0.21176f, 0.0078431f),
+	Color(0.79608f, 0.21569f, 0.0078431f),
+	Color(0.81176f, 0.21569f, 0.0078431f),
+	Color(0.81961f, 0.20784f, 0.0078431f),
+	Color(0.81961f, 0.20392f, 0.0078431f),
+	Color(0.81569f, 0.19608f, 0.0078431f),
+	Color(0.81176f, 0.19608f, 0.011765f),
+	Color(0.80784f, 0.20000f, 0.027451f),
+	Color(0.80392f, 0.21569f, 0.054902f),
+	Color(0.80000f, 0.24314f, 0.098039f),
+	Color(0.79608f, 0.28627f, 0.15686f),
+	Color(0.79216f, 0.32549f, 0.21176f),
+	Color(0.78824f, 0.34118f, 0.23529f),
+	Color(0.78431f, 0.32157f, 0.21961f),
+	Color(0.78039f, 0.27843f, 0.16863f),
+	Color(0.77255f, 0.22353f, 0.10588f),
+	Color(0.76863f, 0.17647f, 0.058824f),
+	Color(0.76471f, 0.14902f, 0.027451f),
+	Color(0.76078f, 0.12941f, 0.011765f),
+	Color(0.75686f, 0.12157f, 0.0039216f),
+	Color(0.74902f, 0.11373f, 0.0000f),
+	Color(0.74118f, 0.10588f, 0.0000f),
+	Color(0.72941f, 0.10196f, 0.0000f),
+	Color(0.70588f, 0.094118f, 0.0000f),
+	Color(0.66667f, 0.086275f, 0.0000f),
+	Color(0.60392f, 0.074510f, 0.0000f),
+	Color(0.52157f, 0.062745f, 0.0000f),
+	Color(0.44706f, 0.050980f, 0.0000f),
+	Color(0.41176f, 0.047059f, 0.0000f),
+	Color(0.43137f, 0.047059f, 0.0000f),
+	Color(0.49020f, 0.050980f, 0.0000f),
+	Color(0.56471f, 0.058824f, 0.0000f),
+	Color(0.61961f, 0.062745f, 0.0000f),
+	Color(0.65098f, 0.062745f, 0.0000f),
+	Color(0.66667f, 0.062745f, 0.0000f),
+	Color(0.66667f, 0.062745f, 0.0000f),
+	Color(0.66667f, 0.062745f, 0.0000f),
+	Color(0.66275f, 0.058824f, 0.0000f),
+	Color(0.65882f, 0.062745f, 0.0078431f),
+	Color(0.65098f, 0.070588f, 0.019608f),
+	Color(0.64706f, 0.090196f, 0.043137f),
+	Color(0.63922f, 0.12549f, 0.082353f),
+	Color(0.63529f, 0.16863f, 0.12941f),
+	Color(0.62745f, 0.20392f, 0.16863f),
+	Color(0.62353f, 0.21569f, 0.18431f)
 }};
 
 // Generated from:
 // http://www.ncl.ucar.edu/Document/Graphics/ColorTables/Files/MPL_prism.rgb
 
-const std::array<const ci::Colorf, 128> MPLPrism::palette{{
-	ci::Color(1.000000f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.320298f, 0.000000f),
-	ci::Color(1.000000f, 0.690910f, 0.000000f),
-	ci::Color(1.000000f, 0.967906f, 0.000000f),
-	ci::Color(0.699099f, 1.000000f, 0.000000f),
-	ci::Color(0.326218f, 0.996569f, 0.000000f),
-	ci::Color(0.042511f, 0.740801f, 0.224725f),
-	ci::Color(0.000000f, 0.378476f, 0.725917f),
-	ci::Color(0.000000f, 0.003577f, 1.000000f),
-	ci::Color(0.100146f, 0.000000f, 1.000000f),
-	ci::Color(0.602179f, 0.000000f, 0.844967f),
-	ci::Color(0.794621f, 0.000000f, 0.637761f),
-	ci::Color(1.000000f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.056056f, 0.000000f),
-	ci::Color(1.000000f, 0.621063f, 0.000000f),
-	ci::Color(1.000000f, 0.787487f, 0.000000f),
-	ci::Color(0.776362f, 1.000000f, 0.000000f),
-	ci::Color(0.396916f, 1.000000f, 0.000000f),
-	ci::Color(0.228041f, 0.935947f, 0.000000f),
-	ci::Color(0.000000f, 0.455532f, 0.636657f),
-	ci::Color(0.000000f, 0.075077f, 0.995886f),
-	ci::Color(0.181686f, 0.000000f, 1.000000f),
-	ci::Color(0.342745f, 0.000000f, 1.000000f),
-	ci::Color(0.906591f, 0.000000f, 0.492737f),
-	ci::Color(1.000000f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.166393f, 0.000000f),
-	ci::Color(1.000000f, 0.358175f, 0.000000f),
-	ci::Color(1.000000f, 0.873235f, 0.000000f),
-	ci::Color(0.852487f, 1.000000f, 0.000000f),
-	ci::Color(0.470536f, 1.000000f, 0.000000f),
-	ci::Color(0.293001f, 0.978361f, 0.000000f),
-	ci::Color(0.000000f, 0.531245f, 0.540584f),
-	ci::Color(0.000000f, 0.149306f, 0.942302f),
-	ci::Color(0.125492f, 0.000000f, 1.000000f),
-	ci::Color(0.450132f, 0.000000f, 0.971666f),
-	ci::Color(0.831803f, 0.000000f, 0.591696f),
-	ci::Color(1.000000f, 0.000000f, 0.058246f),
-	ci::Color(1.000000f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.472804f, 0.000000f),
-	ci::Color(1.000000f, 0.816910f, 0.000000f),
-	ci::Color(0.926660f, 1.000000f, 0.000000f),
-	ci::Color(0.546290f, 1.000000f, 0.000000f),
-	ci::Color(0.198010f, 0.912859f, 0.000000f),
-	ci::Color(0.000000f, 0.604804f, 0.438728f),
-	ci::Color(0.000000f, 0.225468f, 0.878635f),
-	ci::Color(0.000000f, 0.039789f, 1.000000f),
-	ci::Color(0.377235f, 0.000000f, 1.000000f),
-	ci::Color(0.755285f, 0.000000f, 0.684324f),
-	ci::Color(1.000000f, 0.000000f, 0.171409f),
-	ci::Color(1.000000f, 0.019471f, 0.000000f),
-	ci::Color(1.000000f, 0.395980f, 0.000000f),
-	ci::Color(1.000000f, 0.755376f, 0.000000f),
-	ci::Color(0.998086f, 1.000000f, 0.000000f),
-	ci::Color(0.815525f, 1.000000f, 0.000000f),
-	ci::Color(0.260746f, 0.958499f, 0.000000f),
-	ci::Color(0.004280f, 0.675423f, 0.332176f),
-	ci::Color(0.000000f, 0.302748f, 0.805567f),
-	ci::Color(0.031124f, 0.000000f, 1.000000f),
-	ci::Color(0.307471f, 0.000000f, 1.000000f),
-	ci::Color(0.677854f, 0.000000f, 0.769630f),
-	ci::Color(1.000000f, 0.000000f, 0.282737f),
-	ci::Color(1.000000f, 0.000000f, 0.002710f),
-	ci::Color(1.000000f, 0.318450f, 0.000000f),
-	ci::Color(1.000000f, 0.689289f, 0.000000f),
-	ci::Color(1.000000f, 0.966932f, 0.000000f),
-	ci::Color(0.700945f, 1.000000f, 0.000000f),
-	ci::Color(0.327862f, 0.997414f, 0.000000f),
-	ci::Color(0.043525f, 0.742346f, 0.222071f),
-	ci::Color(0.000000f, 0.380320f, 0.723878f),
-	ci::Color(0.000000f, 0.005241f, 1.000000f),
-	ci::Color(0.241586f, 0.000000f, 1.000000f),
-	ci::Color(0.600339f, 0.000000f, 0.846700f),
-	ci::Color(0.977161f, 0.000000f, 0.391040f),
-	ci::Color(1.000000f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.241044f, 0.000000f),
-	ci::Color(1.000000f, 0.433617f, 0.000000f),
-	ci::Color(1.000000f, 0.922616f, 0.000000f),
-	ci::Color(0.778191f, 1.000000f, 0.000000f),
-	ci::Color(0.398638f, 1.000000f, 0.000000f),
-	ci::Color(0.089474f, 0.804857f, 0.109589f),
-	ci::Color(0.000000f, 0.457354f, 0.634445f),
-	ci::Color(0.000000f, 0.076816f, 0.994732f),
-	ci::Color(0.180284f, 0.000000f, 1.000000f),
-	ci::Color(0.523569f, 0.000000f, 0.914711f),
-	ci::Color(0.904836f, 0.000000f, 0.495159f),
-	ci::Color(1.000000f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.164590f, 0.000000f),
-	ci::Color(1.000000f, 0.546332f, 0.000000f),
-	ci::Color(1.000000f, 0.871959f, 0.000000f),
-	ci::Color(0.854279f, 1.000000f, 0.000000f),
-	ci::Color(0.472318f, 1.000000f, 0.000000f),
-	ci::Color(0.294600f, 0.979288f, 0.000000f),
-	ci::Color(0.000000f, 0.533024f, 0.538222f),
-	ci::Color(0.000000f, 0.151100f, 0.940901f),
-	ci::Color(0.124223f, 0.000000f, 1.000000f),
-	ci::Color(0.448366f, 0.000000f, 0.972934f),
-	ci::Color(0.829998f, 0.000000f, 0.593979f),
-	ci::Color(1.000000f, 0.000000f, 0.060953f),
-	ci::Color(1.000000f, 0.089905f, 0.000000f),
-	ci::Color(1.000000f, 0.470990f, 0.000000f),
-	ci::Color(1.000000f, 0.815503f, 0.000000f),
-	ci::Color(0.928395f, 1.000000f, 0.000000f),
-	ci::Color(0.548113f, 1.000000f, 0.000000f),
-	ci::Color(0.199447f, 0.914021f, 0.000000f),
-	ci::Color(0.000000f, 0.606523f, 0.436241f),
-	ci::Color(0.000000f, 0.227298f, 0.877002f),
-	ci::Color(0.074002f, 0.000000f, 1.000000f),
-	ci::Color(0.209590f, 0.000000f, 1.000000f),
-	ci::Color(0.753449f, 0.000000f, 0.686444f),
-	ci::Color(1.000000f, 0.000000f, 0.174085f),
-	ci::Color(1.000000f, 0.017789f, 0.000000f),
-	ci::Color(1.000000f, 0.394139f, 0.000000f),
-	ci::Color(1.000000f, 0.753852f, 0.000000f),
-	ci::Color(0.999747f, 1.000000f, 0.000000f),
-	ci::Color(0.625213f, 1.000000f, 0.000000f),
-	ci::Color(0.262296f, 0.959506f, 0.000000f),
-	ci::Color(0.005133f, 0.677063f, 0.329591f),
-	ci::Color(0.000000f, 0.304595f, 0.803718f),
-	ci::Color(0.030158f, 0.000000f, 1.000000f),
-	ci::Color(0.305854f, 0.000000f, 1.000000f),
-	ci::Color(0.676006f, 0.000000f, 0.771564f),
-	ci::Color(1.000000f, 0.000000f, 0.285355f),
-	ci::Color(1.000000f, 0.000000f, 0.000000f),
-	ci::Color(1.000000f, 0.126086f, 0.000000f),
-	ci::Color(1.000000f, 0.687666f, 0.000000f),
-	ci::Color(1.000000f, 0.965954f, 0.000000f),
-	ci::Color(0.702791f, 1.000000f, 0.000000f),
-	ci::Color(0.329507f, 0.998255f, 0.000000)
+const std::array<const Color, 128> MPLPrism::palette{{
+	Color(1.000000f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.320298f, 0.000000f),
+	Color(1.000000f, 0.690910f, 0.000000f),
+	Color(1.000000f, 0.967906f, 0.000000f),
+	Color(0.699099f, 1.000000f, 0.000000f),
+	Color(0.326218f, 0.996569f, 0.000000f),
+	Color(0.042511f, 0.740801f, 0.224725f),
+	Color(0.000000f, 0.378476f, 0.725917f),
+	Color(0.000000f, 0.003577f, 1.000000f),
+	Color(0.100146f, 0.000000f, 1.000000f),
+	Color(0.602179f, 0.000000f, 0.844967f),
+	Color(0.794621f, 0.000000f, 0.637761f),
+	Color(1.000000f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.056056f, 0.000000f),
+	Color(1.000000f, 0.621063f, 0.000000f),
+	Color(1.000000f, 0.787487f, 0.000000f),
+	Color(0.776362f, 1.000000f, 0.000000f),
+	Color(0.396916f, 1.000000f, 0.000000f),
+	Color(0.228041f, 0.935947f, 0.000000f),
+	Color(0.000000f, 0.455532f, 0.636657f),
+	Color(0.000000f, 0.075077f, 0.995886f),
+	Color(0.181686f, 0.000000f, 1.000000f),
+	Color(0.342745f, 0.000000f, 1.000000f),
+	Color(0.906591f, 0.000000f, 0.492737f),
+	Color(1.000000f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.166393f, 0.000000f),
+	Color(1.000000f, 0.358175f, 0.000000f),
+	Color(1.000000f, 0.873235f, 0.000000f),
+	Color(0.852487f, 1.000000f, 0.000000f),
+	Color(0.470536f, 1.000000f, 0.000000f),
+	Color(0.293001f, 0.978361f, 0.000000f),
+	Color(0.000000f, 0.531245f, 0.540584f),
+	Color(0.000000f, 0.149306f, 0.942302f),
+	Color(0.125492f, 0.000000f, 1.000000f),
+	Color(0.450132f, 0.000000f, 0.971666f),
+	Color(0.831803f, 0.000000f, 0.591696f),
+	Color(1.000000f, 0.000000f, 0.058246f),
+	Color(1.000000f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.472804f, 0.000000f),
+	Color(1.000000f, 0.816910f, 0.000000f),
+	Color(0.926660f, 1.000000f, 0.000000f),
+	Color(0.546290f, 1.000000f, 0.000000f),
+	Color(0.198010f, 0.912859f, 0.000000f),
+	Color(0.000000f, 0.604804f, 0.438728f),
+	Color(0.000000f, 0.225468f, 0.878635f),
+	Color(0.000000f, 0.039789f, 1.000000f),
+	Color(0.377235f, 0.000000f, 1.000000f),
+	Color(0.755285f, 0.000000f, 0.684324f),
+	Color(1.000000f, 0.000000f, 0.171409f),
+	Color(1.000000f, 0.019471f, 0.000000f),
+	Color(1.000000f, 0.395980f, 0.000000f),
+	Color(1.000000f, 0.755376f, 0.000000f),
+	Color(0.998086f, 1.000000f, 0.000000f),
+	Color(0.815525f, 1.000000f, 0.000000f),
+	Color(0.260746f, 0.958499f, 0.000000f),
+	Color(0.004280f, 0.675423f, 0.332176f),
+	Color(0.000000f, 0.302748f, 0.805567f),
+	Color(0.031124f, 0.000000f, 1.000000f),
+	Color(0.307471f, 0.000000f, 1.000000f),
+	Color(0.677854f, 0.000000f, 0.769630f),
+	Color(1.000000f, 0.000000f, 0.282737f),
+	Color(1.000000f, 0.000000f, 0.002710f),
+	Color(1.000000f, 0.318450f, 0.000000f),
+	Color(1.000000f, 0.689289f, 0.000000f),
+	Color(1.000000f, 0.966932f, 0.000000f),
+	Color(0.700945f, 1.000000f, 0.000000f),
+	Color(0.327862f, 0.997414f, 0.000000f),
+	Color(0.043525f, 0.742346f, 0.222071f),
+	Color(0.000000f, 0.380320f, 0.723878f),
+	Color(0.000000f, 0.005241f, 1.000000f),
+	Color(0.241586f, 0.000000f, 1.000000f),
+	Color(0.600339f, 0.000000f, 0.846700f),
+	Color(0.977161f, 0.000000f, 0.391040f),
+	Color(1.000000f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.241044f, 0.000000f),
+	Color(1.000000f, 0.433617f, 0.000000f),
+	Color(1.000000f, 0.922616f, 0.000000f),
+	Color(0.778191f, 1.000000f, 0.000000f),
+	Color(0.398638f, 1.000000f, 0.000000f),
+	Color(0.089474f, 0.804857f, 0.109589f),
+	Color(0.000000f, 0.457354f, 0.634445f),
+	Color(0.000000f, 0.076816f, 0.994732f),
+	Color(0.180284f, 0.000000f, 1.000000f),
+	Color(0.523569f, 0.000000f, 0.914711f),
+	Color(0.904836f, 0.000000f, 0.495159f),
+	Color(1.000000f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.164590f, 0.000000f),
+	Color(1.000000f, 0.546332f, 0.000000f),
+	Color(1.000000f, 0.871959f, 0.000000f),
+	Color(0.854279f, 1.000000f, 0.000000f),
+	Color(0.472318f, 1.000000f, 0.000000f),
+	Color(0.294600f, 0.979288f, 0.000000f),
+	Color(0.000000f, 0.533024f, 0.538222f),
+	Color(0.000000f, 0.151100f, 0.940901f),
+	Color(0.124223f, 0.000000f, 1.000000f),
+	Color(0.448366f, 0.000000f, 0.972934f),
+	Color(0.829998f, 0.000000f, 0.593979f),
+	Color(1.000000f, 0.000000f, 0.060953f),
+	Color(1.000000f, 0.089905f, 0.000000f),
+	Color(1.000000f, 0.470990f, 0.000000f),
+	Color(1.000000f, 0.815503f, 0.000000f),
+	Color(0.928395f, 1.000000f, 0.000000f),
+	Color(0.548113f, 1.000000f, 0.000000f),
+	Color(0.199447f, 0.914021f, 0.000000f),
+	Color(0.000000f, 0.606523f, 0.436241f),
+	Color(0.000000f, 0.227298f, 0.877002f),
+	Color(0.074002f, 0.000000f, 1.000000f),
+	Color(0.209590f, 0.000000f, 1.000000f),
+	Color(0.753449f, 0.000000f, 0.686444f),
+	Color(1.000000f, 0.000000f, 0.174085f),
+	Color(1.000000f, 0.017789f, 0.000000f),
+	Color(1.000000f, 0.394139f, 0.000000f),
+	Color(1.000000f, 0.753852f, 0.000000f),
+	Color(0.999747f, 1.000000f, 0.000000f),
+	Color(0.625213f, 1.000000f, 0.000000f),
+	Color(0.262296f, 0.959506f, 0.000000f),
+	Color(0.005133f, 0.677063f, 0.329591f),
+	Color(0.000000f, 0.304595f, 0.803718f),
+	Color(0.030158f, 0.000000f, 1.000000f),
+	Color(0.305854f, 0.000000f, 1.000000f),
+	Color(0.676006f, 0.000000f, 0.771564f),
+	Color(1.000000f, 0.000000f, 0.285355f),
+	Color(1.000000f, 0.000000f, 0.000000f),
+	Color(1.000000f, 0.126086f, 0.000000f),
+	Color(1.000000f, 0.687666f, 0.000000f),
+	Color(1.000000f, 0.965954f, 0.000000f),
+	Color(0.702791f, 1.000000f, 0.000000f),
+	Color(0.329507f, 0.998255f, 0.000000)
 }};
 
 // Generated from:
 // http://www.ncl.ucar.edu/Document/Graphics/ColorTables/Files/SVG_Lindaa07.rgb
 
-const std::array<const ci::Colorf, 220> SVGLindaa07::palette{{
-	ci::Color(0.078431f, 0.12549f, 0.43922f),
-	ci::Color(0.10980f, 0.15686f, 0.43922f),
-	ci::Color(0.14118f, 0.18824f, 0.45490f),
-	ci::Color(0.17255f, 0.20392f, 0.45490f),
-	ci::Color(0.20392f, 0.23529f, 0.47059f),
-	ci::Color(0.21961f, 0.26667f, 0.47059f),
-	ci::Color(0.25098f, 0.29804f, 0.48627f),
-	ci::Color(0.31373f, 0.34510f, 0.50196f),
-	ci::Color(0.34510f, 0.37647f, 0.50196f),
-	ci::Color(0.36078f, 0.39216f, 0.51765f),
-	ci::Color(0.39216f, 0.42353f, 0.51765f),
-	ci::Color(0.42353f, 0.45490f, 0.53333f),
-	ci::Color(0.45490f, 0.48627f, 0.53333f),
-	ci::Color(0.51765f, 0.53333f, 0.54902f),
-	ci::Color(0.53333f, 0.56471f, 0.54902f),
-	ci::Color(0.56471f, 0.58039f, 0.56471f),
-	ci::Color(0.59608f, 0.61176f, 0.56471f),
-	ci::Color(0.62745f, 0.64314f, 0.58039f),
-	ci::Color(0.65882f, 0.67451f, 0.58039f),
-	ci::Color(0.70588f, 0.72157f, 0.59608f),
-	ci::Color(0.73725f, 0.75294f, 0.61176f),
-	ci::Color(0.76863f, 0.76863f, 0.61176f),
-	ci::Color(0.80000f, 0.80000f, 0.62745f),
-	ci::Color(0.81569f, 0.83137f, 0.62745f),
-	ci::Color(0.84706f, 0.86275f, 0.64314f),
-	ci::Color(0.90980f, 0.90980f, 0.65882f),
-	ci::Color(0.94118f, 0.94118f, 0.65882f),
-	ci::Color(0.97255f, 0.97255f, 0.67451f),
-	ci::Color(0.95686f, 0.95686f, 0.65882f),
-	ci::Color(0.92549f, 0.94118f, 0.64314f),
-	ci::Color(0.89412f, 0.90980f, 0.62745f),
-	ci::Color(0.83137f, 0.87843f, 0.59608f),
-	ci::Color(0.80000f, 0.84706f, 0.56471f),
-	ci::Color(0.76863f, 0.83137f, 0.54902f),
-	ci::Color(0.73725f, 0.80000f, 0.53333f),
-	ci::Color(0.70588f, 0.78431f, 0.51765f),
-	ci::Color(0.67451f, 0.76863f, 0.50196f),
-	ci::Color(0.62745f, 0.72157f, 0.45490f),
-	ci::Color(0.59608f, 0.70588f, 0.43922f),
-	ci::Color(0.56471f, 0.67451f, 0.42353f),
-	ci::Color(0.53333f, 0.65882f, 0.40784f),
-	ci::Color(0.50196f, 0.62745f, 0.37647f),
-	ci::Color(0.47059f, 0.61176f, 0.36078f),
-	ci::Color(0.40784f, 0.56471f, 0.32941f),
-	ci::Color(0.37647f, 0.54902f, 0.31373f),
-	ci::Color(0.34510f, 0.53333f, 0.29804f),
-	ci::Color(0.32941f, 0.50196f, 0.26667f),
-	ci::Color(0.29804f, 0.48627f, 0.25098f),
-	ci::Color(0.26667f, 0.45490f, 0.23529f),
-	ci::Color(0.20392f, 0.42353f, 0.20392f),
-	ci::Color(0.17255f, 0.39216f, 0.17255f),
-	ci::Color(0.14118f, 0.37647f, 0.15686f),
-	ci::Color(0.10980f, 0.36078f, 0.14118f),
-	ci::Color(0.078431f, 0.32941f, 0.12549f),
-	ci::Color(0.047059f, 0.31373f, 0.10980f),
-	ci::Color(0.031373f, 0.29804f, 0.094118f),
-	ci::Color(0.047059f, 0.31373f, 0.10980f),
-	ci::Color(0.062745f, 0.34510f, 0.12549f),
-	ci::Color(0.094118f, 0.36078f, 0.14118f),
-	ci::Color(0.10980f, 0.37647f, 0.15686f),
-	ci::Color(0.12549f, 0.40784f, 0.17255f),
-	ci::Color(0.17255f, 0.43922f, 0.21961f),
-	ci::Color(0.18824f, 0.47059f, 0.23529f),
-	ci::Color(0.20392f, 0.48627f, 0.25098f),
-	ci::Color(0.23529f, 0.50196f, 0.26667f),
-	ci::Color(0.25098f, 0.53333f, 0.28235f),
-	ci::Color(0.26667f, 0.54902f, 0.31373f),
-	ci::Color(0.31373f, 0.59608f, 0.34510f),
-	ci::Color(0.32941f, 0.61176f, 0.36078f),
-	ci::Color(0.34510f, 0.62745f, 0.37647f),
-	ci::Color(0.37647f, 0.65882f, 0.39216f),
-	ci::Color(0.39216f, 0.67451f, 0.40784f),
-	ci::Color(0.40784f, 0.69020f, 0.43922f),
-	ci::Color(0.45490f, 0.73725f, 0.47059f),
-	ci::Color(0.47059f, 0.75294f, 0.48627f),
-	ci::Color(0.48627f, 0.78431f, 0.50196f),
-	ci::Color(0.51765f, 0.80000f, 0.51765f),
-	ci::Color(0.53333f, 0.81569f, 0.54902f),
-	ci::Color(0.54902f, 0.84706f, 0.56471f),
-	ci::Color(0.56471f, 0.86275f, 0.58039f),
-	ci::Color(0.61176f, 0.90980f, 0.61176f),
-	ci::Color(0.62745f, 0.92549f, 0.62745f),
-	ci::Color(0.65882f, 0.95686f, 0.65882f),
-	ci::Color(0.64314f, 0.94118f, 0.65882f),
-	ci::Color(0.62745f, 0.92549f, 0.64314f),
-	ci::Color(0.61176f, 0.89412f, 0.62745f),
-	ci::Color(0.58039f, 0.84706f, 0.61176f),
-	ci::Color(0.56471f, 0.83137f, 0.59608f),
-	ci::Color(0.53333f, 0.80000f, 0.58039f),
-	ci::Color(0.51765f, 0.78431f, 0.58039f),
-	ci::Color(0.50196f, 0.75294f, 0.56471f),
-	ci::Color(0.48627f, 0.73725f, 0.54902f),
-	ci::Color(0.45490f, 0.69020f, 0.53333f),
-	ci::Color(0.42353f, 0.65882f, 0.51765f),
-	ci::Color(0.40784f, 0.64314f, 0.50196f),
-	ci::Color(0.39216f, 0.61176f, 0.50196f),
-	ci::Color(0.37647f, 0.59608f, 0.48627f),
-	ci::Color(0.36078f, 0.58039f, 0.47059f),
-	ci::Color(0.32941f, 0.53333f, 0.45490f),
-	ci::Color(0.29804f, 0.50196f, 0.43922f),
-	ci::Color(0.28235f, 0.48627f, 0.42353f),
-	ci::Color(0.26667f, 0.45490f, 0.42353f),
-	ci::Color(0.25098f, 0.43922f, 0.40784f),
-	ci::Color(0.23529f, 0.40784f, 0.39216f),
-	ci::Color(0.18824f, 0.36078f, 0.37647f),
-	ci::Color(0.17255f, 0.34510f, 0.36078f),
-	ci::Color(0.15686f, 0.31373f, 0.34510f),
-	ci::Color(0.14118f, 0.29804f, 0.34510f),
-	ci::Color(0.12549f, 0.26667f, 0.32941f),
-	ci::Color(0.10980f, 0.25098f, 0.31373f),
-	ci::Color(0.094118f, 0.23529f, 0.31373f),
-	ci::Color(0.10980f, 0.26667f, 0.32941f),
-	ci::Color(0.12549f, 0.28235f, 0.36078f),
-	ci::Color(0.14118f, 0.31373f, 0.37647f),
-	ci::Color(0.15686f, 0.32941f, 0.39216f),
-	ci::Color(0.18824f, 0.36078f, 0.42353f),
-	ci::Color(0.21961f, 0.40784f, 0.47059f),
-	ci::Color(0.23529f, 0.42353f, 0.48627f),
-	ci::Color(0.25098f, 0.45490f, 0.50196f),
-	ci::Color(0.28235f, 0.47059f, 0.53333f),
-	ci::Color(0.29804f, 0.50196f, 0.54902f),
-	ci::Color(0.31373f, 0.51765f, 0.56471f),
-	ci::Color(0.34510f, 0.56471f, 0.61176f),
-	ci::Color(0.37647f, 0.59608f, 0.64314f),
-	ci::Color(0.39216f, 0.62745f, 0.65882f),
-	ci::Color(0.40784f, 0.64314f, 0.67451f),
-	ci::Color(0.42353f, 0.67451f, 0.70588f),
-	ci::Color(0.43922f, 0.69020f, 0.72157f),
-	ci::Color(0.48627f, 0.73725f, 0.76863f),
-	ci::Color(0.50196f, 0.76863f, 0.78431f),
-	ci::Color(0.51765f, 0.78431f, 0.81569f),
-	ci::Color(0.53333f, 0.81569f, 0.83137f),
-	ci::Color(0.54902f, 0.83137f, 0.84706f),
-	ci::Color(0.58039f, 0.86275f, 0.87843f),
-	ci::Color(0.61176f, 0.90980f, 0.90980f),
-	ci::Color(0.62745f, 0.92549f, 0.94118f),
-	ci::Color(0.64314f, 0.95686f, 0.95686f),
-	ci::Color(0.67451f, 0.98824f, 0.98824f),
-	ci::Color(0.67451f, 0.97255f, 0.97255f),
-	ci::Color(0.65882f, 0.94118f, 0.95686f),
-	ci::Color(0.62745f, 0.89412f, 0.92549f),
-	ci::Color(0.61176f, 0.86275f, 0.90980f),
-	ci::Color(0.59608f, 0.84706f, 0.87843f),
-	ci::Color(0.58039f, 0.81569f, 0.86275f),
-	ci::Color(0.56471f, 0.78431f, 0.84706f),
-	ci::Color(0.54902f, 0.76863f, 0.83137f),
-	ci::Color(0.53333f, 0.73725f, 0.81569f),
-	ci::Color(0.50196f, 0.69020f, 0.76863f),
-	ci::Color(0.48627f, 0.65882f, 0.75294f),
-	ci::Color(0.47059f, 0.62745f, 0.73725f),
-	ci::Color(0.45490f, 0.61176f, 0.72157f),
-	ci::Color(0.43922f, 0.58039f, 0.69020f),
-	ci::Color(0.42353f, 0.54902f, 0.67451f),
-	ci::Color(0.39216f, 0.50196f, 0.64314f),
-	ci::Color(0.37647f, 0.47059f, 0.62745f),
-	ci::Color(0.36078f, 0.45490f, 0.61176f),
-	ci::Color(0.34510f, 0.42353f, 0.58039f),
-	ci::Color(0.32941f, 0.39216f, 0.56471f),
-	ci::Color(0.31373f, 0.37647f, 0.54902f),
-	ci::Color(0.28235f, 0.31373f, 0.51765f),
-	ci::Color(0.26667f, 0.29804f, 0.48627f),
-	ci::Color(0.25098f, 0.26667f, 0.47059f),
-	ci::Color(0.23529f, 0.23529f, 0.45490f),
-	ci::Color(0.21961f, 0.21961f, 0.43922f),
-	ci::Color(0.20392f, 0.18824f, 0.42353f),
-	ci::Color(0.20392f, 0.17255f, 0.40784f),
-	ci::Color(0.21961f, 0.18824f, 0.42353f),
-	ci::Color(0.23529f, 0.20392f, 0.43922f),
-	ci::Color(0.25098f, 0.21961f, 0.45490f),
-	ci::Color(0.26667f, 0.23529f, 0.47059f),
-	ci::Color(0.28235f, 0.25098f, 0.48627f),
-	ci::Color(0.32941f, 0.28235f, 0.51765f),
-	ci::Color(0.34510f, 0.29804f, 0.53333f),
-	ci::Color(0.36078f, 0.31373f, 0.54902f),
-	ci::Color(0.37647f, 0.32941f, 0.56471f),
-	ci::Color(0.39216f, 0.34510f, 0.58039f),
-	ci::Color(0.40784f, 0.36078f, 0.59608f),
-	ci::Color(0.43922f, 0.39216f, 0.62745f),
-	ci::Color(0.47059f, 0.42353f, 0.64314f),
-	ci::Color(0.48627f, 0.43922f, 0.65882f),
-	ci::Color(0.50196f, 0.45490f, 0.67451f),
-	ci::Color(0.51765f, 0.47059f, 0.69020f),
-	ci::Color(0.53333f, 0.48627f, 0.70588f),
-	ci::Color(0.56471f, 0.51765f, 0.73725f),
-	ci::Color(0.58039f, 0.53333f, 0.75294f),
-	ci::Color(0.61176f, 0.54902f, 0.76863f),
-	ci::Color(0.62745f, 0.56471f, 0.78431f),
-	ci::Color(0.64314f, 0.58039f, 0.80000f),
-	ci::Color(0.65882f, 0.59608f, 0.81569f),
-	ci::Color(0.69020f, 0.62745f, 0.84706f),
-	ci::Color(0.70588f, 0.64314f, 0.86275f),
-	ci::Color(0.72157f, 0.65882f, 0.87843f),
-	ci::Color(0.75294f, 0.69020f, 0.89412f),
-	ci::Color(0.73725f, 0.67451f, 0.89412f),
-	ci::Color(0.72157f, 0.65882f, 0.87843f),
-	ci::Color(0.67451f, 0.62745f, 0.84706f),
-	ci::Color(0.64314f, 0.61176f, 0.83137f),
-	ci::Color(0.62745f, 0.58039f, 0.81569f),
-	ci::Color(0.61176f, 0.56471f, 0.80000f),
-	ci::Color(0.58039f, 0.54902f, 0.78431f),
-	ci::Color(0.56471f, 0.53333f, 0.76863f),
-	ci::Color(0.51765f, 0.48627f, 0.73725f),
-	ci::Color(0.48627f, 0.47059f, 0.72157f),
-	ci::Color(0.47059f, 0.45490f, 0.70588f),
-	ci::Color(0.45490f, 0.43922f, 0.69020f),
-	ci::Color(0.42353f, 0.42353f, 0.67451f),
-	ci::Color(0.40784f, 0.39216f, 0.67451f),
-	ci::Color(0.36078f, 0.36078f, 0.64314f),
-	ci::Color(0.34510f, 0.34510f, 0.62745f),
-	ci::Color(0.31373f, 0.32941f, 0.61176f),
-	ci::Color(0.29804f, 0.29804f, 0.59608f),
-	ci::Color(0.26667f, 0.28235f, 0.58039f),
-	ci::Color(0.25098f, 0.26667f, 0.56471f),
-	ci::Color(0.20392f, 0.23529f, 0.53333f),
-	ci::Color(0.18824f, 0.20392f, 0.51765f),
-	ci::Color(0.15686f, 0.18824f, 0.50196f),
-	ci::Color(0.14118f, 0.17255f, 0.48627f),
-	ci::Color(0.10980f, 0.15686f, 0.47059f),
-	ci::Color(0.094118f, 0.14118f, 0.45490f),
-	ci::Color(0.062745f, 0.10980f, 0.43922f)
+const std::array<const Color, 220> SVGLindaa07::palette{{
+	Color(0.078431f, 0.12549f, 0.43922f),
+	Color(0.10980f, 0.15686f, 0.43922f),
+	Color(0.14118f, 0.18824f, 0.45490f),
+	Color(0.17255f, 0.20392f, 0.45490f),
+	Color(0.20392f, 0.23529f, 0.47059f),
+	Color(0.21961f, 0.26667f, 0.47059f),
+	Color(0.25098f, 0.29804f, 0.48627f),
+	Color(0.31373f, 0.34510f, 0.50196f),
+	Color(0.34510f, 0.37647f, 0.50196f),
+	Color(0.36078f, 0.39216f, 0.51765f),
+	Color(0.39216f, 0.42353f, 0.51765f),
+	Color(0.42353f, 0.45490f, 0.53333f),
+	Color(0.45490f, 0.48627f, 0.53333f),
+	Color(0.51765f, 0.53333f, 0.54902f),
+	Color(0.53333f, 0.56471f, 0.54902f),
+	Color(0.56471f, 0.58039f, 0.56471f),
+	Color(0.59608f, 0.61176f, 0.56471f),
+	Color(0.62745f, 0.64314f, 0.58039f),
+	Color(0.65882f, 0.67451f, 0.58039f),
+	Color(0.70588f, 0.72157f, 0.59608f),
+	Color(0.73725f, 0.75294f, 0.61176f),
+	Color(0.76863f, 0.76863f, 0.61176f),
+	Color(0.80000f, 0.80000f, 0.62745f),
+	Color(0.81569f, 0.83137f, 0.62745f),
+	Color(0.84706f, 0.86275f, 0.64314f),
+	Color(0.90980f, 0.90980f, 0.65882f),
+	Color(0.94118f, 0.94118f, 0.65882f),
+	Color(0.97255f, 0.97255f, 0.67451f),
+	Color(0.95686f, 0.95686f, 0.65882f),
+	Color(0.92549f, 0.94118f, 0.64314f),
+	Color(0.89412f, 0.90980f, 0.62745f),
+	Color(0.83137f, 0.87843f, 0.59608f),
+	Color(0.80000f, 0.84706f, 0.56471f),
+	Color(0.76863f, 0.83137f, 0.54902f),
+	Color(0.73725f, 0.80000f, 0.53333f),
+	Color(0.70588f, 0.78431f, 0.51765f),
+	Color(0.67451f, 0.76863f, 0.50196f),
+	Color(0.62745f, 0.72157f, 0.45490f),
+	Color(0.59608f, 0.70588f, 0.43922f),
+	Color(0.56471f, 0.67451f, 0.42353f),
+	Color(0.53333f, 0.65882f, 0.40784f),
+	Color(0.50196f, 0.62745f, 0.37647f),
+	Color(0.47059f, 0.61176f, 0.36078f),
+	Color(0.40784f, 0.56471f, 0.32941f),
+	Color(0.37647f, 0.54902f, 0.31373f),
+	Color(0.34510f, 0.53333f, 0.29804f),
+	Color(0.32941f, 0.50196f, 0.26667f),
+	Color(0.29804f, 0.48627f, 0.25098f),
+	Color(0.26667f, 0.45490f, 0.23529f),
+	Color(0.20392f, 0.42353f, 0.20392f),
+	Color(0.17255f, 0.39216f, 0.17255f),
+	Color(0.14118f, 0.37647f, 0.15686f),
+	Color(0.10980f, 0.36078f, 0.14118f),
+	Color(0.078431f, 0.32941f, 0.12549f),
+	Color(0.047059f, 0.31373f, 0.10980f),
+	Color(0.031373f, 0.29804f, 0.094118f),
+	Color(0.047059f, 0.31373f, 0.10980f),
+	Color(0.062745f, 0.34510f, 0.12549f),
+	Color(0.094118f, 0.36078f, 0.14118f),
+	Color(0.10980f, 0.37647f, 0.15686f),
+	Color(0.12549f, 0.40784f, 0.17255f),
+	Color(0.17255f, 0.43922f, 0.21961f),
+	Color(0.18824f, 0.47059f, 0.23529f),
+	Color(0.20392f, 0.48627f, 0.25098f),
+	Color(0.23529f, 0.50196f, 0.26667f),
+	Color(0.25098f, 0.53333f, 0.28235f),
+	Color(0.26667f, 0.54902f, 0.31373f),
+	Color(0.31373f, 0.59608f, 0.34510f),
+	Color(0.32941f, 0.61176f, 0.36078f),
+	Color(0.34510f, 0.62745f, 0.37647f),
+	Color(0.37647f, 0.65882f, 0.39216f),
+	Color(0.39216f, 0.67451f, 0.40784f),
+	Color(0.40784f, 0.69020f, 0.43922f),
+	Color(0.45490f, 0.73725f, 0.47059f),
+	Color(0.47059f, 0.75294f, 0.48627f),
+	Color(0.48627f, 0.78431f, 0.50196f),
+	Color(0.51765f, 0.80000f, 0.51765f),
+	Color(0.53333f, 0.81569f, 0.54902f),
+	Color(0.54902f, 0.84706f, 0.56471f),
+	Color(0.56471f, 0.86275f, 0.58039f),
+	Color(0.61176f, 0.90980f, 0.61176f),
+	Color(0.62745f, 0.92549f, 0.62745f),
+	Color(0.65882f, 0.95686f, 0.65882f),
+	Color(0.64314f, 0.94118f, 0.65882f),
+	Color(0.62745f, 0.92549f, 0.64314f),
+	Color(0.61176f, 0.89412f, 0.62745f),
+	Color(0.58039f, 0.84706f, 0.61176f),
+	Color(0.56471f, 0.83137f, 0.59608f),
+	Color(0.53333f, 0.80000f, 0.58039f),
+	Color(0.51765f, 0.78431f, 0.58039f),
+	Color(0.50196f, 0.75294f, 0.56471f),
+	Color(0.48627f, 0.73725f, 0.54902f),
+	Color(0.45490f, 0.69020f, 0.53333f),
+	Color(0.42353f, 0.65882f, 0.51765f),
+	Color(0.40784f, 0.64314f, 0.50196f),
+	Color(0.39216f, 0.61176f, 0.50196f),
+	Color(0.37647f, 0.59608f, 0.48627f),
+	Color(0.36078f, 0.58039f, 0.47059f),
+	Color(0.32941f, 0.53333f, 0.45490f),
+	Color(0.29804f, 0.50196f, 0.43922f),
+	Color(0.28235f, 0.48627f, 0.42353f),
+	Color(0.26667f, 0.45490f, 0.42353f),
+	Color(0.25098f, 0.43922f, 0.40784f),
+	Color(0.23529f, 0.40784f, 0.39216f),
+	Color(0.18824f, 0.36078f, 0.37647f),
+	Color(0.17255f, 0.34510f, 0.36078f),
+	Color(0.15686f, 0.31373f, 0.34510f),
+	Color(0.14118f, 0.29804f, 0.34510f),
+	Color(0.12549f, 0.26667f, 0.32941f),
+	Color(0.10980f, 0.25098f, 0.31373f),
+	Color(0.094118f, 0.23529f, 0.31373f),
+	Color(0.10980f, 0.26667f, 0.32941f),
+	Color(0.12549f, 0.28235f, 0.36078f),
+	Color(0.14118f, 0.31373f, 0.37647f),
+	Color(0.15686f, 0.32941f, 0.39216f),
+	Color(0.18824f, 0.36078f, 0.42353f),
+	Color(0.21961f, 0.40784f, 0.47059f),
+	Color(0.23529f, 0.42353f, 0.48627f),
+	Color(0.25098f, 0.45490f, 0.50196f),
+	Color(0.28235f, 0.47059f, 0.53333f),
+	Color(0.29804f, 0.50196f, 0.54902f),
+	Color(0.31373f, 0.51765f, 0.56471f),
+	Color(0.34510f, 0.56471f, 0.61176f),
+	Color(0.37647f, 0.59608f, 0.64314f),
+	Color(0.39216f, 0.62745f, 0.65882f),
+	Color(0.40784f, 0.64314f, 0.67451f),
+	Color(0.42353f, 0.67451f, 0.70588f),
+	Color(0.43922f, 0.69020f, 0.72157f),
+	Color(0.48627f, 0.73725f, 0.76863f),
+	Color(0.50196f, 0.76863f, 0.78431f),
+	Color(0.51765f, 0.78431f, 0.81569f),
+	Color(0.53333f, 0.81569f, 0.83137f),
+	Color(0.54902f, 0.83137f, 0.84706f),
+	Color(0.58039f, 0.86275f, 0.87843f),
+	Color(0.61176f, 0.90980f, 0.90980f),
+	Color(0.62745f, 0.92549f, 0.94118f),
+	Color(0.64314f, 0.95686f, 0.95686f),
+	Color(0.67451f, 0.98824f, 0.98824f),
+	Color(0.67451f, 0.97255f, 0.97255f),
+	Color(0.65882f, 0.94118f, 0.95686f),
+	Color(0.62745f, 0.89412f, 0.92549f),
+	Color(0.61176f, 0.86275f, 0.90980f),
+	Color(0.59608f, 0.84706f, 0.87843f),
+	Color(0.58039f, 0.81569f, 0.86275f),
+	Color(0.56471f, 0.78431f, 0.84706f),
+	Color(0.54902f, 0.76863f, 0.83137f),
+	Color(0.53333f, 0.73725f, 0.81569f),
+	Color(0.50196f, 0.69020f, 0.76863f),
+	Color(0.48627f, 0.65882f, 0.75294f),
+	Color(0.47059f, 0.62745f, 0.73725f),
+	Color(0.45490f, 0.61176f, 0.72157f),
+	Color(0.43922f, 0.58039f, 0.69020f),
+	Color(0.42353f, 0.54902f, 0.67451f),
+	Color(0.39216f, 0.50196f, 0.64314f),
+	Color(0.37647f, 0.47059f, 0.62745f),
+	Color(0.36078f, 0.45490f, 0.61176f),
+	Color(0.34510f, 0.42353f, 0.58039f),
+	Color(0.32941f, 0.39216f, 0.56471f),
+	Color(0.31373f, 0.37647f, 0.54902f),
+	Color(0.28235f, 0.31373f, 0.51765f),
+	Color(0.26667f, 0.29804f, 0.48627f),
+	Color(0.25098f, 0.26667f, 0.47059f),
+	Color(0.23529f, 0.23529f, 0.45490f),
+	Color(0.21961f, 0.21961f, 0.43922f),
+	Color(0.20392f, 0.18824f, 0.42353f),
+	Color(0.20392f, 0.17255f, 0.40784f),
+	Color(0.21961f, 0.18824f, 0.42353f),
+	Color(0.23529f, 0.20392f, 0.43922f),
+	Color(0.25098f, 0.21961f, 0.45490f),
+	Color(0.26667f, 0.23529f, 0.47059f),
+	Color(0.28235f, 0.25098f, 0.48627f),
+	Color(0.32941f, 0.28235f, 0.51765f),
+	Color(0.34510f, 0.29804f, 0.53333f),
+	Color(0.36078f, 0.31373f, 0.54902f),
+	Color(0.37647f, 0.32941f, 0.56471f),
+	Color(0.39216f, 0.34510f, 0.58039f),
+	Color(0.40784f, 0.36078f, 0.59608f),
+	Color(0.43922f, 0.39216f, 0.62745f),
+	Color(0.47059f, 0.42353f, 0.64314f),
+	Color(0.48627f, 0.43922f, 0.65882f),
+	Color(0.50196f, 0.45490f, 0.67451f),
+	Color(0.51765f, 0.47059f, 0.69020f),
+	Color(0.53333f, 0.48627f, 0.70588f),
+	Color(0.56471f, 0.51765f, 0.73725f),
+	Color(0.58039f, 0.53333f, 0.75294f),
+	Color(0.61176f, 0.54902f, 0.76863f),
+	Color(0.62745f, 0.56471f, 0.78431f),
+	Color(0.64314f, 0.58039f, 0.80000f),
+	Color(0.65882f, 0.59608f, 0.81569f),
+	Color(0.69020f, 0.62745f, 0.84706f),
+	Color(0.70588f, 0.64314f, 0.86275f),
+	Color(0.72157f, 0.65882f, 0.87843f),
+	Color(0.75294f, 0.69020f, 0.89412f),
+	Color(0.73725f, 0.67451f, 0.89412f),
+	Color(0.72157f, 0.65882f, 0.87843f),
+	Color(0.67451f, 0.62745f, 0.84706f),
+	Color(0.64314f, 0.61176f, 0.83137f),
+	Color(0.62745f, 0.58039f, 0.81569f),
+	Color(0.61176f, 0.56471f, 0.80000f),
+	Color(0.58039f, 0.54902f, 0.78431f),
+	Color(0.56471f, 0.53333f, 0.76863f),
+	Color(0.51765f, 0.48627f, 0.73725f),
+	Color(0.48627f, 0.47059f, 0.72157f),
+	Color(0.47059f, 0.45490f, 0.70588f),
+	Color(0.45490f, 0.43922f, 0.69020f),
+	Color(0.42353f, 0.42353f, 0.67451f),
+	Color(0.40784f, 0.39216f, 0.67451f),
+	Color(0.36078f, 0.36078f, 0.64314f),
+	Color(0.34510f, 0.34510f, 0.62745f),
+	Color(0.31373f, 0.32941f, 0.61176f),
+	Color(0.29804f, 0.29804f, 0.59608f),
+	Color(0.26667f, 0.28235f, 0.58039f),
+	Color(0.25098f, 0.26667f, 0.56471f),
+	Color(0.20392f, 0.23529f, 0.53333f),
+	Color(0.18824f, 0.20392f, 0.51765f),
+	Color(0.15686f, 0.18824f, 0.50196f),
+	Color(0.14118f, 0.17255f, 0.48627f),
+	Color(0.10980f, 0.15686f, 0.47059f),
+	Color(0.094118f, 0.14118f, 0.45490f),
+	Color(0.062745f, 0.10980f, 0.43922f)
 }};
 
 // Generated from:
 // http://www.ncl.ucar.edu/Document/Graphics/ColorTables/Files/SVG_Gallet13.rgb
 
-const std::array<const ci::Colorf, 220> SVGGallet13::palette{{
-	ci::Color(0.39216f, 0.70588f, 0.70588f),
-	ci::Color(0.39216f, 0.70588f, 0.70588f),
-	ci::Color(0.40784f, 0.72157f, 0.72157f),
-	ci::Color(0.42353f, 0.72157f, 0.72157f),
-	ci::Color(0.42353f, 0.73725f, 0.73725f),
-	ci::Color(0.43922f, 0.75294f, 0.75294f),
-	ci::Color(0.45490f, 0.75294f, 0.75294f),
-	ci::Color(0.47059f, 0.78431f, 0.78431f),
-	ci::Color(0.48627f, 0.78431f, 0.78431f),
-	ci::Color(0.48627f, 0.80000f, 0.80000f),
-	ci::Color(0.50196f, 0.80000f, 0.80000f),
-	ci::Color(0.51765f, 0.81569f, 0.81569f),
-	ci::Color(0.51765f, 0.83137f, 0.83137f),
-	ci::Color(0.54902f, 0.84706f, 0.84706f),
-	ci::Color(0.56471f, 0.86275f, 0.86275f),
-	ci::Color(0.58039f, 0.86275f, 0.86275f),
-	ci::Color(0.59608f, 0.86275f, 0.86275f),
-	ci::Color(0.61176f, 0.86275f, 0.86275f),
-	ci::Color(0.62745f, 0.87843f, 0.86275f),
-	ci::Color(0.65882f, 0.87843f, 0.84706f),
-	ci::Color(0.67451f, 0.89412f, 0.84706f),
-	ci::Color(0.69020f, 0.89412f, 0.84706f),
-	ci::Color(0.70588f, 0.89412f, 0.84706f),
-	ci::Color(0.72157f, 0.89412f, 0.84706f),
-	ci::Color(0.73725f, 0.90980f, 0.83137f),
-	ci::Color(0.76863f, 0.90980f, 0.83137f),
-	ci::Color(0.78431f, 0.92549f, 0.83137f),
-	ci::Color(0.80000f, 0.92549f, 0.83137f),
-	ci::Color(0.81569f, 0.92549f, 0.83137f),
-	ci::Color(0.83137f, 0.94118f, 0.81569f),
-	ci::Color(0.84706f, 0.94118f, 0.81569f),
-	ci::Color(0.87843f, 0.94118f, 0.81569f),
-	ci::Color(0.89412f, 0.95686f, 0.81569f),
-	ci::Color(0.90980f, 0.95686f, 0.80000f),
-	ci::Color(0.92549f, 0.95686f, 0.80000f),
-	ci::Color(0.94118f, 0.97255f, 0.80000f),
-	ci::Color(0.95686f, 0.97255f, 0.80000f),
-	ci::Color(0.98824f, 0.98824f, 0.78431f),
-	ci::Color(0.98824f, 0.97255f, 0.70588f),
-	ci::Color(0.98824f, 0.95686f, 0.62745f),
-	ci::Color(0.98824f, 0.92549f, 0.54902f),
-	ci::Color(0.98824f, 0.90980f, 0.47059f),
-	ci::Color(0.97255f, 0.89412f, 0.47059f),
-	ci::Color(0.94118f, 0.83137f, 0.43922f),
-	ci::Color(0.92549f, 0.80000f, 0.42353f),
-	ci::Color(0.90980f, 0.78431f, 0.42353f),
-	ci::Color(0.87843f, 0.75294f, 0.40784f),
-	ci::Color(0.86275f, 0.72157f, 0.39216f),
-	ci::Color(0.84706f, 0.69020f, 0.37647f),
-	ci::Color(0.81569f, 0.64314f, 0.36078f),
-	ci::Color(0.80000f, 0.61176f, 0.34510f),
-	ci::Color(0.76863f, 0.58039f, 0.32941f),
-	ci::Color(0.75294f, 0.54902f, 0.31373f),
-	ci::Color(0.73725f, 0.51765f, 0.29804f),
-	ci::Color(0.72157f, 0.50196f, 0.29804f),
-	ci::Color(0.69020f, 0.43922f, 0.26667f),
-	ci::Color(0.65882f, 0.40784f, 0.25098f),
-	ci::Color(0.64314f, 0.37647f, 0.23529f),
-	ci::Color(0.62745f, 0.36078f, 0.23529f),
-	ci::Color(0.61176f, 0.32941f, 0.21961f),
-	ci::Color(0.59608f, 0.29804f, 0.20392f),
-	ci::Color(0.54902f, 0.23529f, 0.17255f),
-	ci::Color(0.53333f, 0.21961f, 0.17255f),
-	ci::Color(0.51765f, 0.18824f, 0.15686f),
-	ci::Color(0.50196f, 0.15686f, 0.14118f),
-	ci::Color(0.48627f, 0.12549f, 0.12549f),
-	ci::Color(0.45490f, 0.094118f, 0.10980f),
-	ci::Color(0.47059f, 0.15686f, 0.14118f),
-	ci::Color(0.53333f, 0.23529f, 0.15686f),
-	ci::Color(0.59608f, 0.31373f, 0.17255f),
-	ci::Color(0.64314f, 0.36078f, 0.18824f),
-	ci::Color(0.67451f, 0.40784f, 0.20392f),
-	ci::Color(0.72157f, 0.47059f, 0.21961f),
-	ci::Color(0.80000f, 0.56471f, 0.26667f),
-	ci::Color(0.83137f, 0.62745f, 0.28235f),
-	ci::Color(0.87843f, 0.67451f, 0.29804f),
-	ci::Color(0.90980f, 0.72157f, 0.32941f),
-	ci::Color(0.95686f, 0.78431f, 0.34510f),
-	ci::Color(0.98824f, 0.83137f, 0.36078f),
-	ci::Color(0.92549f, 0.81569f, 0.39216f),
-	ci::Color(0.80000f, 0.78431f, 0.45490f),
-	ci::Color(0.73725f, 0.78431f, 0.48627f),
-	ci::Color(0.65882f, 0.76863f, 0.50196f),
-	ci::Color(0.59608f, 0.75294f, 0.53333f),
-	ci::Color(0.53333f, 0.73725f, 0.56471f),
-	ci::Color(0.47059f, 0.72157f, 0.59608f),
-	ci::Color(0.43922f, 0.67451f, 0.53333f),
-	ci::Color(0.42353f, 0.65882f, 0.48627f),
-	ci::Color(0.40784f, 0.62745f, 0.45490f),
-	ci::Color(0.37647f, 0.61176f, 0.42353f),
-	ci::Color(0.36078f, 0.58039f, 0.39216f),
-	ci::Color(0.34510f, 0.56471f, 0.36078f),
-	ci::Color(0.31373f, 0.51765f, 0.28235f),
-	ci::Color(0.29804f, 0.48627f, 0.25098f),
-	ci::Color(0.28235f, 0.47059f, 0.21961f),
-	ci::Color(0.26667f, 0.43922f, 0.18824f),
-	ci::Color(0.23529f, 0.42353f, 0.15686f),
-	ci::Color(0.21961f, 0.39216f, 0.10980f),
-	ci::Color(0.18824f, 0.34510f, 0.047059f),
-	ci::Color(0.15686f, 0.31373f, 0.0000f),
-	ci::Color(0.17255f, 0.29804f, 0.0000f),
-	ci::Color(0.18824f, 0.28235f, 0.0000f),
-	ci::Color(0.21961f, 0.26667f, 0.0000f),
-	ci::Color(0.23529f, 0.25098f, 0.0000f),
-	ci::Color(0.26667f, 0.21961f, 0.0000f),
-	ci::Color(0.29804f, 0.20392f, 0.0000f),
-	ci::Color(0.31373f, 0.18824f, 0.0000f),
-	ci::Color(0.32941f, 0.15686f, 0.0000f),
-	ci::Color(0.34510f, 0.14118f, 0.0000f),
-	ci::Color(0.37647f, 0.12549f, 0.0000f),
-	ci::Color(0.40784f, 0.094118f, 0.0000f),
-	ci::Color(0.42353f, 0.078431f, 0.0000f),
-	ci::Color(0.45490f, 0.062745f, 0.0000f),
-	ci::Color(0.47059f, 0.047059f, 0.0000f),
-	ci::Color(0.50196f, 0.078431f, 0.047059f),
-	ci::Color(0.53333f, 0.12549f, 0.094118f),
-	ci::Color(0.59608f, 0.18824f, 0.20392f),
-	ci::Color(0.61176f, 0.21961f, 0.25098f),
-	ci::Color(0.64314f, 0.25098f, 0.29804f),
-	ci::Color(0.67451f, 0.29804f, 0.34510f),
-	ci::Color(0.70588f, 0.32941f, 0.40784f),
-	ci::Color(0.73725f, 0.37647f, 0.45490f),
-	ci::Color(0.80000f, 0.45490f, 0.56471f),
-	ci::Color(0.83137f, 0.50196f, 0.61176f),
-	ci::Color(0.86275f, 0.53333f, 0.67451f),
-	ci::Color(0.89412f, 0.58039f, 0.72157f),
-	ci::Color(0.94118f, 0.62745f, 0.78431f),
-	ci::Color(0.90980f, 0.59608f, 0.75294f),
-	ci::Color(0.83137f, 0.51765f, 0.69020f),
-	ci::Color(0.78431f, 0.47059f, 0.67451f),
-	ci::Color(0.75294f, 0.43922f, 0.64314f),
-	ci::Color(0.70588f, 0.39216f, 0.61176f),
-	ci::Color(0.67451f, 0.36078f, 0.58039f),
-	ci::Color(0.62745f, 0.31373f, 0.54902f),
-	ci::Color(0.54902f, 0.23529f, 0.48627f),
-	ci::Color(0.51765f, 0.20392f, 0.45490f),
-	ci::Color(0.56471f, 0.29804f, 0.48627f),
-	ci::Color(0.62745f, 0.40784f, 0.51765f),
-	ci::Color(0.69020f, 0.51765f, 0.54902f),
-	ci::Color(0.75294f, 0.61176f, 0.59608f),
-	ci::Color(0.87843f, 0.83137f, 0.65882f),
-	ci::Color(0.94118f, 0.94118f, 0.70588f),
-	ci::Color(0.94118f, 0.94118f, 0.67451f),
-	ci::Color(0.95686f, 0.92549f, 0.62745f),
-	ci::Color(0.95686f, 0.90980f, 0.59608f),
-	ci::Color(0.97255f, 0.89412f, 0.54902f),
-	ci::Color(0.97255f, 0.87843f, 0.51765f),
-	ci::Color(0.97255f, 0.86275f, 0.47059f),
-	ci::Color(0.95686f, 0.84706f, 0.45490f),
-	ci::Color(0.94118f, 0.84706f, 0.43922f),
-	ci::Color(0.92549f, 0.83137f, 0.43922f),
-	ci::Color(0.90980f, 0.81569f, 0.42353f),
-	ci::Color(0.89412f, 0.81569f, 0.40784f),
-	ci::Color(0.84706f, 0.78431f, 0.39216f),
-	ci::Color(0.83137f, 0.78431f, 0.37647f),
-	ci::Color(0.81569f, 0.76863f, 0.37647f),
-	ci::Color(0.80000f, 0.75294f, 0.36078f),
-	ci::Color(0.78431f, 0.75294f, 0.34510f),
-	ci::Color(0.76863f, 0.73725f, 0.32941f),
-	ci::Color(0.72157f, 0.72157f, 0.31373f),
-	ci::Color(0.70588f, 0.70588f, 0.29804f),
-	ci::Color(0.69020f, 0.70588f, 0.29804f),
-	ci::Color(0.67451f, 0.69020f, 0.28235f),
-	ci::Color(0.65882f, 0.67451f, 0.26667f),
-	ci::Color(0.64314f, 0.67451f, 0.26667f),
-	ci::Color(0.59608f, 0.64314f, 0.23529f),
-	ci::Color(0.58039f, 0.64314f, 0.23529f),
-	ci::Color(0.56471f, 0.62745f, 0.21961f),
-	ci::Color(0.54902f, 0.62745f, 0.20392f),
-	ci::Color(0.53333f, 0.61176f, 0.18824f),
-	ci::Color(0.51765f, 0.59608f, 0.18824f),
-	ci::Color(0.47059f, 0.58039f, 0.15686f),
-	ci::Color(0.45490f, 0.56471f, 0.15686f),
-	ci::Color(0.43922f, 0.56471f, 0.14118f),
-	ci::Color(0.42353f, 0.54902f, 0.12549f),
-	ci::Color(0.40784f, 0.53333f, 0.12549f),
-	ci::Color(0.39216f, 0.53333f, 0.10980f),
-	ci::Color(0.34510f, 0.50196f, 0.078431f),
-	ci::Color(0.34510f, 0.50196f, 0.078431f),
-	ci::Color(0.34510f, 0.50196f, 0.078431f),
-	ci::Color(0.34510f, 0.48627f, 0.078431f),
-	ci::Color(0.32941f, 0.48627f, 0.078431f),
-	ci::Color(0.32941f, 0.47059f, 0.078431f),
-	ci::Color(0.32941f, 0.47059f, 0.094118f),
-	ci::Color(0.31373f, 0.45490f, 0.094118f),
-	ci::Color(0.31373f, 0.45490f, 0.094118f),
-	ci::Color(0.31373f, 0.43922f, 0.094118f),
-	ci::Color(0.29804f, 0.43922f, 0.10980f),
-	ci::Color(0.29804f, 0.43922f, 0.10980f),
-	ci::Color(0.29804f, 0.42353f, 0.10980f),
-	ci::Color(0.28235f, 0.40784f, 0.10980f),
-	ci::Color(0.28235f, 0.40784f, 0.12549f),
-	ci::Color(0.28235f, 0.40784f, 0.12549f),
-	ci::Color(0.26667f, 0.39216f, 0.12549f),
-	ci::Color(0.26667f, 0.39216f, 0.12549f),
-	ci::Color(0.26667f, 0.37647f, 0.12549f),
-	ci::Color(0.25098f, 0.37647f, 0.14118f),
-	ci::Color(0.25098f, 0.36078f, 0.14118f),
-	ci::Color(0.25098f, 0.36078f, 0.14118f),
-	ci::Color(0.23529f, 0.34510f, 0.14118f),
-	ci::Color(0.23529f, 0.34510f, 0.14118f),
-	ci::Color(0.23529f, 0.32941f, 0.15686f),
-	ci::Color(0.21961f, 0.32941f, 0.15686f),
-	ci::Color(0.21961f, 0.31373f, 0.15686f),
-	ci::Color(0.21961f, 0.31373f, 0.15686f),
-	ci::Color(0.20392f, 0.29804f, 0.17255f),
-	ci::Color(0.23529f, 0.29804f, 0.15686f),
-	ci::Color(0.26667f, 0.29804f, 0.15686f),
-	ci::Color(0.28235f, 0.29804f, 0.15686f),
-	ci::Color(0.29804f, 0.29804f, 0.15686f),
-	ci::Color(0.31373f, 0.28235f, 0.15686f),
-	ci::Color(0.32941f, 0.28235f, 0.15686f),
-	ci::Color(0.34510f, 0.28235f, 0.15686f),
-	ci::Color(0.37647f, 0.28235f, 0.15686f),
-	ci::Color(0.39216f, 0.26667f, 0.15686f),
-	ci::Color(0.40784f, 0.26667f, 0.15686f),
-	ci::Color(0.42353f, 0.26667f, 0.15686f),
-	ci::Color(0.43922f, 0.26667f, 0.15686f),
-	ci::Color(0.45490f, 0.26667f, 0.15686f),
-	ci::Color(0.47059f, 0.25098f, 0.17255f)
+const std::array<const Color, 220> SVGGallet13::palette{{
+	Color(0.39216f, 0.70588f, 0.70588f),
+	Color(0.39216f, 0.70588f, 0.70588f),
+	Color(0.40784f, 0.72157f, 0.72157f),
+	Color(0.42353f, 0.72157f, 0.72157f),
+	Color(0.42353f, 0.73725f, 0.73725f),
+	Color(0.43922f, 0.75294f, 0.75294f),
+	Color(0.45490f, 0.75294f, 0.75294f),
+	Color(0.47059f, 0.78431f, 0.78431f),
+	Color(0.48627f, 0.78431f, 0.78431f),
+	Color(0.48627f, 0.80000f, 0.80000f),
+	Color(0.50196f, 0.80000f, 0.80000f),
+	Color(0.51765f, 0.81569f, 0.81569f),
+	Color(0.51765f, 0.83137f, 0.83137f),
+	Color(0.54902f, 0.84706f, 0.84706f),
+	Color(0.56471f, 0.86275f, 0.86275f),
+	Color(0.58039f, 0.86275f, 0.86275f),
+	Color(0.59608f, 0.86275f, 0.86275f),
+	Color(0.61176f, 0.86275f, 0.86275f),
+	Color(0.62745f, 0.87843f, 0.86275f),
+	Color(0.65882f, 0.87843f, 0.84706f),
+	Color(0.67451f, 0.89412f, 0.84706f),
+	Color(0.69020f, 0.89412f, 0.84706f),
+	Color(0.70588f, 0.89412f, 0.84706f),
+	Color(0.72157f, 0.89412f, 0.84706f),
+	Color(0.73725f, 0.90980f, 0.83137f),
+	Color(0.76863f, 0.90980f, 0.83137f),
+	Color(0.78431f, 0.92549f, 0.83137f),
+	Color(0.80000f, 0.92549f, 0.83137f),
+	Color(0.81569f, 0.92549f, 0.83137f),
+	Color(0.83137f, 0.94118f, 0.81569f),
+	Color(0.84706f, 0.94118f, 0.81569f),
+	Color(0.87843f, 0.94118f, 0.81569f),
+	Color(0.89412f, 0.95686f, 0.81569f),
+	Color(0.90980f, 0.95686f, 0.80000f),
+	Color(0.92549f, 0.95686f, 0.80000f),
+	Color(0.94118f, 0.97255f, 0.80000f),
+	Color(0.95686f, 0.97255f, 0.80000f),
+	Color(0.98824f, 0.98824f, 0.78431f),
+	Color(0.98824f, 0.97255f, 0.70588f),
+	Color(0.98824f, 0.95686f, 0.62745f),
+	Color(0.98824f, 0.92549f, 0.54902f),
+	Color(0.98824f, 0.90980f, 0.47059f),
+	Color(0.97255f, 0.89412f, 0.47059f),
+	Color(0.94118f, 0.83137f, 0.43922f),
+	Color(0.92549f, 0.80000f, 0.42353f),
+	Color(0.90980f, 0.78431f, 0.42353f),
+	Color(0.87843f, 0.75294f, 0.40784f),
+	Color(0.86275f, 0.72157f, 0.39216f),
+	Color(0.84706f, 0.69020f, 0.37647f),
+	Color(0.81569f, 0.64314f, 0.36078f),
+	Color(0.80000f, 0.61176f, 0.34510f),
+	Color(0.76863f, 0.58039f, 0.32941f),
+	Color(0.75294f, 0.54902f, 0.31373f),
+	Color(0.73725f, 0.51765f, 0.29804f),
+	Color(0.72157f, 0.50196f, 0.29804f),
+	Color(0.69020f, 0.43922f, 0.26667f),
+	Color(0.65882f, 0.40784f, 0.25098f),
+	Color(0.64314f, 0.37647f, 0.23529f),
+	Color(0.62745f, 0.36078f, 0.23529f),
+	Color(0.61176f, 0.32941f, 0.21961f),
+	Color(0.59608f, 0.29804f, 0.20392f),
+	Color(0.54902f, 0.23529f, 0.17255f),
+	Color(0.53333f, 0.21961f, 0.17255f),
+	Color(0.51765f, 0.18824f, 0.15686f),
+	Color(0.50196f, 0.15686f, 0.14118f),
+	Color(0.48627f, 0.12549f, 0.12549f),
+	Color(0.45490f, 0.094118f, 0.10980f),
+	Color(0.47059f, 0.15686f, 0.14118f),
+	Color(0.53333f, 0.23529f, 0.15686f),
+	Color(0.59608f, 0.31373f, 0.17255f),
+	Color(0.64314f, 0.36078f, 0.18824f),
+	Color(0.67451f, 0.40784f, 0.20392f),
+	Color(0.72157f, 0.47059f, 0.21961f),
+	Color(0.80000f, 0.56471f, 0.26667f),
+	Color(0.83137f, 0.62745f, 0.28235f),
+	Color(0.87843f, 0.67451f, 0.29804f),
+	Color(0.90980f, 0.72157f, 0.32941f),
+	Color(0.95686f, 0.78431f, 0.34510f),
+	Color(0.98824f, 0.83137f, 0.36078f),
+	Color(0.92549f, 0.81569f, 0.39216f),
+	Color(0.80000f, 0.78431f, 0.45490f),
+	Color(0.73725f, 0.78431f, 0.48627f),
+	Color(0.65882f, 0.76863f, 0.50196f),
+	Color(0.59608f, 0.75294f, 0.53333f),
+	Color(0.53333f, 0.73725f, 0.56471f),
+	Color(0.47059f, 0.72157f, 0.59608f),
+	Color(0.43922f, 0.67451f, 0.53333f),
+	Color(0.42353f, 0.65882f, 0.48627f),
+	Color(0.40784f, 0.62745f, 0.45490f),
+	Color(0.37647f, 0.61176f, 0.42353f),
+	Color(0.36078f, 0.58039f, 0.39216f),
+	Color(0.34510f, 0.56471f, 0.36078f),
+	Color(0.31373f, 0.51765f, 0.28235f),
+	Color(0.29804f, 0.48627f, 0.25098f),
+	Color(0.28235f, 0.47059f, 0.21961f),
+	Color(0.26667f, 0.43922f, 0.18824f),
+	Color(0.23529f, 0.42353f, 0.15686f),
+	Color(0.21961f, 0.39216f, 0.10980f),
+	Color(0.18824f, 0.34510f, 0.047059f),
+	Color(0.15686f, 0.31373f, 0.0000f),
+	Color(0.17255f, 0.29804f, 0.0000f),
+	Color(0.18824f, 0.28235f, 0.0000f),
+	Color(0.21961f, 0.26667f, 0.0000f),
+	Color(0.23529f, 0.25098f, 0.0000f),
+	Color(0.26667f, 0.21961f, 0.0000f),
+	Color(0.29804f, 0.20392f, 0.0000f),
+	Color(0.31373f, 0.18824f, 0.0000f),
+	Color(0.32941f, 0.15686f, 0.0000f),
+	Color(0.34510f, 0.14118f, 0.0000f),
+	Color(0.37647f, 0.12549f, 0.0000f),
+	Color(0.40784f, 0.094118f, 0.0000f),
+	Color(0.42353f, 0.078431f, 0.0000f),
+	Color(0.45490f, 0.062745f, 0.0000f),
+	Color(0.47059f, 0.047059f, 0.0000f),
+	Color(0.50196f, 0.078431f, 0.047059f),
+	Color(0.53333f, 0.12549f, 0.094118f),
+	Color(0.59608f, 0.18824f, 0.20392f),
+	Color(0.61176f, 0.21961f, 0.25098f),
+	Color(0.64314f, 0.25098f, 0.29804f),
+	Color(0.67451f, 0.29804f, 0.34510f),
+	Color(0.70588f, 0.32941f, 0.40784f),
+	Color(0.73725f, 0.37647f, 0.45490f),
+	Color(0.80000f, 0.45490f, 0.56471f),
+	Color(0.83137f, 0.50196f, 0.61176f),
+	Color(0.86275f, 0.53333f, 0.67451f),
+	Color(0.89412f, 0.58039f, 0.72157f),
+	Color(0.94118f, 0.62745f, 0.78431f),
+	Color(0.90980f, 0.59608f, 0.75294f),
+	Color(0.83137f, 0.51765f, 0.69020f),
+	Color(0.78431f, 0.47059f, 0.67451f),
+	Color(0.75294f, 0.43922f, 0.64314f),
+	Color(0.70588f, 0.39216f, 0.61176f),
+	Color(0.67451f, 0.36078f, 0.58039f),
+	Color(0.62745f, 0.31373f, 0.54902f),
+	Color(0.54902f, 0.23529f, 0.48627f),
+	Color(0.51765f, 0.20392f, 0.45490f),
+	Color(0.56471f, 0.29804f, 0.48627f),
+	Color(0.62745f, 0.40784f, 0.51765f),
+	Color(0.69020f, 0.51765f, 0.54902f),
+	Color(0.75294f, 0.61176f, 0.59608f),
+	Color(0.87843f, 0.83137f, 0.65882f),
+	Color(0.94118f, 0.94118f, 0.70588f),
+	Color(0.94118f, 0.94118f, 0.67451f),
+	Color(0.95686f, 0.92549f, 0.62745f),
+	Color(0.95686f, 0.90980f, 0.59608f),
+	Color(0.97255f, 0.89412f, 0.54902f),
+	Color(0.97255f, 0.87843f, 0.51765f),
+	Color(0.97255f, 0.86275f, 0.47059f),
+	Color(0.95686f, 0.84706f, 0.45490f),
+	Color(0.94118f, 0.84706f, 0.43922f),
+	Color(0.92549f, 0.83137f, 0.43922f),
+	Color(0.90980f, 0.81569f, 0.42353f),
+	Color(0.89412f, 0.81569f, 0.40784f),
+	Color(0.84706f, 0.78431f, 0.39216f),
+	Color(0.83137f, 0.78431f, 0.37647f),
+	Color(0.81569f, 0.76863f, 0.37647f),
+	Color(0.80000f, 0.75294f, 0.36078f),
+	Color(0.78431f, 0.75294f, 0.34510f),
+	Color(0.76863f, 0.73725f, 0.32941f),
+	Color(0.72157f, 0.72157f, 0.31373f),
+	Color(0.70588f, 0.70588f, 0.29804f),
+	Color(0.69020f, 0.70588f, 0.29804f),
+	Color(0.67451f, 0.69020f, 0.28235f),
+	Color(0.65882f, 0.67451f, 0.26667f),
+	Color(0.64314f, 0.67451f, 0.26667f),
+	Color(0.59608f, 0.64314f, 0.23529f),
+	Color(0.58039f, 0.64314f, 0.23529f),
+	Color(0.56471f, 0.62745f, 0.21961f),
+	Color(0.54902f, 0.62745f, 0.20392f),
+	Color(0.53333f, 0.61176f, 0.18824f),
+	Color(0.51765f, 0.59608f, 0.18824f),
+	Color(0.47059f, 0.58039f, 0.15686f),
+	Color(0.45490f, 0.56471f, 0.15686f),
+	Color(0.43922f, 0.56471f, 0.14118f),
+	Color(0.42353f, 0.54902f, 0.12549f),
+	Color(0.40784f, 0.53333f, 0.12549f),
+	Color(0.39216f, 0.53333f, 0.10980f),
+	Color(0.34510f, 0.50196f, 0.078431f),
+	Color(0.34510f, 0.50196f, 0.078431f),
+	Color(0.34510f, 0.50196f, 0.078431f),
+	Color(0.34510f, 0.48627f, 0.078431f),
+	Color(0.32941f, 0.48627f, 0.078431f),
+	Color(0.32941f, 0.47059f, 0.078431f),
+	Color(0.32941f, 0.47059f, 0.094118f),
+	Color(0.31373f, 0.45490f, 0.094118f),
+	Color(0.31373f, 0.45490f, 0.094118f),
+	Color(0.31373f, 0.43922f, 0.094118f),
+	Color(0.29804f, 0.43922f, 0.10980f),
+	Color(0.29804f, 0.43922f, 0.10980f),
+	Color(0.29804f, 0.42353f, 0.10980f),
+	Color(0.28235f, 0.40784f, 0.10980f),
+	Color(0.28235f, 0.40784f, 0.12549f),
+	Color(0.28235f, 0.40784f, 0.12549f),
+	Color(0.26667f, 0.39216f, 0.12549f),
+	Color(0.26667f, 0.39216f, 0.12549f),
+	Color(0.26667f, 0.37647f, 0.12549f),
+	Color(0.25098f, 0.37647f, 0.14118f),
+	Color(0.25098f, 0.36078f, 0.14118f),
+	Color(0.25098f, 0.36078f, 0.14118f),
+	Color(0.23529f, 0.34510f, 0.14118f),
+	Color(0.23529f, 0.34510f, 0.14118f),
+	Color(0.23529f, 0.32941f, 0.15686f),
+	Color(0.21961f, 0.32941f, 0.15686f),
+	Color(0.21961f, 0.31373f, 0.15686f),
+	Color(0.21961f, 0.31373f, 0.15686f),
+	Color(0.20392f, 0.29804f, 0.17255f),
+	Color(0.23529f, 0.29804f, 0.15686f),
+	Color(0.26667f, 0.29804f, 0.15686f),
+	Color(0.28235f, 0.29804f, 0.15686f),
+	Color(0.29804f, 0.29804f, 0.15686f),
+	Color(0.31373f, 0.28235f, 0.15686f),
+	Color(0.32941f, 0.28235f, 0.15686f),
+	Color(0.34510f, 0.28235f, 0.15686f),
+	Color(0.37647f, 0.28235f, 0.15686f),
+	Color(0.39216f, 0.26667f, 0.15686f),
+	Color(0.40784f, 0.26667f, 0.15686f),
+	Color(0.42353f, 0.26667f, 0.15686f),
+	Color(0.43922f, 0.26667f, 0.15686f),
+	Color(0.45490f, 0.26667f, 0.15686f),
+	Color(0.47059f, 0.25098f, 0.17255f)
 }};
 
 }} //!cistft::pallete
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "fft_backend.h"
+
+namespace cistft {
+namespace fft {
+
+namespace detail {
+BackendRef			make_portable_backend(std::size_t size);
+#if !defined(CISTFT_HEADLESS)
+BackendRef			make_ooura_backend(std::size_t size);
+#endif
+#if defined(CISTFT_WITH_FFTW)
+BackendRef			make_fftw_backend(std::size_t size);
+#endif
+#if defined(CISTFT_WITH_POCKETFFT)
+BackendRef			make_pocketfft_backend(std::size_t size);
+#endif
+
+std::string& wisdom_filename()
+{
+	static std::string _filename("fftw.wisdom");
+	return _filename;
+}
+} //!namespace detail
+
+namespace {
+static const char* BACKEND_NAMES[] = { "ooura", "portable", "fftw", "pocketfft" };
+} //!namespace
+
+BackendRef make_backend(BackendType type, std::size_t size)
+{
+	switch (type)
+	{
+#if !defined(CISTFT_HEADLESS)
+	case BackendType::Ooura:
+		return detail::make_ooura_backend(size);
+#endif
+#if defined(CISTFT_WITH_FFTW)
+	case BackendType::Fftw:
+		return detail::make_fftw_backend(size);
+#endif
+#if defined(CISTFT_WITH_POCKETFFT)
+	case BackendType::PocketFft:
+		return detail::make_pocketfft_backend(size);
+#endif
+	default:
+		return detail::make_portable_backend(size);
+	}
+}
+
+bool isBackendAvailable(BackendType type)
+{
+	switch (type)
+	{
+	case BackendType::Portable:
+		return true;
+#if !defined(CISTFT_HEADLESS)
+	case BackendType::Ooura:
+		return true;
+#endif
+#if defined(CISTFT_WITH_FFTW)
+	case BackendType::Fftw:
+		return true;
+#endif
+#if defined(CISTFT_WITH_POCKETFFT)
+	case BackendType::PocketFft:
+		return true;
+#endif
+	default:
+		return false;
+	}
+}
+
+const char* getBackendName(BackendType type)
+{
+	const auto index = static_cast<std::size_t>(type);
+	if (index >= static_cast<std::size_t>(BackendType::Count)) return "unknown";
+	return BACKEND_NAMES[index];
+}
+
+bool parseBackendName(const std::string& name, BackendType& type)
+{
+	for (std::size_t index = 0; index < static_cast<std::size_t>(BackendType::Count); ++index)
+	{
+		if (name == BACKEND_NAMES[index])
+		{
+			type = static_cast<BackendType>(index);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void setWisdomFilename(const std::string& filename)
+{
+	detail::wisdom_filename() = filename;
+}
+
+}} //!cistft::fft
\ No newline at end of file
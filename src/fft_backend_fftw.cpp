@@ -0,0 +1,97 @@
+#if defined(CISTFT_WITH_FFTW)
+
+#include "fft_backend.h"
+
+#include <fftw3.h>
+
+#include <mutex>
+
+namespace cistft {
+namespace fft {
+namespace detail {
+
+std::string& wisdom_filename();
+
+namespace {
+//! FFTW's planner is not thread safe, executing a plan is.
+std::mutex& planner_lock()
+{
+	static std::mutex _lock;
+	return _lock;
+}
+} //!namespace
+
+/*!
+ * \class FftwBackend
+ * \brief FFTW3 single precision real transform, planned with FFTW_MEASURE.
+ * Wisdom is loaded from disk before the first plan and saved after every
+ * new plan, so only the first run on a machine pays for measuring.
+ * \note output is requested in split format so no de-interleaving is needed.
+ */
+class FftwBackend final : public Backend
+{
+public:
+	FftwBackend(std::size_t size)
+		: Backend(size)
+		, mInput(static_cast<float*>(fftwf_malloc(sizeof(float) * size)))
+		, mReal(static_cast<float*>(fftwf_malloc(sizeof(float) * (size / 2 + 1))))
+		, mImag(static_cast<float*>(fftwf_malloc(sizeof(float) * (size / 2 + 1))))
+		, mPlan(nullptr)
+	{
+		std::lock_guard<std::mutex> _lock(planner_lock());
+
+		static bool _wisdom_loaded = false;
+		if (!_wisdom_loaded)
+		{
+			fftwf_import_wisdom_from_filename(wisdom_filename().c_str());
+			_wisdom_loaded = true;
+		}
+
+		fftwf_iodim _dim;
+		_dim.n = static_cast<int>(size);
+		_dim.is = 1;
+		_dim.os = 1;
+
+		mPlan = fftwf_plan_guru_split_dft_r2c(1, &_dim, 0, nullptr, mInput, mReal, mImag, FFTW_MEASURE);
+
+		fftwf_export_wisdom_to_filename(wisdom_filename().c_str());
+	}
+
+	~FftwBackend()
+	{
+		{
+			std::lock_guard<std::mutex> _lock(planner_lock());
+			if (mPlan) fftwf_destroy_plan(mPlan);
+		}
+
+		fftwf_free(mInput);
+		fftwf_free(mReal);
+		fftwf_free(mImag);
+	}
+
+	float* getInput() override { return mInput; }
+	float* getReal() override { return mReal; }
+	float* getImag() override { return mImag; }
+	const char* getName() const override { return "fftw"; }
+
+	void forward() override
+	{
+		fftwf_execute(mPlan);
+		mImag[0] = 0.0f;
+	}
+
+private:
+	float*		mInput;
+	float*		mReal;
+	float*		mImag;
+	fftwf_plan	mPlan;
+};
+
+BackendRef make_fftw_backend(std::size_t size)
+{
+	return BackendRef(new FftwBackend(size));
+}
+
+}}} //!cistft::fft::detail
+
+#endif // CISTFT_WITH_FFTW
\ No newline at end of file
@@ -0,0 +1,52 @@
+#if !defined(CISTFT_HEADLESS)
+
+#include "fft_backend.h"
+
+#include <cinder/audio/dsp/Fft.h>
+#include <cinder/audio/Buffer.h>
+
+namespace cistft {
+namespace fft {
+namespace detail {
+
+/*!
+ * \class OouraBackend
+ * \brief Cinder's FFT (Ooura's real transform on Windows), what the
+ * STFT client always used before backends became pluggable.
+ */
+class OouraBackend final : public Backend
+{
+public:
+	OouraBackend(std::size_t size)
+		: Backend(size)
+		, mFft(size)
+		, mBuffer(size)
+		, mSpectral(size)
+	{}
+
+	float* getInput() override { return mBuffer.getData(); }
+	float* getReal() override { return mSpectral.getReal(); }
+	float* getImag() override { return mSpectral.getImag(); }
+	const char* getName() const override { return "ooura"; }
+
+	void forward() override
+	{
+		mFft.forward(&mBuffer, &mSpectral);
+		// Ooura packs the Nyquist bin into imag[0]
+		mSpectral.getImag()[0] = 0.0f;
+	}
+
+private:
+	ci::audio::dsp::Fft				mFft;
+	ci::audio::Buffer				mBuffer;
+	ci::audio::BufferSpectral		mSpectral;
+};
+
+BackendRef make_ooura_backend(std::size_t size)
+{
+	return BackendRef(new OouraBackend(size));
+}
+
+}}} //!cistft::fft::detail
+
+#endif // !CISTFT_HEADLESS
\ No newline at end of file
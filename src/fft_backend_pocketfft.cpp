@@ -0,0 +1,61 @@
+#if defined(CISTFT_WITH_POCKETFFT)
+
+#include "fft_backend.h"
+
+#include <pocketfft_hdronly.hpp>
+
+#include <vector>
+
+namespace cistft {
+namespace fft {
+namespace detail {
+
+/*!
+ * \class PocketFftBackend
+ * \brief pocketfft's real transform. Runs in place and answers in FFTPACK's
+ * half complex order (r0, r1, i1, r2, i2, ...), unpacked into split arrays.
+ */
+class PocketFftBackend final : public Backend
+{
+public:
+	PocketFftBackend(std::size_t size)
+		: Backend(size)
+		, mPlan(size)
+		, mInput(size)
+		, mReal(size / 2)
+		, mImag(size / 2)
+	{}
+
+	float* getInput() override { return mInput.data(); }
+	float* getReal() override { return mReal.data(); }
+	float* getImag() override { return mImag.data(); }
+	const char* getName() const override { return "pocketfft"; }
+
+	void forward() override
+	{
+		mPlan.exec(mInput.data(), 1.0f, true);
+
+		mReal[0] = mInput[0];
+		mImag[0] = 0.0f;
+		for (std::size_t k = 1; k < mSize / 2; ++k)
+		{
+			mReal[k] = mInput[2 * k - 1];
+			mImag[k] = mInput[2 * k];
+		}
+	}
+
+private:
+	pocketfft::detail::pocketfft_r<float>	mPlan;
+	std::vector<float>						mInput;
+	std::vector<float>						mReal;
+	std::vector<float>						mImag;
+};
+
+BackendRef make_pocketfft_backend(std::size_t size)
+{
+	return BackendRef(new PocketFftBackend(size));
+}
+
+}}} //!cistft::fft::detail
+
+#endif // CISTFT_WITH_POCKETFFT
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include "fft_backend.h"
+
+#include <cmath>
+#include <vector>
+
+namespace cistft {
+namespace fft {
+namespace detail {
+
+namespace {
+static const double TWO_PI = 6.283185307179586;
+} //!namespace
+
+/*!
+ * \class PortableBackend
+ * \brief plain C++ real FFT. The N real samples are packed into an N/2 point
+ * complex transform (radix-2, decimation in time) and split afterwards.
+ */
+class PortableBackend final : public Backend
+{
+public:
+	PortableBackend(std::size_t size)
+		: Backend(size)
+		, mHalfSize(size / 2)
+		, mInput(size)
+		, mReal(size / 2)
+		, mImag(size / 2)
+		, mWorkReal(size / 2)
+		, mWorkImag(size / 2)
+		, mBitReversed(size / 2)
+		, mTwiddleReal(size / 2)
+		, mTwiddleImag(size / 2)
+		, mSplitReal(size / 2)
+		, mSplitImag(size / 2)
+	{
+		std::size_t bits = 0;
+		while ((static_cast<std::size_t>(1) << bits) < mHalfSize) ++bits;
+
+		for (std::size_t i = 0; i < mHalfSize; ++i)
+		{
+			std::size_t reversed = 0;
+			for (std::size_t b = 0; b < bits; ++b)
+			{
+				if (i & (static_cast<std::size_t>(1) << b)) reversed |= static_cast<std::size_t>(1) << (bits - 1 - b);
+			}
+			mBitReversed[i] = reversed;
+		}
+
+		// twiddles of the N/2 point complex transform, e^(-2*pi*j*k / (N/2))
+		for (std::size_t k = 0; k < mHalfSize / 2; ++k)
+		{
+			mTwiddleReal[k] = static_cast<float>(std::cos(TWO_PI * k / mHalfSize));
+			mTwiddleImag[k] = static_cast<float>(-std::sin(TWO_PI * k / mHalfSize));
+		}
+
+		// twiddles of the real split, e^(-2*pi*j*k / N)
+		for (std::size_t k = 0; k < mHalfSize; ++k)
+		{
+			mSplitReal[k] = static_cast<float>(std::cos(TWO_PI * k / mSize));
+			mSplitImag[k] = static_cast<float>(-std::sin(TWO_PI * k / mSize));
+		}
+	}
+
+	float* getInput() override { return mInput.data(); }
+	float* getReal() override { return mReal.data(); }
+	float* getImag() override { return mImag.data(); }
+	const char* getName() const override { return "portable"; }
+
+	void forward() override
+	{
+		// pack even samples as real and odd samples as imaginary parts, in bit reversed order
+		for (std::size_t i = 0; i < mHalfSize; ++i)
+		{
+			const auto j = mBitReversed[i];
+			mWorkReal[j] = mInput[2 * i];
+			mWorkImag[j] = mInput[2 * i + 1];
+		}
+
+		float* re = mWorkReal.data();
+		float* im = mWorkImag.data();
+
+		for (std::size_t span = 1, stride = mHalfSize / 2; span < mHalfSize; span <<= 1, stride >>= 1)
+		{
+			for (std::size_t start = 0; start < mHalfSize; start += 2 * span)
+			{
+				for (std::size_t k = 0; k < span; ++k)
+				{
+					const float wr = mTwiddleReal[k * stride];
+					const float wi = mTwiddleImag[k * stride];
+					const std::size_t a = start + k;
+					const std::size_t b = a + span;
+
+					const float tr = re[b] * wr - im[b] * wi;
+					const float ti = re[b] * wi + im[b] * wr;
+
+					re[b] = re[a] - tr;
+					im[b] = im[a] - ti;
+					re[a] += tr;
+					im[a] += ti;
+				}
+			}
+		}
+
+		// split the packed transform into the spectrum of the real signal
+		for (std::size_t k = 0; k < mHalfSize; ++k)
+		{
+			const std::size_t m = (k == 0) ? 0 : mHalfSize - k;
+
+			// even part: (Z[k] + conj(Z[N/2 - k])) / 2
+			const float er = 0.5f * (re[k] + re[m]);
+			const float ei = 0.5f * (im[k] - im[m]);
+			// odd part: (Z[k] - conj(Z[N/2 - k])) / 2j
+			const float or_ = 0.5f * (im[k] + im[m]);
+			const float oi = -0.5f * (re[k] - re[m]);
+
+			mReal[k] = er + mSplitReal[k] * or_ - mSplitImag[k] * oi;
+			mImag[k] = ei + mSplitReal[k] * oi + mSplitImag[k] * or_;
+		}
+
+		mImag[0] = 0.0f;
+	}
+
+private:
+	std::size_t					mHalfSize;
+	std::vector<float>			mInput;
+	std::vector<float>			mReal;
+	std::vector<float>			mImag;
+	std::vector<float>			mWorkReal;
+	std::vector<float>			mWorkImag;
+	std::vector<std::size_t>	mBitReversed;
+	std::vector<float>			mTwiddleReal;
+	std::vector<float>			mTwiddleImag;
+	std::vector<float>			mSplitReal;
+	std::vector<float>			mSplitImag;
+};
+
+BackendRef make_portable_backend(std::size_t size)
+{
+	return BackendRef(new PortableBackend(size));
+}
+
+}}} //!cistft::fft::detail
\ No newline at end of file
@@ -0,0 +1,24 @@
+#include "generator_node.h"
+
+namespace cistft {
+namespace audio {
+
+GeneratorNode::GeneratorNode(const SignalGenerator::Format& fmt)
+	: ci::audio::InputNode(ci::audio::Node::Format().channels(fmt.getChannelSize()))
+	, mSignalFormat(fmt)
+	, mGenerator(fmt)
+{}
+
+void GeneratorNode::initialize()
+{
+	mSignalFormat.sampleRate(static_cast<int>(getSampleRate()));
+	mGenerator = SignalGenerator(mSignalFormat);
+}
+
+void GeneratorNode::process(ci::audio::Buffer* buffer)
+{
+	// Cinder buffers are planar, one channel after another
+	mGenerator.generate(buffer->getData(), buffer->getNumFrames(), buffer->getNumFrames(), 1);
+}
+
+}} //!cistft::audio
\ No newline at end of file
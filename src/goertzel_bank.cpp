@@ -0,0 +1,77 @@
+#include "goertzel_bank.h"
+
+#include <cmath>
+
+namespace cistft {
+namespace dsp {
+
+namespace {
+//! resonators advanced together, keeps the inner loop friendly to auto-vectorization
+static const std::size_t BLOCK_SIZE = 4;
+//! a real FFT costs roughly 2.5 * N * log2(N) flops, a resonator 4 flops per
+//! sample in double precision. keep some margin for the FFT's better locality.
+static const double FFT_FLOPS_PER_POINT = 2.5;
+static const double GOERTZEL_FLOPS_PER_SAMPLE = 4.0;
+static const double GOERTZEL_PENALTY = 2.0;
+static const double TWO_PI = 6.283185307179586;
+} //!namespace
+
+GoertzelBank::GoertzelBank(std::size_t fft_size, std::size_t bin_start, std::size_t bin_count)
+	: mFftSize(fft_size)
+	, mBinStart(bin_start)
+	, mBinCount(bin_count)
+{
+	// padded to a multiple of the block size, the extra resonators are never written out
+	const auto _padded = ((mBinCount + BLOCK_SIZE - 1) / BLOCK_SIZE) * BLOCK_SIZE;
+	mCoefficients.resize(_padded, 0.0);
+	mCosines.resize(_padded, 0.0);
+	mSines.resize(_padded, 0.0);
+
+	for (std::size_t k = 0; k < mBinCount; ++k)
+	{
+		const double w = TWO_PI * static_cast<double>(mBinStart + k) / static_cast<double>(mFftSize);
+		mCosines[k] = std::cos(w);
+		mSines[k] = std::sin(w);
+		mCoefficients[k] = 2.0 * mCosines[k];
+	}
+}
+
+void GoertzelBank::process(const float* input, std::size_t input_size, float* real, float* imag) const
+{
+	for (std::size_t block = 0; block < mCoefficients.size(); block += BLOCK_SIZE)
+	{
+		double s1[BLOCK_SIZE] = { 0.0 };
+		double s2[BLOCK_SIZE] = { 0.0 };
+		const double* coeff = &mCoefficients[block];
+
+		for (std::size_t n = 0; n < input_size; ++n)
+		{
+			const double x = input[n];
+			for (std::size_t b = 0; b < BLOCK_SIZE; ++b)
+			{
+				const double s0 = x + coeff[b] * s1[b] - s2[b];
+				s2[b] = s1[b];
+				s1[b] = s0;
+			}
+		}
+
+		// |re + j*im|^2 == s1^2 + s2^2 - 2cos(w)*s1*s2, which is all the magnitude needs
+		for (std::size_t b = 0; b < BLOCK_SIZE && block + b < mBinCount; ++b)
+		{
+			real[block + b] = static_cast<float>(s1[b] - s2[b] * mCosines[block + b]);
+			imag[block + b] = static_cast<float>(s2[b] * mSines[block + b]);
+		}
+	}
+}
+
+bool GoertzelBank::isCheaperThanFft(std::size_t bin_count, std::size_t input_size, std::size_t fft_size)
+{
+	if (fft_size < 2) return false;
+
+	const double _fft_cost = FFT_FLOPS_PER_POINT * fft_size * std::log(static_cast<double>(fft_size)) / std::log(2.0);
+	const double _goertzel_cost = GOERTZEL_PENALTY * GOERTZEL_FLOPS_PER_SAMPLE * bin_count * input_size;
+
+	return _goertzel_cost < _fft_cost;
+}
+
+}} //!cistft::dsp
\ No newline at end of file
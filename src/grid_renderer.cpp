@@ -3,9 +3,14 @@
 #include "audio_nodes.h"
 
 #include <cinder/Color.h>
+#include <cinder/Text.h>
 #include <cinder/app/App.h>
+#include <cinder/gl/gl.h>
 #include <cinder/params/Params.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace cistft {
 
 GridRenderer::GridRenderer(AppGlobals& g)
@@ -25,55 +30,207 @@ GridRenderer::GridRenderer(AppGlobals& g)
 	, mHorizontalUnitTextToDraw("")
 	, mVerticalUnit("")
 	, mVerticalUnitTextToDraw("")
+	, mAscent(0.0f)
+	, mGeometryDirty(true)
+	, mBuiltWidth(0)
+	, mBuiltHeight(0)
+	, mBuiltStepX(0)
+	, mBuiltStepY(0)
+	, mBuiltLabelFrequency(0)
+	, mBuiltLabelMargin(0.0f)
 {}
 
+namespace {
+//! printable ASCII, what labels and units are made of
+static const char FIRST_GLYPH = 32;
+static const char LAST_GLYPH = 126;
+//! in pixels
+static const int ATLAS_WIDTH = 512;
+static const int GLYPH_PADDING = 1;
+} //!namespace
+
 void GridRenderer::draw()
 {
-	static ci::Font _axis_font("Arial", 20);
-
 	if (!mVisible || !mGlobals.getAudioNodes().isRecorderReady()) return;
 
+	if (!mAtlas) buildAtlas();
+	if (isGeometryStale()) buildGeometry();
+
 	ci::gl::SaveColorState _save_color;
+
+	glEnableClientState(GL_VERTEX_ARRAY);
+
 	ci::gl::color(mGridColor);
+	glVertexPointer(2, GL_FLOAT, 0, mLineVertices.data());
+	glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(mLineVertices.size() / 2));
+
+	if (!mLabelVertices.empty())
+	{
+		// glyphs are white, their alpha is the coverage. the color tints them.
+		mAtlas->enableAndBind();
+		ci::gl::color(mLabelColor);
+		glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+		glVertexPointer(2, GL_FLOAT, 4 * sizeof(float), mLabelVertices.data());
+		glTexCoordPointer(2, GL_FLOAT, 4 * sizeof(float), mLabelVertices.data() + 2);
+		glDrawArrays(GL_QUADS, 0, static_cast<GLsizei>(mLabelVertices.size() / 4));
+		glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+		mAtlas->unbind();
+		mAtlas->disable();
+	}
 
-	const auto _w_float = static_cast<float>(ci::app::getWindowWidth());
-	const auto _h_float = static_cast<float>(ci::app::getWindowHeight());
+	glDisableClientState(GL_VERTEX_ARRAY);
+}
+
+void GridRenderer::buildAtlas()
+{
+	static ci::Font _axis_font("Arial", 20);
+
+	// rasterize every glyph once, shelf packed into rows
+	std::vector<ci::Surface8u> _cells;
+	std::vector<ci::Vec2i> _origins;
+	ci::Vec2i _pen(0, 0);
+	int _row_height = 0;
+	for (char c = FIRST_GLYPH; c <= LAST_GLYPH; ++c)
+	{
+		ci::TextLayout _layout;
+		_layout.clear(ci::ColorA(1.0f, 1.0f, 1.0f, 0.0f));
+		_layout.setFont(_axis_font);
+		_layout.setColor(ci::ColorA(1.0f, 1.0f, 1.0f, 1.0f));
+		_layout.addLine(std::string(1, c));
+		_cells.push_back(_layout.render(true, false));
+
+		const auto& _cell = _cells.back();
+		if (_pen.x + _cell.getWidth() > ATLAS_WIDTH)
+		{
+			_pen = ci::Vec2i(0, _pen.y + _row_height + GLYPH_PADDING);
+			_row_height = 0;
+		}
+		_origins.push_back(_pen);
+		_pen.x += _cell.getWidth() + GLYPH_PADDING;
+		_row_height = std::max(_row_height, _cell.getHeight());
+	}
+
+	ci::Surface8u _atlas(ATLAS_WIDTH, _pen.y + _row_height, true, ci::SurfaceChannelOrder::RGBA);
+	std::memset(_atlas.getData(), 0, _atlas.getRowBytes() * _atlas.getHeight());
+
+	const auto _w = static_cast<float>(_atlas.getWidth());
+	const auto _h = static_cast<float>(_atlas.getHeight());
+	mGlyphs.clear();
+	for (std::size_t index = 0; index < _cells.size(); ++index)
+	{
+		const auto& _cell = _cells[index];
+		const auto& _origin = _origins[index];
+		_atlas.copyFrom(_cell, _cell.getBounds(), _origin);
+
+		Glyph _glyph;
+		_glyph.mU0 = _origin.x / _w;
+		_glyph.mV0 = _origin.y / _h;
+		_glyph.mU1 = (_origin.x + _cell.getWidth()) / _w;
+		_glyph.mV1 = (_origin.y + _cell.getHeight()) / _h;
+		_glyph.mWidth = static_cast<float>(_cell.getWidth());
+		_glyph.mHeight = static_cast<float>(_cell.getHeight());
+		mGlyphs.push_back(_glyph);
+	}
+
+	mAscent = _axis_font.getAscent();
+	mAtlas = ci::gl::Texture::create(_atlas);
+	mGeometryDirty = true;
+}
+
+bool GridRenderer::isGeometryStale() const
+{
+	return mGeometryDirty
+		|| mBuiltWidth != ci::app::getWindowWidth()
+		|| mBuiltHeight != ci::app::getWindowHeight()
+		|| mBuiltStepX != mStepX
+		|| mBuiltStepY != mStepY
+		|| mBuiltLabelFrequency != mLabelFrequency
+		|| mBuiltLabelMargin != mLabelMargin;
+}
+
+void GridRenderer::buildGeometry()
+{
+	mGeometryDirty = false;
+	mBuiltWidth = ci::app::getWindowWidth();
+	mBuiltHeight = ci::app::getWindowHeight();
+	mBuiltStepX = mStepX;
+	mBuiltStepY = mStepY;
+	mBuiltLabelFrequency = mLabelFrequency;
+	mBuiltLabelMargin = mLabelMargin;
+
+	mLineVertices.clear();
+	mLabelVertices.clear();
+
+	const auto _w_float = static_cast<float>(mBuiltWidth);
+	const auto _h_float = static_cast<float>(mBuiltHeight);
+	const auto _frequency = std::max(mLabelFrequency, 1);
 
 	int count = 0;
-	// draw horizontal axis
-	for (int i = mStepY; i <= ci::app::getWindowHeight(); i += mStepY)
+	// horizontal axis
+	for (int i = mStepY; i <= mBuiltHeight; i += mStepY)
 	{
 		const auto _y = static_cast<float>(i);
-		ci::gl::drawLine(ci::Vec2f(0.0f, _y), ci::Vec2f(_w_float, _y));
+		mLineVertices.insert(mLineVertices.end(), { 0.0f, _y, _w_float, _y });
 
-		if (count % mLabelFrequency == 0) // every 4 steps, draw string of where we're standing
+		if (count % _frequency == 0) // every few steps, label where we're standing
 		{
 			const auto _val = ((i / _h_float) * (mMaxY - mMinY)) + mMinY;
-			ci::gl::drawStringCentered(std::to_string(_val) + mHorizontalUnitTextToDraw, ci::Vec2f(mLabelMargin * ci::app::getWindowAspectRatio(), _y), mLabelColor, _axis_font);
+			appendLabel(std::to_string(_val) + mHorizontalUnitTextToDraw, mLabelMargin * _w_float / _h_float, _y, false);
 		}
 
 		count++;
 	}
 
 	count = 0;
-	// draw vertical axis
-	for (int i = mStepX; i <= ci::app::getWindowWidth(); i += mStepX)
+	// vertical axis
+	for (int i = mStepX; i <= mBuiltWidth; i += mStepX)
 	{
 		const auto _x = static_cast<float>(i);
-		ci::gl::drawLine(ci::Vec2f(_x, 0.0f), ci::Vec2f(_x, _h_float));
+		mLineVertices.insert(mLineVertices.end(), { _x, 0.0f, _x, _h_float });
 
-		if (count % mLabelFrequency == 0) // every 4 steps, draw string of where we're standing
+		if (count % _frequency == 0)
 		{
-			ci::gl::pushMatrices();
-			ci::gl::rotate(-90.0f);
 			const auto _val = ((i / _w_float) * (mMaxX - mMinX)) + mMinX;
-			ci::gl::drawStringCentered(std::to_string(_val) + mVerticalUnitTextToDraw, ci::Vec2f((mLabelMargin - ci::app::getWindowHeight()), _x), mLabelColor, _axis_font);
-			ci::gl::popMatrices();
+			appendLabel(std::to_string(_val) + mVerticalUnitTextToDraw, _x, _h_float - mLabelMargin, true);
 		}
 
 		count++;
 	}
+}
+
+void GridRenderer::appendLabel(const std::string& text, float x, float y, bool rotated)
+{
+	float _width = 0.0f;
+	for (auto c : text)
+	{
+		if (c >= FIRST_GLYPH && c <= LAST_GLYPH) _width += mGlyphs[c - FIRST_GLYPH].mWidth;
+	}
+
+	// pen position along the text and across it, baseline at 0
+	float _along = -0.5f * _width;
+	const float _top = -mAscent;
+	for (auto c : text)
+	{
+		if (c < FIRST_GLYPH || c > LAST_GLYPH) continue;
+		const auto& _glyph = mGlyphs[c - FIRST_GLYPH];
+
+		const float _corners[4][4] = {
+			{ _along, _top, _glyph.mU0, _glyph.mV0 },
+			{ _along + _glyph.mWidth, _top, _glyph.mU1, _glyph.mV0 },
+			{ _along + _glyph.mWidth, _top + _glyph.mHeight, _glyph.mU1, _glyph.mV1 },
+			{ _along, _top + _glyph.mHeight, _glyph.mU0, _glyph.mV1 } };
 
+		for (const auto& corner : _corners)
+		{
+			// turned a quarter counter clockwise, the text reads bottom up
+			mLabelVertices.push_back(rotated ? x + corner[1] : x + corner[0]);
+			mLabelVertices.push_back(rotated ? y - corner[0] : y + corner[1]);
+			mLabelVertices.push_back(corner[2]);
+			mLabelVertices.push_back(corner[3]);
+		}
+
+		_along += _glyph.mWidth;
+	}
 }
 
 namespace {
@@ -104,27 +261,35 @@ void GridRenderer::setupPostLaunchGUI(cinder::params::InterfaceGl* const gui)
 
 void GridRenderer::setHorizontalBoundary(float min /*= 0.0f*/, float max /*= 1.0f*/)
 {
+	if (mMinX == min && mMaxX == max) return;
+
 	mMinX = min;
 	mMaxX = max;
+	mGeometryDirty = true;
 }
 
 void GridRenderer::setVerticalBoundary(float min /*= 0.0f*/, float max /*= 1.0f*/)
 {
 	// vertical axis draws upside down!
+	if (mMinY == max && mMaxY == min) return;
+
 	mMinY = max;
 	mMaxY = min;
+	mGeometryDirty = true;
 }
 
 void GridRenderer::setHorizontalUnit(const std::string& str)
 {
 	mHorizontalUnit = str;
 	mHorizontalUnitTextToDraw = mHorizontalUnit.empty() ? "" : (" (" + mHorizontalUnit + ")");
+	mGeometryDirty = true;
 }
 
 void GridRenderer::setVerticalUnit(const std::string& str)
 {
 	mVerticalUnit = str;
 	mVerticalUnitTextToDraw = mVerticalUnit.empty() ? "" : (" (" + mVerticalUnit + ")");
+	mGeometryDirty = true;
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,293 @@
+#if defined(CISTFT_HEADLESS)
+
+#include "app_config.h"
+#include "offline_analyzer.h"
+#include "palette_manager.h"
+#include "signal_generator.h"
+#include "wav_file.h"
+#include "work_manager.h"
+#include "work_metrics.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace cistft;
+
+namespace {
+//! hops held in memory per output buffer, two buffers are in flight
+static std::size_t CHUNK_HOPS = 4096;
+
+static const char* USAGE =
+"usage: cistft-cli [options] input.wav\n"
+"       cistft-cli [options] --signal <name>\n"
+"  -o <path>              output file (required)\n"
+"  -f ppm|raw             PPM image, one row per hop, or float32 magnitudes (default ppm)\n"
+"  --window <seconds>     window duration (default 0.02)\n"
+"  --hop <seconds>        hop duration (default 0.01)\n"
+"  --window-type <name>   blackman, hamming, hann or rect (default blackman)\n"
+"  --bins <count>         minimum number of visible bins (default 256)\n"
+"  --low-pass <hz>        highest visible frequency (default 10000)\n"
+"  --high-pass <hz>       lowest visible frequency (default 100)\n"
+"  --decimation <factor>  decimate before the transform, 0 is auto, 1 is off (default 0)\n"
+"  --fft-backend <name>   portable, fftw or pocketfft (default portable)\n"
+"  --palette <index>      color palette, 0 to 13 (default 0)\n"
+"  --db                   magnitudes and colors in decibels\n"
+"  --threads <count>      worker threads, 0 is one per CPU (default 0)\n"
+"generated input, instead of a file:\n"
+"  --signal <name>        white, pink, linear_chirp, log_chirp, tone_comb or impulses\n"
+"  --signal-seconds <s>   length of the signal (default 60)\n"
+"  --signal-low <hz>      lowest chirp / comb frequency (default 100)\n"
+"  --signal-high <hz>     highest chirp / comb frequency (default 10000)\n"
+"  --signal-period <s>    chirp sweep time, impulse spacing (default 10)\n"
+"  --channels <count>     (default 1)\n"
+"  --sample-rate <hz>     (default 44100)\n"
+"  --seed <number>        noise seed (default 1)\n";
+
+struct Options
+{
+	Options()
+		: mFormat("ppm")
+		, mWindowType(dsp::WindowType::Blackman)
+		, mPalette(0)
+		, mDecibel(false)
+		, mHasSignal(false)
+		, mSignalSeconds(60.0f)
+		, mLowPass(-1.0f)
+		, mHighPass(-1.0f)
+	{}
+
+	std::string			mInput;
+	std::string			mOutput;
+	std::string			mFormat;
+	dsp::WindowType		mWindowType;
+	int					mPalette;
+	bool				mDecibel;
+	bool				mHasSignal;
+	float				mSignalSeconds;
+	float				mLowPass;		// negative keeps the AppConfig default
+	float				mHighPass;
+	audio::SignalGenerator::Format
+						mSignal;
+};
+
+static bool _parse_window_type(const std::string& name, dsp::WindowType& type)
+{
+	if (name == "blackman") type = dsp::WindowType::Blackman;
+	else if (name == "hamming") type = dsp::WindowType::Hamming;
+	else if (name == "hann") type = dsp::WindowType::Hann;
+	else if (name == "rect") type = dsp::WindowType::Rect;
+	else return false;
+	return true;
+}
+
+//! answers false and prints why if the command line does not make sense
+static bool _parse_options(int argc, char** argv, Options& options, AppConfig& config)
+{
+	config.fftBackend(fft::BackendType::Portable);
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg(argv[i]);
+		const bool has_value = i + 1 < argc;
+
+		if (arg == "--db") { options.mDecibel = true; continue; }
+		if (arg[0] != '-') { options.mInput = arg; continue; }
+		if (!has_value) { std::fprintf(stderr, "%s needs a value\n", arg.c_str()); return false; }
+
+		const std::string value(argv[++i]);
+
+		if (arg == "-o") options.mOutput = value;
+		else if (arg == "-f") options.mFormat = value;
+		else if (arg == "--window") config.windowDuration(static_cast<float>(std::atof(value.c_str())));
+		else if (arg == "--hop") config.hopDuration(static_cast<float>(std::atof(value.c_str())));
+		else if (arg == "--bins") config.minimumViewableBins(std::atoi(value.c_str()));
+		else if (arg == "--low-pass") options.mLowPass = static_cast<float>(std::atof(value.c_str()));
+		else if (arg == "--high-pass") options.mHighPass = static_cast<float>(std::atof(value.c_str()));
+		else if (arg == "--palette") options.mPalette = std::atoi(value.c_str());
+		else if (arg == "--decimation") config.decimation(std::atoi(value.c_str()));
+		else if (arg == "--threads") config.workerThreads(std::atoi(value.c_str()));
+		else if (arg == "--signal-seconds") options.mSignalSeconds = static_cast<float>(std::atof(value.c_str()));
+		else if (arg == "--signal-low") options.mSignal.lowFrequency(static_cast<float>(std::atof(value.c_str())));
+		else if (arg == "--signal-high") options.mSignal.highFrequency(static_cast<float>(std::atof(value.c_str())));
+		else if (arg == "--signal-period") options.mSignal.period(static_cast<float>(std::atof(value.c_str())));
+		else if (arg == "--channels") options.mSignal.channels(std::atoi(value.c_str()));
+		else if (arg == "--sample-rate") options.mSignal.sampleRate(std::atoi(value.c_str()));
+		else if (arg == "--seed") options.mSignal.seed(std::strtoull(value.c_str(), nullptr, 10));
+		else if (arg == "--signal")
+		{
+			audio::SignalType _type;
+			if (!audio::SignalGenerator::parseSignalName(value, _type)) { std::fprintf(stderr, "unknown signal %s\n", value.c_str()); return false; }
+			options.mSignal.signal(_type);
+			options.mHasSignal = true;
+		}
+		else if (arg == "--window-type")
+		{
+			if (!_parse_window_type(value, options.mWindowType)) { std::fprintf(stderr, "unknown window %s\n", value.c_str()); return false; }
+		}
+		else if (arg == "--fft-backend")
+		{
+			fft::BackendType _type;
+			if (!fft::parseBackendName(value, _type) || !fft::isBackendAvailable(_type))
+			{
+				std::fprintf(stderr, "FFT backend %s is not built in\n", value.c_str());
+				return false;
+			}
+			config.fftBackend(_type);
+		}
+		else { std::fprintf(stderr, "unknown option %s\n", arg.c_str()); return false; }
+	}
+
+	if ((options.mInput.empty() && !options.mHasSignal) || options.mOutput.empty()) return false;
+	if (options.mFormat != "ppm" && options.mFormat != "raw") { std::fprintf(stderr, "unknown format %s\n", options.mFormat.c_str()); return false; }
+
+	// the full range of the window has to fit in the time range
+	config.timeRange(std::max(config.getTimeRange(), config.getWindowDuration()));
+	return true;
+}
+
+//! writes num_hops rows of packed RGBA8 pixels as RGB
+static void _write_ppm_rows(std::ofstream& out, const std::uint32_t* colors, std::size_t num_pixels, std::vector<char>& scratch)
+{
+	scratch.resize(num_pixels * 3);
+	for (std::size_t i = 0; i < num_pixels; ++i)
+	{
+		scratch[i * 3 + 0] = static_cast<char>(colors[i] & 0xFF);
+		scratch[i * 3 + 1] = static_cast<char>((colors[i] >> 8) & 0xFF);
+		scratch[i * 3 + 2] = static_cast<char>((colors[i] >> 16) & 0xFF);
+	}
+	out.write(scratch.data(), scratch.size());
+}
+} //!namespace
+
+int main(int argc, char** argv)
+{
+	AppConfig config;
+	Options options;
+
+	if (!_parse_options(argc, argv, options, config))
+	{
+		std::fputs(USAGE, stderr);
+		return 1;
+	}
+
+	audio::WavFile file;
+	audio::SampleView input;
+	std::vector<float> generated;
+	int sample_rate = 0;
+
+	if (options.mHasSignal)
+	{
+		// rendered up front, so generating does not count against the analysis
+		const auto& _format = options.mSignal;
+		audio::SignalGenerator _generator(_format);
+		const auto _frames = static_cast<std::size_t>(std::max(options.mSignalSeconds, 0.0f) * _format.getSampleRate());
+		generated.resize(_frames * _format.getChannelSize());
+		_generator.generateInterleaved(generated.data(), _frames);
+
+		input = audio::SampleView(generated.data(), _frames, _format.getChannelSize(), audio::SampleEncoding::Float32);
+		sample_rate = _format.getSampleRate();
+		options.mInput = audio::SignalGenerator::getSignalName(_format.getSignal());
+	}
+	else
+	{
+		if (!file.open(options.mInput))
+		{
+			std::fprintf(stderr, "%s\n", file.getError().c_str());
+			return 1;
+		}
+		input = file.getView();
+		sample_rate = file.getSampleRate();
+	}
+
+	// the band pass is clamped to the Nyquist frequency, it needs the sample rate first
+	config.sampleRate(sample_rate);
+	if (options.mLowPass >= 0.0f) config.lowPassFrequency(options.mLowPass);
+	if (options.mHighPass >= 0.0f) config.highPassFrequency(options.mHighPass);
+	config.lowPassFrequency(config.getLowPassFrequency());
+	config.setup();
+
+	palette::Manager::instance().setActivePalette(options.mPalette);
+	palette::Manager::instance().setConvertToDb(options.mDecibel);
+
+	std::ofstream output(options.mOutput, std::ios::binary);
+	if (!output)
+	{
+		std::fprintf(stderr, "cannot write %s\n", options.mOutput.c_str());
+		return 1;
+	}
+
+	work::Manager manager(config.getNumWorkerThreadsToSpawn(), config.getWorkerAffinity());
+	stft::OfflineAnalyzer analyzer(manager, config, input, options.mWindowType);
+
+	const auto num_hops = analyzer.getNumHops();
+	const auto num_bins = analyzer.getNumBins();
+	const bool is_ppm = options.mFormat == "ppm";
+
+	const auto duration = static_cast<double>(input.mNumFrames) / sample_rate;
+	std::fprintf(stderr, "%s: %zu channels, %d Hz, %.2f s\n", options.mInput.c_str(), input.mNumChannels, sample_rate, duration);
+	std::fprintf(stderr, "window %d, hop %zu, decimation %d, FFT %d (%s), bins %zu (%.1f - %.1f Hz), %zu threads\n",
+		config.getWindowDurationInSamples(), analyzer.getHopSize(), config.getDecimationFactor(), config.getCalculatedFftSize(), fft::getBackendName(config.getFftBackend()),
+		num_bins, config.getActualHighPassFrequency(), config.getActualLowPassFrequency(), manager.getNumThreads());
+
+	if (is_ppm)
+	{
+		output << "P6\n" << num_bins << " " << num_hops << "\n255\n";
+	}
+
+	// two chunks in flight, the pool fills one while the other is written out
+	std::vector<float> magnitudes[2];
+	std::vector<std::uint32_t> colors[2];
+	for (int b = 0; b < 2; ++b)
+	{
+		if (is_ppm) colors[b].resize(CHUNK_HOPS * num_bins);
+		else magnitudes[b].resize(CHUNK_HOPS * num_bins);
+	}
+
+	const auto started = work::getTimestamp();
+	std::vector<char> scratch;
+	int current = 0;
+
+	auto post_chunk = [&](std::size_t first_hop, int buffer) {
+		analyzer.post(	first_hop, CHUNK_HOPS,
+						is_ppm ? nullptr : magnitudes[buffer].data(),
+						is_ppm ? colors[buffer].data() : nullptr);
+	};
+
+	post_chunk(0, current);
+	analyzer.wait();
+
+	for (std::size_t first_hop = 0; first_hop < num_hops; first_hop += CHUNK_HOPS)
+	{
+		const auto count = std::min(CHUNK_HOPS, num_hops - first_hop);
+
+		if (first_hop + CHUNK_HOPS < num_hops)
+		{
+			post_chunk(first_hop + CHUNK_HOPS, 1 - current);
+		}
+
+		if (is_ppm) _write_ppm_rows(output, colors[current].data(), count * num_bins, scratch);
+		else output.write(reinterpret_cast<const char*>(magnitudes[current].data()), count * num_bins * sizeof(float));
+
+		analyzer.wait();
+		current = 1 - current;
+	}
+
+	output.close();
+	if (!output)
+	{
+		std::fprintf(stderr, "failed writing %s\n", options.mOutput.c_str());
+		return 1;
+	}
+
+	const auto seconds = (work::getTimestamp() - started) * 1e-9;
+	std::fprintf(stderr, "%zu hops x %zu bins in %.3f s, %.1fx real time\n",
+		num_hops, num_bins, seconds, seconds > 0.0 ? duration / seconds : 0.0);
+	return 0;
+}
+
+#endif // CISTFT_HEADLESS
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "metrics_panel.h"
+#include "app_globals.h"
+#include "audio_nodes.h"
+#include "stft_renderer.h"
+
+#include <cinder/app/App.h>
+#include <cinder/params/Params.h>
+
+#include <iomanip>
+#include <sstream>
+
+namespace cistft {
+
+namespace {
+//! seconds between two snapshots
+static double REFRESH_INTERVAL = 0.5;
+
+//! formats the interval since the previous snapshot and remembers the current one
+static std::string formatInterval(const work::HistogramSnapshot& current, work::HistogramSnapshot& last)
+{
+	auto _interval = current;
+	_interval.subtract(last);
+	last = current;
+
+	std::stringstream buf;
+	buf << std::fixed << std::setprecision(3)
+		<< _interval.getPercentile(50.0) * 1e-6 << " / "
+		<< _interval.getPercentile(99.0) * 1e-6 << " / "
+		<< _interval.getMax() * 1e-6;
+	return buf.str();
+}
+} //!namespace
+
+MetricsPanel::MetricsPanel(AppGlobals& globals)
+	: mGlobals(globals)
+	, mLastRefresh(0.0)
+	, mLastCpuTime(work::getProcessCpuTime())
+	, mLastCpuTimestamp(work::getTimestamp())
+{}
+
+const static std::string GUI_SEPARATOR("_M");
+
+void MetricsPanel::setupPostLaunchGUI(cinder::params::InterfaceGl* const gui)
+{
+	gui->addSeparator(GUI_SEPARATOR);
+	gui->addText("Performance (p50 / p99 / max ms):");
+	gui->addParam("Queue depth", &mQueueText, "readonly=true");
+	gui->addParam("Worker busy", &mBusyText, "readonly=true");
+	gui->addParam("Queue wait", &mWaitText, "readonly=true");
+	gui->addParam("Request service", &mServiceText, "readonly=true");
+	gui->addParam("Hop transform", &mTransformText, "readonly=true");
+	gui->addParam("Hop colorize", &mColorizeText, "readonly=true");
+	gui->addParam("Dropped / late / decimated", &mHopsText, "readonly=true");
+	gui->addParam("Render frame", &mFrameText, "readonly=true");
+	gui->addParam("Upload rows / calls / KiB per frame", &mUploadText, "readonly=true");
+	gui->addParam("Process CPU / frame rate", &mCpuText, "readonly=true");
+}
+
+void MetricsPanel::update()
+{
+	const auto _now = ci::app::getElapsedSeconds();
+	if (_now - mLastRefresh < REFRESH_INTERVAL) return;
+	mLastRefresh = _now;
+
+	mGlobals.getWorkManager().snapshot(mWorkMetrics);
+
+	std::stringstream buf;
+	buf << mWorkMetrics.mQueueDepth << " requests";
+	mQueueText = buf.str();
+
+	buf.str("");
+	for (auto ratio : mWorkMetrics.mBusyRatio)
+	{
+		buf << static_cast<int>(ratio * 100.0f + 0.5f) << "% ";
+	}
+	mBusyText = buf.str();
+
+	mWaitText = formatInterval(mWorkMetrics.mWaitTime, mLastWaitTime);
+	mServiceText = formatInterval(mWorkMetrics.mServiceTime, mLastServiceTime);
+
+	if (auto client = mGlobals.getAudioNodes().getStftClient())
+	{
+		client->snapshot(mStftMetrics);
+
+		mTransformText = formatInterval(mStftMetrics.mTransformTime, mLastTransformTime);
+		mColorizeText = formatInterval(mStftMetrics.mColorizeTime, mLastColorizeTime);
+
+		buf.str("");
+		buf << mStftMetrics.mDroppedHops << " / " << mStftMetrics.mLateHops << " / " << mStftMetrics.mDecimatedHops;
+		mHopsText = buf.str();
+	}
+
+	mGlobals.getThreadRenderer().snapshot(mRenderMetrics);
+	mFrameText = formatInterval(mRenderMetrics.mFrameTime, mLastRenderMetrics.mFrameTime);
+
+	// per frame averages over the interval
+	const auto _frames = mRenderMetrics.mNumFrames - mLastRenderMetrics.mNumFrames;
+	const auto _per_frame = _frames > 0 ? 1.0 / _frames : 0.0;
+	buf.str("");
+	buf << std::fixed << std::setprecision(1)
+		<< (mRenderMetrics.mUploadedRows - mLastRenderMetrics.mUploadedRows) * _per_frame << " / "
+		<< (mRenderMetrics.mUploadCalls - mLastRenderMetrics.mUploadCalls) * _per_frame << " / "
+		<< (mRenderMetrics.mUploadedBytes - mLastRenderMetrics.mUploadedBytes) * _per_frame / 1024.0;
+	mUploadText = buf.str();
+	mLastRenderMetrics.mNumFrames = mRenderMetrics.mNumFrames;
+	mLastRenderMetrics.mUploadedRows = mRenderMetrics.mUploadedRows;
+	mLastRenderMetrics.mUploadCalls = mRenderMetrics.mUploadCalls;
+	mLastRenderMetrics.mUploadedBytes = mRenderMetrics.mUploadedBytes;
+
+	const auto _cpu_time = work::getProcessCpuTime();
+	const auto _timestamp = work::getTimestamp();
+	const auto _wall_time = _timestamp - mLastCpuTimestamp;
+	buf.str("");
+	buf << std::fixed << std::setprecision(1)
+		<< (_wall_time > 0 ? 100.0 * (_cpu_time - mLastCpuTime) / _wall_time : 0.0) << "% / "
+		<< ci::app::App::get()->getAverageFps() << " fps";
+	mCpuText = buf.str();
+	mLastCpuTime = _cpu_time;
+	mLastCpuTimestamp = _timestamp;
+}
+
+} //!cistft
\ No newline at end of file
@@ -1,49 +1,96 @@
 #include "monitor_renderer.h"
 #include "app_globals.h"
 #include "audio_nodes.h"
+#include "waveform_node.h"
 
-#include <cinder/audio/MonitorNode.h>
 #include <cinder/gl/gl.h>
 #include <cinder/app/App.h>
 
+#include <algorithm>
+
 namespace cistft {
 
 MonitorRenderer::MonitorRenderer(AppGlobals& g)
 	: mGlobals(g)
+	, mHasVertexBuffer(false)
 {}
 
 void MonitorRenderer::draw()
 {
 	if (!mGlobals.getAudioNodes().isMonitorReady()) return;
 
-	ci::gl::SaveColorState _save_color;
+	auto node = mGlobals.getAudioNodes().getMonitorNode();
+	const auto _columns = static_cast<std::size_t>(std::max(ci::app::getWindowWidth(), 1));
+	const auto _channels = node->getNumChannels();
+
+	if (!node->getColumns(_columns, mMins, mMaxs)) return;
+
+	// the GL context does not exist yet when the renderer is constructed
+	if (!mHasVertexBuffer)
+	{
+		mVertexBuffer = ci::gl::Vbo(GL_ARRAY_BUFFER);
+		mHasVertexBuffer = true;
+	}
+
+	// orphan last frame's storage so mapping does not wait on the GPU
+	mVertexBuffer.bind();
+	mVertexBuffer.bufferData(_columns * _channels * 4 * sizeof(float), nullptr, GL_STREAM_DRAW);
+	auto _mapped = reinterpret_cast<float*>(mVertexBuffer.map(GL_WRITE_ONLY));
+	if (!_mapped)
+	{
+		mVertexBuffer.unbind();
+		return;
+	}
 
-	auto buffer = mGlobals.getAudioNodes().getMonitorNode()->getBuffer();
+	const auto _num_vertices = fillVertices(_mapped, _columns, _channels);
+	mVertexBuffer.unmap();
 
-	ci::gl::lineWidth(3.0f);
+	ci::gl::SaveColorState _save_color;
 	ci::gl::color(0.65f, 0.80f, 0.44f, 1);
 
-	const float waveHeight = ci::app::getWindowHeight() / (float)buffer.getNumChannels();
-	const float xScale = ci::app::getWindowWidth() / (float)buffer.getNumFrames();
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glVertexPointer(2, GL_FLOAT, 0, nullptr); // offset into the vertex buffer
+	glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(_num_vertices));
+	glDisableClientState(GL_VERTEX_ARRAY);
 
+	mVertexBuffer.unbind();
+}
+
+std::size_t MonitorRenderer::fillVertices(float* vertices, std::size_t columns, std::size_t channels) const
+{
+	const float waveHeight = ci::app::getWindowHeight() / (float)channels;
+
+	float* out = vertices;
 	float yOffset = 0.0f;
-	for (std::size_t ch = 0; ch < buffer.getNumChannels(); ch++) {
-		ci::PolyLine2f waveform;
-		const float *channel = buffer.getChannel(ch);
-		float x = 0.0f;
-		for (std::size_t i = 0; i < buffer.getNumFrames(); i++) {
-			x += xScale;
-			float y = (1 - (channel[i] * 0.5f + 0.5f)) * waveHeight + yOffset;
-			waveform.push_back(ci::Vec2f(x, y));
-		}
+	for (std::size_t ch = 0; ch < channels; ++ch)
+	{
+		const float* mins = mMins.data() + ch * columns;
+		const float* maxs = mMaxs.data() + ch * columns;
+
+		for (std::size_t i = 0; i < columns; ++i)
+		{
+			// reach the previous column so the trace has no gaps
+			float lo = mins[i], hi = maxs[i];
+			if (i > 0)
+			{
+				lo = std::min(lo, maxs[i - 1]);
+				hi = std::max(hi, mins[i - 1]);
+			}
 
-		if (!waveform.getPoints().empty())
-			ci::gl::draw(waveform);
+			const float x = i + 0.5f;
+			const float top = (1 - (hi * 0.5f + 0.5f)) * waveHeight + yOffset;
+			float bottom = (1 - (lo * 0.5f + 0.5f)) * waveHeight + yOffset;
+			// a flat column still covers one pixel
+			if (bottom - top < 1.0f) bottom = top + 1.0f;
+
+			*out++ = x; *out++ = top;
+			*out++ = x; *out++ = bottom;
+		}
 
 		yOffset += waveHeight;
 	}
 
-	ci::gl::lineWidth(1.0f); //restore
+	return static_cast<std::size_t>(out - vertices) / 2;
 }
 
-}
\ No newline at end of file
+} //!cistft
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include "offline_analyzer.h"
+#include "app_config.h"
+#include "palette_manager.h"
+#include "stft_client_storage.h"
+
+#include <algorithm>
+
+namespace cistft {
+namespace stft {
+
+namespace {
+//! hops per request, large enough to hide the queueing cost
+static std::size_t BATCH_HOPS = 64;
+//! hops transformed and thrown away before a batch, smoothing weighs them 0.5^16 at most
+static std::size_t PRE_ROLL_HOPS = 16;
+
+/*!
+ * \class BatchRequest
+ * \brief a range of hops and where their spectra go.
+ */
+class BatchRequest : public work::Request
+{
+public:
+	BatchRequest(std::size_t first_hop, std::size_t num_hops, float* magnitudes, std::uint32_t* colors)
+		: mFirstHop(first_hop), mNumHops(num_hops), mMagnitudes(magnitudes), mColors(colors) {}
+
+	std::size_t		mFirstHop;
+	std::size_t		mNumHops;
+	float*			mMagnitudes;
+	std::uint32_t*	mColors;
+};
+
+//! analyzers are numbered, an address could be reused by the next one
+static std::atomic<std::uint64_t> _next_id(1);
+//! the analyzer a thread's storage was built for
+thread_local static std::uint64_t _storage_owner = 0;
+thread_local static ClientStorage* _storage = nullptr;
+} //!namespace
+
+/*!
+ * \class Worker
+ * \brief the work::Client side of the analyzer, forwards batches back to it.
+ */
+class OfflineAnalyzer::Worker : public work::Client
+{
+public:
+	Worker(work::Manager& manager, OfflineAnalyzer* analyzer = nullptr) : work::Client(manager), mAnalyzer(analyzer) {}
+
+	void handle(work::RequestRef req) override
+	{
+		auto batch_ptr = static_cast<BatchRequest*>(req.get());
+		mAnalyzer->process(batch_ptr->mFirstHop, batch_ptr->mNumHops, batch_ptr->mMagnitudes, batch_ptr->mColors);
+
+		if (mAnalyzer->mPendingBatches.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			std::lock_guard<std::mutex> _lock(mAnalyzer->mDoneLock);
+			mAnalyzer->mDone.notify_all();
+		}
+	}
+
+private:
+	OfflineAnalyzer* mAnalyzer;
+};
+
+OfflineAnalyzer::OfflineAnalyzer(work::Manager& manager, const AppConfig& config, const audio::SampleView& input, dsp::WindowType window_type)
+	: mInput(input)
+	, mConfig(config)
+	, mId(_next_id.fetch_add(1))
+	, mHopSize(std::max(config.getHopDurationInSamples(), 1))
+	, mNumHops(0)
+	, mPendingBatches(0)
+{
+	mFormat = Client::Format()
+		.channels(input.mNumChannels)
+		.fftSize(config.getCalculatedFftSize())
+		.windowSize(config.getWindowDurationInSamples())
+		.windowType(window_type)
+		.decimation(config.getDecimationFactor());
+
+	if (mFormat.getWindowSize() > 0 && input.mNumFrames >= mFormat.getWindowSize())
+		mNumHops = (input.mNumFrames - mFormat.getWindowSize()) / mHopSize + 1;
+
+	mClient = work::make_client<Worker>(manager, this);
+}
+
+OfflineAnalyzer::~OfflineAnalyzer()
+{
+	wait();
+}
+
+std::size_t OfflineAnalyzer::getNumBins() const
+{
+	return static_cast<std::size_t>(mConfig.getActualViewableBins());
+}
+
+void OfflineAnalyzer::post(std::size_t first_hop, std::size_t num_hops, float* magnitudes, std::uint32_t* colors)
+{
+	const auto bins = getNumBins();
+	num_hops = std::min(num_hops, mNumHops - std::min(first_hop, mNumHops));
+
+	for (std::size_t done = 0; done < num_hops; done += BATCH_HOPS)
+	{
+		const auto count = std::min(BATCH_HOPS, num_hops - done);
+		auto request = work::make_request<BatchRequest>(first_hop + done,
+														count,
+														magnitudes ? magnitudes + done * bins : nullptr,
+														colors ? colors + done * bins : nullptr);
+
+		mPendingBatches.fetch_add(1, std::memory_order_relaxed);
+		mClient->request(request);
+	}
+}
+
+void OfflineAnalyzer::wait()
+{
+	std::unique_lock<std::mutex> _lock(mDoneLock);
+	mDone.wait(_lock, [this] { return mPendingBatches.load(std::memory_order_acquire) == 0; });
+}
+
+ClientStorage& OfflineAnalyzer::getStorage()
+{
+	if (_storage_owner != mId)
+	{
+		std::lock_guard<std::mutex> _lock(mStorageLock);
+		mStorage.push_back(std::make_unique<ClientStorage>(mFormat, mConfig));
+		_storage = mStorage.back().get();
+		_storage_owner = mId;
+	}
+	return *_storage;
+}
+
+void OfflineAnalyzer::process(std::size_t first_hop, std::size_t num_hops, float* magnitudes, std::uint32_t* colors)
+{
+	auto& storage = getStorage();
+	const auto bins = getNumBins();
+
+	//! one table per batch, picked before the run
+	const palette::Manager::TableGuard table;
+
+	//! warm the smoothing up the same way no matter which batch ran here before
+	resetSmoothing(storage);
+	const auto start_hop = first_hop - std::min(first_hop, PRE_ROLL_HOPS);
+
+	for (auto hop = start_hop; hop < first_hop + num_hops; ++hop)
+	{
+		//! straight out of the input, converted while windowing
+		windowInterleavedHop(storage, mInput.getFrames(hop * mHopSize), mInput.mEncoding);
+		transformHop(storage, table->isDecibel());
+
+		if (hop < first_hop) continue;
+
+		const auto row = (hop - first_hop) * bins;
+		if (magnitudes)
+		{
+			std::copy(storage.mMagSpectrum.begin(), storage.mMagSpectrum.end(), magnitudes + row);
+		}
+
+		if (colors)
+		{
+			table->colorize(storage.mMagSpectrum.data(), colors + row, bins);
+		}
+	}
+}
+
+}} //!cistft::stft
\ No newline at end of file
@@ -132,7 +132,7 @@ links.forEach(function (link) {
                     _paletteName += capitalizeFirstLetter(piece);
                 });
 
-                console.log("const std::array<const ci::Color, " + _numColor + "> " + _paletteName + "::palette{{"); //C++
+                console.log("const std::array<const Color, " + _numColor + "> " + _paletteName + "::palette{{"); //C++
 
             } else if (line.indexOf("#") == 0) {
                 return; /* no op */
@@ -155,7 +155,7 @@ links.forEach(function (link) {
                     b = colors[2];
                 }
 
-                console.log("\tci::Color(" + r + "f, " + g + "f, " + b + "f)" + ((_lineCount == _numColor) ? "" : ",")); //C++
+                console.log("\tColor(" + r + "f, " + g + "f, " + b + "f)" + ((_lineCount == _numColor) ? "" : ",")); //C++
 
                 // Done.
                 if (_lineCount == _numColor) {
@@ -1,11 +1,47 @@
 #include "palette_manager.h"
 
-#include <cinder/audio/Utilities.h>
+#if !defined(CISTFT_HEADLESS)
 #include <cinder/params/Params.h>
+#endif
+
+#include <algorithm>
+#include <limits>
 
 namespace cistft {
 namespace palette {
 
+struct ReaderSlot
+{
+	ReaderSlot() : mEpoch(0), mInUse(true), mNext(nullptr) {}
+
+	std::atomic<std::uint64_t>	mEpoch;	//!< epoch the owner started reading in, 0 while not reading
+	std::atomic<bool>			mInUse;	//!< owned by a live thread
+	ReaderSlot*					mNext;
+};
+
+namespace {
+//! the calling thread's slot, given back when the thread exits
+struct ReaderSlotOwner
+{
+	ReaderSlotOwner() : mSlot(nullptr), mDepth(0) {}
+	~ReaderSlotOwner() { if (mSlot) mSlot->mInUse.store(false, std::memory_order_release); }
+
+	ReaderSlot*		mSlot;
+	int				mDepth; //!< nested guards only pin once
+};
+
+thread_local ReaderSlotOwner _reader;
+} //!namespace
+
+Manager::TableGuard::TableGuard()
+	: mTable(Manager::instance().pin())
+{}
+
+Manager::TableGuard::~TableGuard()
+{
+	Manager::instance().unpin();
+}
+
 Manager::Manager()
 	: mActivePalette(0)
 	, mLinearCoefficient(1024)
@@ -13,8 +49,23 @@ Manager::Manager()
 	, mConvertToDb(false)
 	, mMinThreshold(0.0f)
 	, mMaxThreshold(1.0f)
-	, mColorProvider([](float v, float min, float max)->const ci::Color&{ return getColor<MatlabJet>(v, min, max); })
-{}
+	, mActiveTable(nullptr)
+	, mEpoch(1)
+	, mReaders(nullptr)
+{
+	publishTable();
+}
+
+Manager::~Manager()
+{
+	auto _slot = mReaders.load(std::memory_order_acquire);
+	while (_slot)
+	{
+		auto _next = _slot->mNext;
+		delete _slot;
+		_slot = _next;
+	}
+}
 
 Manager& Manager::instance()
 {
@@ -24,105 +75,172 @@ Manager& Manager::instance()
 
 namespace {
 static int NUM_PALETTES = 14;
+
+template<typename T>
+static std::vector<std::uint32_t> _pack_palette()
+{
+	std::vector<std::uint32_t> _packed;
+	_packed.reserve(T::palette.size());
+	for (const auto& color : T::palette)
+	{
+		_packed.push_back(ColorTable::packColor(color.r, color.g, color.b));
+	}
+	return _packed;
+}
+
+static std::vector<std::uint32_t> _pack_palette(int palette_index)
+{
+	switch (palette_index)
+	{
+	case 1: return _pack_palette<MatlabHot>();
+	case 2: return _pack_palette<MPLSummer>();
+	case 3: return _pack_palette<MPLPaired>();
+	case 4: return _pack_palette<MPLOcean>();
+	case 5: return _pack_palette<MPLWinter>();
+	case 6: return _pack_palette<OceanLakeLandSnow>();
+	case 7: return _pack_palette<SVGBhw322>();
+	case 8: return _pack_palette<MPLGnuplot>();
+	case 9: return _pack_palette<MPLFlag>();
+	case 10: return _pack_palette<NCVManga>();
+	case 11: return _pack_palette<MPLPrism>();
+	case 12: return _pack_palette<SVGLindaa07>();
+	case 13: return _pack_palette<SVGGallet13>();
+	default: return _pack_palette<MatlabJet>();
+	}
+}
 } //!namespace
 
-void Manager::setActivePalette(int palette_index)
+void Manager::publishTable()
 {
-	if (palette_index < 0 || mActivePalette == palette_index) return;
+	std::lock_guard<std::mutex> _lock(mPublishLock);
 
-	mActivePalette = palette_index % NUM_PALETTES;
+	ColorTable::Mapping _mapping;
+	_mapping.mConvertToDb = mConvertToDb;
+	_mapping.mLinearCoefficient = mLinearCoefficient;
+	_mapping.mDbDivisor = mDbDivisor;
+	_mapping.mMinThreshold = mMinThreshold;
+	_mapping.mMaxThreshold = mMaxThreshold;
+
+	const auto _palette = _pack_palette(mActivePalette);
+	auto _table = std::make_unique<const ColorTable>(_palette.data(), _palette.size(), _mapping);
 
-	std::lock_guard<std::mutex> _lock(mColorProviderLock);
+	// swap first, then move to a new epoch: readers announcing it are sure to see the new table
+	mActiveTable.store(_table.get());
+	const auto _epoch = mEpoch.fetch_add(1) + 1;
 
-	switch (mActivePalette)
+	if (mOwnedTable)
 	{
-	case 0:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<MatlabJet>(v, min, max); };
-		break;
-	case 1:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<MatlabHot>(v, min, max); };
-		break;
-	case 2:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<MPLSummer>(v, min, max); };
-		break;
-	case 3:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<MPLPaired>(v, min, max); };
-		break;
-	case 4:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<MPLOcean>(v, min, max); };
-		break;
-	case 5:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<MPLWinter>(v, min, max); };
-		break;
-	case 6:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<OceanLakeLandSnow>(v, min, max); };
-		break;
-	case 7:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<SVGBhw322>(v, min, max); };
-		break;
-	case 8:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<MPLGnuplot>(v, min, max); };
-		break;
-	case 9:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<MPLFlag>(v, min, max); };
-		break;
-	case 10:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<NCVManga>(v, min, max); };
-		break;
-	case 11:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<MPLPrism>(v, min, max); };
-		break;
-	case 12:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<SVGLindaa07>(v, min, max); };
-		break;
-	case 13:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<SVGGallet13>(v, min, max); };
-		break;
-	default:
-		mColorProvider = [](float v, float min, float max)->const ci::Color&{ return getColor<MatlabJet>(v, min, max); };
-		break;
+		mRetiredTables.emplace_back(_epoch, std::move(mOwnedTable));
 	}
+	mOwnedTable = std::move(_table);
+
+	reclaimTables();
 }
 
-const ci::Color& Manager::getActivePaletteColor(float FFT_value)
+void Manager::reclaimTables()
 {
-	float min = mMinThreshold;
-	float max = mMaxThreshold;
+	// the oldest epoch a reader may still be using a table from
+	auto _oldest = std::numeric_limits<std::uint64_t>::max();
+	for (auto _slot = mReaders.load(); _slot; _slot = _slot->mNext)
+	{
+		const auto _epoch = _slot->mEpoch.load();
+		if (_epoch != 0 && _epoch < _oldest) _oldest = _epoch;
+	}
 
-	const float value = mConvertToDb ? ci::audio::linearToDecibel(FFT_value) / mDbDivisor : mLinearCoefficient * FFT_value;
-	
-	return mColorProvider(value, min, max);
+	// a table retired in epoch e is unreachable for readers that started in e or later
+	mRetiredTables.erase(std::remove_if(mRetiredTables.begin(), mRetiredTables.end(),
+		[_oldest](const std::pair<std::uint64_t, std::unique_ptr<const ColorTable>>& retired) { return retired.first <= _oldest; }),
+		mRetiredTables.end());
+}
+
+ReaderSlot& Manager::getReaderSlot()
+{
+	if (_reader.mSlot) return *_reader.mSlot;
+
+	// reuse the slot of a thread that exited
+	for (auto _slot = mReaders.load(std::memory_order_acquire); _slot; _slot = _slot->mNext)
+	{
+		bool _free = false;
+		if (_slot->mInUse.compare_exchange_strong(_free, true, std::memory_order_acquire))
+		{
+			_reader.mSlot = _slot;
+			return *_slot;
+		}
+	}
+
+	auto _slot = new ReaderSlot;
+	_slot->mNext = mReaders.load(std::memory_order_relaxed);
+	while (!mReaders.compare_exchange_weak(_slot->mNext, _slot, std::memory_order_release, std::memory_order_relaxed));
+
+	_reader.mSlot = _slot;
+	return *_slot;
+}
+
+const ColorTable* Manager::pin()
+{
+	auto& _slot = getReaderSlot();
+
+	// sequentially consistent on purpose: the announcement has to be visible
+	// to a publisher before this thread loads the table it protects
+	if (_reader.mDepth++ == 0)
+	{
+		_slot.mEpoch.store(mEpoch.load());
+	}
+	return mActiveTable.load();
+}
+
+void Manager::unpin()
+{
+	if (--_reader.mDepth == 0)
+	{
+		_reader.mSlot->mEpoch.store(0, std::memory_order_release);
+	}
+}
+
+void Manager::setActivePalette(int palette_index)
+{
+	if (palette_index < 0 || mActivePalette == palette_index) return;
+
+	mActivePalette = palette_index % NUM_PALETTES;
+	publishTable();
 }
 
 void Manager::setLinearCoefficient(float coeff)
 {
-	if (coeff < 0.0f) return;
+	if (coeff < 0.0f || mLinearCoefficient == coeff) return;
 	mLinearCoefficient = coeff;
+	publishTable();
 }
 
 void Manager::setDbDivisor(float div)
 {
-	if (div == 0.0f) return;
+	if (div == 0.0f || mDbDivisor == div) return;
 	mDbDivisor = div;
+	publishTable();
 }
 
 void Manager::setConvertToDb(bool convert)
 {
+	if (mConvertToDb == convert) return;
 	mConvertToDb = convert;
+	publishTable();
 }
 
 void Manager::setMinThreshold(float val)
 {
-	if (val < 0.0f || val > mMaxThreshold) return;
+	if (val < 0.0f || val > mMaxThreshold || mMinThreshold == val) return;
 	mMinThreshold = val;
+	publishTable();
 }
 
 void Manager::setMaxThreshold(float val)
 {
-	if (val < 0.0f || val < mMinThreshold) return;
+	if (val < 0.0f || val < mMinThreshold || mMaxThreshold == val) return;
 	mMaxThreshold = val;
+	publishTable();
 }
 
+#if !defined(CISTFT_HEADLESS)
 namespace {
 const static std::string GUI_SEPARATOR("_P");
 const static std::string PRE_LAUNCH_TEXT("Palettes will be configurable after you hit START.");
@@ -182,4 +300,6 @@ void Manager::setupPostLaunchGUI(cinder::params::InterfaceGl* const gui)
 	gui->addSeparator();
 }
 
+#endif // !CISTFT_HEADLESS
+
 }} //!cistft::palette
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "palette_table.h"
+#include "spectrum_kernel.h"
+
+#include <algorithm>
+
+namespace cistft {
+namespace palette {
+
+namespace {
+//! keeps a zero width threshold range from dividing by zero
+static const float MIN_THRESHOLD_RANGE = 1e-6f;
+
+inline std::uint32_t packChannel(float v)
+{
+	if (!(v > 0.0f)) return 0;
+	if (v >= 1.0f) return 255;
+	return static_cast<std::uint32_t>(v * 255.0f + 0.5f);
+}
+} //!namespace
+
+ColorTable::ColorTable(const std::uint32_t* palette, std::size_t palette_size, const Mapping& mapping)
+	: mMapping(mapping)
+	, mTable(SIZE)
+{
+	// entry i holds the palette color of i / (SIZE - 1), same rounding as palette::getColor
+	for (std::size_t i = 0; i < SIZE; ++i)
+	{
+		const auto t = static_cast<float>(i) / (SIZE - 1);
+		mTable[i] = palette[static_cast<std::size_t>(t * (palette_size - 1))];
+	}
+
+	// value -> [min, max] -> [0, 1] -> [0, SIZE - 1]
+	const auto range = std::max(mapping.mMaxThreshold - mapping.mMinThreshold, MIN_THRESHOLD_RANGE);
+	const auto gain = mapping.mConvertToDb ? 1.0f / mapping.mDbDivisor : mapping.mLinearCoefficient;
+
+	mScale = gain * (SIZE - 1) / range;
+	mOffset = -mapping.mMinThreshold * (SIZE - 1) / range;
+}
+
+void ColorTable::colorize(const float* spectrum, std::uint32_t* out, std::size_t size) const
+{
+	dsp::lookupTable(spectrum, out, size, mScale, mOffset, mTable.data(), mTable.size());
+}
+
+std::uint32_t ColorTable::lookup(float value) const
+{
+	std::uint32_t color;
+	dsp::lookupTable(&value, &color, 1, mScale, mOffset, mTable.data(), mTable.size());
+	return color;
+}
+
+std::uint32_t ColorTable::packColor(float r, float g, float b)
+{
+	return packChannel(r) | (packChannel(g) << 8) | (packChannel(b) << 16) | (0xffu << 24);
+}
+
+}} //!cistft::palette
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "polyphase_decimator.h"
+
+#include <cmath>
+
+namespace cistft {
+namespace dsp {
+
+namespace {
+//! filter length per unit of decimation. A Blackman transition is about
+//! 5.5 / length wide, 24 puts it between PASSBAND and 2 - PASSBAND.
+static const std::size_t TAPS_PER_PHASE = 24;
+static const double PI = 3.141592653589793;
+static const double TWO_PI = 6.283185307179586;
+} //!namespace
+
+const float PolyphaseDecimator::PASSBAND = 0.76f;
+
+PolyphaseDecimator::PolyphaseDecimator(std::size_t factor)
+	: mFactor(factor > 0 ? factor : 1)
+{
+	const std::size_t _length = TAPS_PER_PHASE * mFactor + 1;
+	const double _center = (_length - 1) * 0.5;
+	// cut off at the output Nyquist frequency, in cycles per input sample
+	const double _cutoff = 0.5 / mFactor;
+
+	mCoefficients.resize(_length);
+	double _sum = 0.0;
+	for (std::size_t i = 0; i < _length; ++i)
+	{
+		const double _t = i - _center;
+		const double _sinc = _t == 0.0 ? 2.0 * _cutoff : std::sin(TWO_PI * _cutoff * _t) / (PI * _t);
+		const double _x = static_cast<double>(i) / (_length - 1);
+		const double _window = 0.42 - 0.5 * std::cos(TWO_PI * _x) + 0.08 * std::cos(2.0 * TWO_PI * _x);
+		mCoefficients[i] = static_cast<float>(_sinc * _window);
+		_sum += mCoefficients[i];
+	}
+
+	// unity gain at DC, decimation must not change the magnitudes
+	for (auto& coeff : mCoefficients) coeff = static_cast<float>(coeff / _sum);
+}
+
+void PolyphaseDecimator::process(const float* padded_input, float* out, std::size_t num_outputs, const float* window) const
+{
+	const float* h = mCoefficients.data();
+	const std::size_t length = mCoefficients.size();
+
+	for (std::size_t k = 0; k < num_outputs; ++k)
+	{
+		// centered on input sample k * factor, only the outputs we keep are computed
+		const float* x = padded_input + k * mFactor;
+
+		// four partial sums, lets the compiler vectorize without reassociating
+		float acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+		std::size_t j = 0;
+		for (; j + 4 <= length; j += 4)
+		{
+			acc0 += h[j] * x[j];
+			acc1 += h[j + 1] * x[j + 1];
+			acc2 += h[j + 2] * x[j + 2];
+			acc3 += h[j + 3] * x[j + 3];
+		}
+		for (; j < length; ++j)
+		{
+			acc0 += h[j] * x[j];
+		}
+
+		out[k] = (acc0 + acc1 + acc2 + acc3) * window[k];
+	}
+}
+
+std::size_t PolyphaseDecimator::calculateFactor(float sample_rate, float max_frequency, std::size_t max_factor)
+{
+	if (max_frequency <= 0.0f || sample_rate <= 0.0f) return 1;
+
+	// max_frequency has to stay below PASSBAND times the decimated Nyquist frequency
+	const auto _factor = static_cast<std::size_t>(std::floor(PASSBAND * sample_rate * 0.5f / max_frequency));
+	if (_factor < 1) return 1;
+	return _factor < max_factor ? _factor : max_factor;
+}
+
+}} //!cistft::dsp
\ No newline at end of file
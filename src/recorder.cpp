@@ -0,0 +1,102 @@
+#include "recorder.h"
+#include "app_config.h"
+
+#include <algorithm>
+
+namespace cistft {
+namespace audio {
+
+Recorder::Recorder(const AppConfig& config)
+	: mWindowSize(config.getWindowDurationInSamples())
+	, mHopSize(config.getHopDurationInSamples())
+	, mLastQueried(0)
+{
+	// enough for one window, the next hop and whatever the workers lag behind
+	mRingCapacity = mWindowSize + mHopSize + config.getMaxWorkerLagInSamples();
+}
+
+void Recorder::initialize(std::size_t num_channels)
+{
+	std::atomic_store(&mRingBuffer, std::make_shared<RingBuffer>(mRingCapacity, num_channels));
+	mLastQueried = 0;
+}
+
+void Recorder::uninitialize()
+{
+	// a worker may be reading a window right now, it keeps the ring alive until it is done
+	std::atomic_store(&mRingBuffer, std::shared_ptr<RingBuffer>());
+}
+
+void Recorder::write(const float* data, std::size_t frames, std::size_t channel_stride)
+{
+	mRingBuffer->write(data, frames, channel_stride);
+}
+
+RingBufferRef Recorder::getRingBuffer() const
+{
+	return std::atomic_load(&mRingBuffer);
+}
+
+std::uint64_t Recorder::getWritePosition() const
+{
+	const auto _ring = getRingBuffer();
+	if (!_ring) return 0;
+	return _ring->getWritePosition();
+}
+
+std::size_t Recorder::popBufferWindows(std::uint64_t& query_pos, std::size_t max_pops)
+{
+	const auto _count = std::min(getNumPendingPops(), max_pops);
+	if (_count == 0) return 0;
+
+	query_pos = mLastQueried;
+	mLastQueried += _count * mHopSize;
+	return _count;
+}
+
+void Recorder::skipBufferWindows(std::size_t count)
+{
+	mLastQueried += std::min(getNumPendingPops(), count) * mHopSize;
+}
+
+std::uint64_t Recorder::getNumRecordedPops() const
+{
+	const auto _written = getWritePosition();
+	return _written < mWindowSize ? 0 : (_written - mWindowSize) / mHopSize + 1;
+}
+
+std::size_t Recorder::getNumPendingPops() const
+{
+	const auto _written = getWritePosition();
+
+	if (mLastQueried + mWindowSize <= _written)
+	{
+		return static_cast<std::size_t>((_written - mLastQueried - mWindowSize) / mHopSize + 1);
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+std::size_t Recorder::getWindowSize() const
+{
+	return mWindowSize;
+}
+
+std::size_t Recorder::getHopSize() const
+{
+	return mHopSize;
+}
+
+std::size_t Recorder::getRingCapacity() const
+{
+	return mRingCapacity;
+}
+
+std::uint64_t Recorder::getQueryIndexByQueryPos(std::uint64_t pos) const
+{
+	return pos / mHopSize;
+}
+
+}} //!cistft::audio
\ No newline at end of file
@@ -8,97 +8,38 @@ namespace cistft {
 namespace audio {
 
 RecorderNode::RecorderNode(AppGlobals& globals)
-	: inherited(globals.getAppConfig().getRecordDurationInSamples())
-	, mWindowSize(globals.getAppConfig().getWindowDurationInSamples())
-	, mHopSize(globals.getAppConfig().getHopDurationInSamples())
-	, mLastQueried(0)
-{
-	mMaxPopsPossible = getNumFrames() / getHopSize();
-}
-
-ci::audio::BufferDynamic& RecorderNode::getBufferRaw()
-{
-	return mRecorderBuffer;
-}
-
-void RecorderNode::getBufferChunk(size_t start, size_t len, ci::audio::Buffer& other)
-{
-	other.copyOffset(getBufferRaw(), len, 0, start);
-}
-
-void RecorderNode::getBufferChunk(size_t start, ci::audio::Buffer& other)
-{
-	getBufferChunk(start, mWindowSize, other);
-}
-
-bool RecorderNode::popBufferWindow(size_t& query_pos)
-{
-	if (mLastQueried == getNumFrames())
-	{
-		return false;
-	}
-	else if (mLastQueried + mWindowSize <= getWritePosition())
-	{
-		query_pos = mLastQueried;
-		mLastQueried += mHopSize;
-		return true;
-	}
-	// This is the critical situation that can happen at the end of samples
-	// where there's not enough number of samples for the last buffer.
-	else if (getNumFrames() - mLastQueried < mWindowSize)
-	{
-		query_pos = mLastQueried;
-		mLastQueried = getNumFrames();
-		return true;
-	}
-	else
-	{
-		return false;
-	}
-}
-
-void RecorderNode::queryBufferWindow(ci::audio::Buffer& other, size_t query_pos)
-{
-	if (query_pos + mWindowSize <= getWritePosition())
-	{
-		getBufferChunk(query_pos, other);
-	}
-	// This is the critical situation that can happen at the end of samples
-	// where there's not enough number of samples for the last buffer.
-	else if (getNumFrames() - query_pos < mWindowSize)
-	{
-		getBufferChunk(query_pos, getNumFrames() - query_pos, other);
-	}
-}
+	: inherited(Format())
+	, mRecorder(globals.getAppConfig())
+{}
 
-size_t RecorderNode::getWindowSize() const
+void RecorderNode::initialize()
 {
-	return mWindowSize;
+	mRecorder.initialize(getNumChannels());
 }
 
-size_t RecorderNode::getHopSize() const
+void RecorderNode::uninitialize()
 {
-	return mHopSize;
+	mRecorder.uninitialize();
 }
 
-bool RecorderNode::isRecording() const
+void RecorderNode::process(ci::audio::Buffer* buffer)
 {
-	return getWritePosition() != getNumFrames();
+	mRecorder.write(buffer->getData(), buffer->getNumFrames(), buffer->getNumFrames());
 }
 
-size_t RecorderNode::getMaxPossiblePops() const
+Recorder& RecorderNode::getRecorder()
 {
-	return mMaxPopsPossible;
+	return mRecorder;
 }
 
-size_t RecorderNode::getQueryIndexByQueryPos(size_t pos)
+const Recorder& RecorderNode::getRecorder() const
 {
-	return pos / mHopSize;
+	return mRecorder;
 }
 
-void RecorderNode::reset()
+void RecorderNode::start()
 {
-	mLastQueried = 0;
+	enable();
 }
 
 }} //!cistft::node
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "ring_buffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace cistft {
+namespace audio {
+
+const float* RingBuffer::Window::getFirst(std::size_t channel) const
+{
+	return mRing->getChannel(channel) + mOffset;
+}
+
+const float* RingBuffer::Window::getSecond(std::size_t channel) const
+{
+	return mRing->getChannel(channel);
+}
+
+RingBuffer::RingBuffer(std::size_t min_capacity, std::size_t num_channels)
+	: mCapacity(1)
+	, mNumChannels(num_channels)
+	, mWritePosition(0)
+	, mLargestWrite(0)
+	, mOverruns(0)
+{
+	while (mCapacity < min_capacity) mCapacity <<= 1;
+
+	mMask = mCapacity - 1;
+	mData.resize(mCapacity * mNumChannels, 0.0f);
+}
+
+void RingBuffer::write(const float* data, std::size_t frames, std::size_t channel_stride)
+{
+	// only this thread writes the cursor, a relaxed load is enough
+	const auto _position = mWritePosition.load(std::memory_order_relaxed);
+
+	// more than a capacity at once? only the tail survives anyway
+	const auto _skipped = frames > mCapacity ? frames - mCapacity : 0;
+	const auto _frames = frames - _skipped;
+
+	// readers have to stay this far away from the cursor
+	if (_frames > mLargestWrite.load(std::memory_order_relaxed))
+		mLargestWrite.store(_frames, std::memory_order_relaxed);
+
+	const auto _offset = static_cast<std::size_t>((_position + _skipped) & mMask);
+	const auto _first = std::min(_frames, mCapacity - _offset);
+	const auto _second = _frames - _first;
+
+	for (std::size_t ch = 0; ch < mNumChannels; ++ch)
+	{
+		float* channel = mData.data() + ch * mCapacity;
+		const float* source = data + ch * channel_stride + _skipped;
+
+		std::memcpy(channel + _offset, source, _first * sizeof(float));
+		if (_second) std::memcpy(channel, source + _first, _second * sizeof(float));
+	}
+
+	// publish the samples
+	mWritePosition.store(_position + frames, std::memory_order_release);
+}
+
+std::uint64_t RingBuffer::getWritePosition() const
+{
+	return mWritePosition.load(std::memory_order_acquire);
+}
+
+bool RingBuffer::acquire(std::uint64_t pos, std::size_t len, Window& window) const
+{
+	const auto _written = getWritePosition();
+
+	// not written yet, or already lapped by the producer
+	if (pos >= _written || !isIntact(pos, _written))
+	{
+		if (pos < _written) ++mOverruns;
+		return false;
+	}
+
+	len = static_cast<std::size_t>(std::min<std::uint64_t>(len, _written - pos));
+
+	window.mRing = this;
+	window.mPosition = pos;
+	window.mOffset = static_cast<std::size_t>(pos & mMask);
+	window.mFirstSize = std::min(len, mCapacity - window.mOffset);
+	window.mSecondSize = len - window.mFirstSize;
+
+	return true;
+}
+
+bool RingBuffer::release(const Window& window) const
+{
+	// make sure all reads of the window happened before checking the cursor again
+	std::atomic_thread_fence(std::memory_order_acquire);
+
+	if (!isIntact(window.mPosition, mWritePosition.load(std::memory_order_acquire)))
+	{
+		++mOverruns;
+		return false;
+	}
+
+	return true;
+}
+
+bool RingBuffer::isIntact(std::uint64_t pos, std::uint64_t written) const
+{
+	// the producer may be in the middle of writing a block right after the cursor,
+	// which overwrites the oldest frames of the ring first.
+	return written + mLargestWrite.load(std::memory_order_relaxed) - pos <= mCapacity;
+}
+
+}} //!cistft::audio
\ No newline at end of file
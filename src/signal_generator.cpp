@@ -0,0 +1,227 @@
+#include "signal_generator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace cistft {
+namespace audio {
+
+namespace {
+static const double TWO_PI = 6.283185307179586;
+static const char* SIGNAL_NAMES[] = { "white", "pink", "linear_chirp", "log_chirp", "tone_comb", "impulses" };
+
+//! splitmix64, decorrelates neighbouring seeds
+static std::uint64_t _mix(std::uint64_t x)
+{
+	x += 0x9E3779B97F4A7C15ull;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+	return x ^ (x >> 31);
+}
+} //!namespace
+
+SignalGenerator::Format::Format()
+	: mSignal(SignalType::PinkNoise)
+	, mChannels(1)
+	, mSampleRate(44100)
+	, mSeed(1)
+	, mAmplitude(0.5f)
+	, mLowFrequency(100.0f)
+	, mHighFrequency(10000.0f)
+	, mPeriod(10.0f)
+	, mNumTones(8)
+{}
+
+SignalGenerator::Format& SignalGenerator::Format::signal(SignalType type)
+{
+	mSignal = type; return *this;
+}
+
+SignalGenerator::Format& SignalGenerator::Format::channels(std::size_t size)
+{
+	mChannels = size > 0 ? size : 1; return *this;
+}
+
+SignalGenerator::Format& SignalGenerator::Format::sampleRate(int rate)
+{
+	mSampleRate = rate > 0 ? rate : 1; return *this;
+}
+
+SignalGenerator::Format& SignalGenerator::Format::seed(std::uint64_t seed)
+{
+	mSeed = seed; return *this;
+}
+
+SignalGenerator::Format& SignalGenerator::Format::amplitude(float val)
+{
+	mAmplitude = val; return *this;
+}
+
+SignalGenerator::Format& SignalGenerator::Format::lowFrequency(float val)
+{
+	mLowFrequency = val > 0.0f ? val : 1.0f; return *this;
+}
+
+SignalGenerator::Format& SignalGenerator::Format::highFrequency(float val)
+{
+	mHighFrequency = val > 0.0f ? val : 1.0f; return *this;
+}
+
+SignalGenerator::Format& SignalGenerator::Format::period(float seconds)
+{
+	mPeriod = seconds; return *this;
+}
+
+SignalGenerator::Format& SignalGenerator::Format::numTones(std::size_t count)
+{
+	mNumTones = count > 0 ? count : 1; return *this;
+}
+
+SignalGenerator::SignalGenerator(const Format& fmt)
+	: mFormat(fmt)
+{
+	reset();
+}
+
+void SignalGenerator::reset()
+{
+	mPosition = 0;
+
+	mNoise.resize(mFormat.getChannelSize());
+	for (std::size_t ch = 0; ch < mNoise.size(); ++ch)
+	{
+		mNoise[ch].mState = _mix(mFormat.getSeed() ^ _mix(ch));
+		std::fill(mNoise[ch].mPink, mNoise[ch].mPink + 7, 0.0f);
+	}
+
+	mPhases.assign(mFormat.getSignal() == SignalType::ToneComb ? mFormat.getNumTones() : 1, 0.0);
+
+	const auto _period = static_cast<double>(mFormat.getPeriod()) * mFormat.getSampleRate();
+	mPeriodFrames = _period >= 1.0 ? static_cast<std::uint64_t>(_period) : 1;
+}
+
+float SignalGenerator::nextWhite(Noise& noise)
+{
+	// xorshift64*, top 24 bits to a uniform float in [-1, 1)
+	noise.mState ^= noise.mState >> 12;
+	noise.mState ^= noise.mState << 25;
+	noise.mState ^= noise.mState >> 27;
+	const auto _bits = (noise.mState * 0x2545F4914F6CDD1Dull) >> 40;
+	return static_cast<float>(_bits) * (2.0f / 16777216.0f) - 1.0f;
+}
+
+float SignalGenerator::nextPink(Noise& noise)
+{
+	// Paul Kellet's refined filter, -3 dB per octave within 0.05 dB above 9 Hz at 44.1 kHz
+	const float white = nextWhite(noise);
+	float* b = noise.mPink;
+	b[0] = 0.99886f * b[0] + white * 0.0555179f;
+	b[1] = 0.99332f * b[1] + white * 0.0750759f;
+	b[2] = 0.96900f * b[2] + white * 0.1538520f;
+	b[3] = 0.86650f * b[3] + white * 0.3104856f;
+	b[4] = 0.55000f * b[4] + white * 0.5329522f;
+	b[5] = -0.7616f * b[5] - white * 0.0168980f;
+	const float pink = b[0] + b[1] + b[2] + b[3] + b[4] + b[5] + b[6] + white * 0.5362f;
+	b[6] = white * 0.115926f;
+	// roughly back to the range of the white noise
+	return pink * 0.11f;
+}
+
+float SignalGenerator::nextTone()
+{
+	const double rate = mFormat.getSampleRate();
+	const double low = mFormat.getLowFrequency();
+	const double high = mFormat.getHighFrequency();
+	// where in the sweep we are, [0, 1)
+	const double progress = static_cast<double>(mPosition % mPeriodFrames) / mPeriodFrames;
+
+	switch (mFormat.getSignal())
+	{
+	case SignalType::LinearChirp:
+	case SignalType::LogChirp:
+	{
+		// the phase is accumulated, so the sweep restarts without a click
+		const double frequency = mFormat.getSignal() == SignalType::LinearChirp
+			? low + (high - low) * progress
+			: low * std::pow(high / low, progress);
+		const double sample = std::sin(TWO_PI * mPhases[0]);
+		mPhases[0] += frequency / rate;
+		mPhases[0] -= std::floor(mPhases[0]);
+		return static_cast<float>(sample);
+	}
+	case SignalType::ToneComb:
+	{
+		double sample = 0.0;
+		const auto num_tones = mPhases.size();
+		const double spacing = num_tones > 1 ? (high - low) / (num_tones - 1) : 0.0;
+		for (std::size_t t = 0; t < num_tones; ++t)
+		{
+			sample += std::sin(TWO_PI * mPhases[t]);
+			mPhases[t] += (low + spacing * t) / rate;
+			mPhases[t] -= std::floor(mPhases[t]);
+		}
+		return static_cast<float>(sample / num_tones);
+	}
+	case SignalType::ImpulseTrain:
+		return mPosition % mPeriodFrames == 0 ? 1.0f : 0.0f;
+	default:
+		return 0.0f;
+	}
+}
+
+void SignalGenerator::generate(float* out, std::size_t num_frames, std::size_t channel_stride, std::size_t frame_stride)
+{
+	const auto channels = mFormat.getChannelSize();
+	const auto amplitude = mFormat.getAmplitude();
+	const auto signal = mFormat.getSignal();
+
+	if (signal == SignalType::WhiteNoise || signal == SignalType::PinkNoise)
+	{
+		for (std::size_t ch = 0; ch < channels; ++ch)
+		{
+			float* channel = out + ch * channel_stride;
+			auto& noise = mNoise[ch];
+			for (std::size_t i = 0; i < num_frames; ++i)
+			{
+				channel[i * frame_stride] = amplitude * (signal == SignalType::WhiteNoise ? nextWhite(noise) : nextPink(noise));
+			}
+		}
+		mPosition += num_frames;
+		return;
+	}
+
+	for (std::size_t i = 0; i < num_frames; ++i, ++mPosition)
+	{
+		const float sample = amplitude * nextTone();
+		for (std::size_t ch = 0; ch < channels; ++ch)
+		{
+			out[ch * channel_stride + i * frame_stride] = sample;
+		}
+	}
+}
+
+void SignalGenerator::generateInterleaved(float* out, std::size_t num_frames)
+{
+	generate(out, num_frames, 1, mFormat.getChannelSize());
+}
+
+const char* SignalGenerator::getSignalName(SignalType type)
+{
+	const auto _index = static_cast<std::size_t>(type);
+	return _index < static_cast<std::size_t>(SignalType::Count) ? SIGNAL_NAMES[_index] : "unknown";
+}
+
+bool SignalGenerator::parseSignalName(const std::string& name, SignalType& type)
+{
+	for (std::size_t i = 0; i < static_cast<std::size_t>(SignalType::Count); ++i)
+	{
+		if (name == SIGNAL_NAMES[i])
+		{
+			type = static_cast<SignalType>(i);
+			return true;
+		}
+	}
+	return false;
+}
+
+}} //!cistft::audio
\ No newline at end of file
@@ -0,0 +1,569 @@
+#include "spectrum_kernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define CISTFT_KERNEL_X86 1
+#include <emmintrin.h>
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define CISTFT_TARGET_AVX2
+#else
+#define CISTFT_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace cistft {
+namespace dsp {
+
+namespace {
+
+//! 20 * log10(x) + 100 is the mapping of ci::audio::linearToDecibel,
+//! in power domain that is 10 * log10(x^2) + 100
+static const float DECIBEL_OFFSET = 100.0f;
+static const float DECIBEL_PER_LOG2 = 3.0102999566f; // 10 * log10(2)
+//! -100 dBFS in power domain, anything under this maps to 0 dB
+static const float MIN_POWER = 1e-10f;
+
+//! least squares fit of log2(1 + t) / t for t in [0, 1), error is about 1e-5 dB
+static const float LOG2_C0 = 1.44251696f;
+static const float LOG2_C1 = -0.71789728f;
+static const float LOG2_C2 = 0.45688866f;
+static const float LOG2_C3 = -0.27735293f;
+static const float LOG2_C4 = 0.12190201f;
+static const float LOG2_C5 = -0.02606180f;
+
+inline float powerToDecibel(float power)
+{
+	if (power < MIN_POWER) return 0.0f;
+
+	std::int32_t bits;
+	std::memcpy(&bits, &power, sizeof(bits));
+	const float exponent = static_cast<float>(((bits >> 23) & 0xff) - 127);
+	bits = (bits & 0x007fffff) | 0x3f800000;
+	float t;
+	std::memcpy(&t, &bits, sizeof(t));
+	t -= 1.0f;
+
+	const float log2 = exponent + t * (LOG2_C0 + t * (LOG2_C1 + t * (LOG2_C2 + t * (LOG2_C3 + t * (LOG2_C4 + t * LOG2_C5)))));
+	return log2 * DECIBEL_PER_LOG2 + DECIBEL_OFFSET;
+}
+
+/* SCALAR */
+
+void magnitudeSmoothScalar(const float* real, const float* imag, float* out, std::size_t size, float scale, float smoothing)
+{
+	const float blend = scale * (1.0f - smoothing);
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		out[i] = out[i] * smoothing + std::sqrt(real[i] * real[i] + imag[i] * imag[i]) * blend;
+	}
+}
+
+void powerSmoothDecibelScalar(const float* real, const float* imag, float* power, float* decibel, std::size_t size, float scale, float smoothing)
+{
+	const float blend = scale * scale * (1.0f - smoothing);
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		power[i] = power[i] * smoothing + (real[i] * real[i] + imag[i] * imag[i]) * blend;
+		decibel[i] = powerToDecibel(power[i]);
+	}
+}
+
+inline std::size_t tableIndex(float value, float scale, float offset, float last)
+{
+	float index = value * scale + offset;
+	if (!(index > 0.0f)) index = 0.0f; // catches NaN too
+	if (index > last) index = last;
+	return static_cast<std::size_t>(index);
+}
+
+void lookupTableScalar(const float* in, std::uint32_t* out, std::size_t size, float scale, float offset, const std::uint32_t* table, std::size_t table_size)
+{
+	const float last = static_cast<float>(table_size - 1);
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		out[i] = table[tableIndex(in[i], scale, offset, last)];
+	}
+}
+
+//! samples [begin, end) of downmixWindow, also finishes the tails of the wider kernels
+void downmixWindowTail(const float* const* channels, std::size_t num_channels, std::size_t begin, std::size_t end, const float* window, float scale, float* out)
+{
+	for (std::size_t i = begin; i < end; ++i)
+	{
+		float sum = channels[0][i];
+		for (std::size_t ch = 1; ch < num_channels; ++ch)
+		{
+			sum += channels[ch][i];
+		}
+		out[i] = window ? sum * scale * window[i] : sum * scale;
+	}
+}
+
+void downmixWindowScalar(const float* const* channels, std::size_t num_channels, std::size_t size, const float* window, float scale, float* out)
+{
+	downmixWindowTail(channels, num_channels, 0, size, window, scale, out);
+}
+
+//! folds samples [begin, end) into lo and hi, also finishes the tails of the wider kernels
+void minMaxTail(const float* in, std::size_t begin, std::size_t end, float& lo, float& hi)
+{
+	for (std::size_t i = begin; i < end; ++i)
+	{
+		if (in[i] < lo) lo = in[i];
+		if (in[i] > hi) hi = in[i];
+	}
+}
+
+void minMaxScalar(const float* in, std::size_t size, float& lo, float& hi)
+{
+	minMaxTail(in, 0, size, lo, hi);
+}
+
+#if defined(CISTFT_KERNEL_X86)
+
+/* SSE2 */
+
+void magnitudeSmoothSse2(const float* real, const float* imag, float* out, std::size_t size, float scale, float smoothing)
+{
+	const __m128 _smoothing = _mm_set1_ps(smoothing);
+	const __m128 _blend = _mm_set1_ps(scale * (1.0f - smoothing));
+
+	std::size_t i = 0;
+	for (; i + 4 <= size; i += 4)
+	{
+		const __m128 re = _mm_loadu_ps(real + i);
+		const __m128 im = _mm_loadu_ps(imag + i);
+		const __m128 mag = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im)));
+		const __m128 prev = _mm_loadu_ps(out + i);
+		_mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(prev, _smoothing), _mm_mul_ps(mag, _blend)));
+	}
+
+	magnitudeSmoothScalar(real + i, imag + i, out + i, size - i, scale, smoothing);
+}
+
+inline __m128 powerToDecibelSse2(__m128 power)
+{
+	const __m128i bits = _mm_castps_si128(power);
+	const __m128 exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_and_si128(_mm_srli_epi32(bits, 23), _mm_set1_epi32(0xff)), _mm_set1_epi32(127)));
+	const __m128 t = _mm_sub_ps(_mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f800000))), _mm_set1_ps(1.0f));
+
+	__m128 poly = _mm_set1_ps(LOG2_C5);
+	poly = _mm_add_ps(_mm_mul_ps(poly, t), _mm_set1_ps(LOG2_C4));
+	poly = _mm_add_ps(_mm_mul_ps(poly, t), _mm_set1_ps(LOG2_C3));
+	poly = _mm_add_ps(_mm_mul_ps(poly, t), _mm_set1_ps(LOG2_C2));
+	poly = _mm_add_ps(_mm_mul_ps(poly, t), _mm_set1_ps(LOG2_C1));
+	poly = _mm_add_ps(_mm_mul_ps(poly, t), _mm_set1_ps(LOG2_C0));
+
+	const __m128 log2 = _mm_add_ps(exponent, _mm_mul_ps(poly, t));
+	const __m128 db = _mm_add_ps(_mm_mul_ps(log2, _mm_set1_ps(DECIBEL_PER_LOG2)), _mm_set1_ps(DECIBEL_OFFSET));
+
+	// zero out everything below -100 dBFS
+	return _mm_and_ps(db, _mm_cmpge_ps(power, _mm_set1_ps(MIN_POWER)));
+}
+
+void powerSmoothDecibelSse2(const float* real, const float* imag, float* power, float* decibel, std::size_t size, float scale, float smoothing)
+{
+	const __m128 _smoothing = _mm_set1_ps(smoothing);
+	const __m128 _blend = _mm_set1_ps(scale * scale * (1.0f - smoothing));
+
+	std::size_t i = 0;
+	for (; i + 4 <= size; i += 4)
+	{
+		const __m128 re = _mm_loadu_ps(real + i);
+		const __m128 im = _mm_loadu_ps(imag + i);
+		const __m128 pow = _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im));
+		const __m128 smoothed = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(power + i), _smoothing), _mm_mul_ps(pow, _blend));
+		_mm_storeu_ps(power + i, smoothed);
+		_mm_storeu_ps(decibel + i, powerToDecibelSse2(smoothed));
+	}
+
+	powerSmoothDecibelScalar(real + i, imag + i, power + i, decibel + i, size - i, scale, smoothing);
+}
+
+void lookupTableSse2(const float* in, std::uint32_t* out, std::size_t size, float scale, float offset, const std::uint32_t* table, std::size_t table_size)
+{
+	const __m128 _scale = _mm_set1_ps(scale);
+	const __m128 _offset = _mm_set1_ps(offset);
+	const __m128 _last = _mm_set1_ps(static_cast<float>(table_size - 1));
+	const __m128 _zero = _mm_setzero_ps();
+
+	// SSE2 has no gather, indices are computed 4 wide and looked up one by one
+	std::size_t i = 0;
+	for (; i + 4 <= size; i += 4)
+	{
+		const __m128 index = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(in + i), _scale), _offset);
+		// max answers the second operand for NaN, so NaN maps to zero
+		const __m128i clamped = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(index, _zero), _last));
+
+		const __m128i colors = _mm_set_epi32(
+			table[_mm_cvtsi128_si32(_mm_shuffle_epi32(clamped, _MM_SHUFFLE(3, 3, 3, 3)))],
+			table[_mm_cvtsi128_si32(_mm_shuffle_epi32(clamped, _MM_SHUFFLE(2, 2, 2, 2)))],
+			table[_mm_cvtsi128_si32(_mm_shuffle_epi32(clamped, _MM_SHUFFLE(1, 1, 1, 1)))],
+			table[_mm_cvtsi128_si32(clamped)]);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), colors);
+	}
+
+	lookupTableScalar(in + i, out + i, size - i, scale, offset, table, table_size);
+}
+
+//! channels are summed a tile at a time, so every channel is read in runs
+//! of whole cache lines no matter how many there are
+void downmixWindowSse2(const float* const* channels, std::size_t num_channels, std::size_t size, const float* window, float scale, float* out)
+{
+	const __m128 _scale = _mm_set1_ps(scale);
+
+	std::size_t i = 0;
+	for (; i + 16 <= size; i += 16)
+	{
+		__m128 sum0 = _mm_loadu_ps(channels[0] + i);
+		__m128 sum1 = _mm_loadu_ps(channels[0] + i + 4);
+		__m128 sum2 = _mm_loadu_ps(channels[0] + i + 8);
+		__m128 sum3 = _mm_loadu_ps(channels[0] + i + 12);
+		for (std::size_t ch = 1; ch < num_channels; ++ch)
+		{
+			const float* in = channels[ch] + i;
+			sum0 = _mm_add_ps(sum0, _mm_loadu_ps(in));
+			sum1 = _mm_add_ps(sum1, _mm_loadu_ps(in + 4));
+			sum2 = _mm_add_ps(sum2, _mm_loadu_ps(in + 8));
+			sum3 = _mm_add_ps(sum3, _mm_loadu_ps(in + 12));
+		}
+
+		sum0 = _mm_mul_ps(sum0, _scale);
+		sum1 = _mm_mul_ps(sum1, _scale);
+		sum2 = _mm_mul_ps(sum2, _scale);
+		sum3 = _mm_mul_ps(sum3, _scale);
+		if (window)
+		{
+			sum0 = _mm_mul_ps(sum0, _mm_loadu_ps(window + i));
+			sum1 = _mm_mul_ps(sum1, _mm_loadu_ps(window + i + 4));
+			sum2 = _mm_mul_ps(sum2, _mm_loadu_ps(window + i + 8));
+			sum3 = _mm_mul_ps(sum3, _mm_loadu_ps(window + i + 12));
+		}
+		_mm_storeu_ps(out + i, sum0);
+		_mm_storeu_ps(out + i + 4, sum1);
+		_mm_storeu_ps(out + i + 8, sum2);
+		_mm_storeu_ps(out + i + 12, sum3);
+	}
+
+	if (i < size)
+	{
+		downmixWindowTail(channels, num_channels, i, size, window, scale, out);
+	}
+}
+
+void minMaxSse2(const float* in, std::size_t size, float& lo, float& hi)
+{
+	std::size_t i = 0;
+	if (size >= 8)
+	{
+		// two accumulators, the loop is bound by the min/max latency
+		__m128 lo0 = _mm_loadu_ps(in), hi0 = lo0;
+		__m128 lo1 = _mm_loadu_ps(in + 4), hi1 = lo1;
+		for (i = 8; i + 8 <= size; i += 8)
+		{
+			const __m128 v0 = _mm_loadu_ps(in + i);
+			const __m128 v1 = _mm_loadu_ps(in + i + 4);
+			lo0 = _mm_min_ps(lo0, v0);
+			hi0 = _mm_max_ps(hi0, v0);
+			lo1 = _mm_min_ps(lo1, v1);
+			hi1 = _mm_max_ps(hi1, v1);
+		}
+
+		float _lo[4], _hi[4];
+		_mm_storeu_ps(_lo, _mm_min_ps(lo0, lo1));
+		_mm_storeu_ps(_hi, _mm_max_ps(hi0, hi1));
+		for (int k = 0; k < 4; ++k)
+		{
+			if (_lo[k] < lo) lo = _lo[k];
+			if (_hi[k] > hi) hi = _hi[k];
+		}
+	}
+
+	minMaxTail(in, i, size, lo, hi);
+}
+
+/* AVX2 */
+
+CISTFT_TARGET_AVX2 void magnitudeSmoothAvx2(const float* real, const float* imag, float* out, std::size_t size, float scale, float smoothing)
+{
+	const __m256 _smoothing = _mm256_set1_ps(smoothing);
+	const __m256 _blend = _mm256_set1_ps(scale * (1.0f - smoothing));
+
+	std::size_t i = 0;
+	for (; i + 8 <= size; i += 8)
+	{
+		const __m256 re = _mm256_loadu_ps(real + i);
+		const __m256 im = _mm256_loadu_ps(imag + i);
+		const __m256 mag = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(re, re), _mm256_mul_ps(im, im)));
+		const __m256 prev = _mm256_loadu_ps(out + i);
+		_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_mul_ps(prev, _smoothing), _mm256_mul_ps(mag, _blend)));
+	}
+
+	magnitudeSmoothScalar(real + i, imag + i, out + i, size - i, scale, smoothing);
+}
+
+CISTFT_TARGET_AVX2 inline __m256 powerToDecibelAvx2(__m256 power)
+{
+	const __m256i bits = _mm256_castps_si256(power);
+	const __m256 exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_and_si256(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(0xff)), _mm256_set1_epi32(127)));
+	const __m256 t = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f800000))), _mm256_set1_ps(1.0f));
+
+	__m256 poly = _mm256_set1_ps(LOG2_C5);
+	poly = _mm256_add_ps(_mm256_mul_ps(poly, t), _mm256_set1_ps(LOG2_C4));
+	poly = _mm256_add_ps(_mm256_mul_ps(poly, t), _mm256_set1_ps(LOG2_C3));
+	poly = _mm256_add_ps(_mm256_mul_ps(poly, t), _mm256_set1_ps(LOG2_C2));
+	poly = _mm256_add_ps(_mm256_mul_ps(poly, t), _mm256_set1_ps(LOG2_C1));
+	poly = _mm256_add_ps(_mm256_mul_ps(poly, t), _mm256_set1_ps(LOG2_C0));
+
+	const __m256 log2 = _mm256_add_ps(exponent, _mm256_mul_ps(poly, t));
+	const __m256 db = _mm256_add_ps(_mm256_mul_ps(log2, _mm256_set1_ps(DECIBEL_PER_LOG2)), _mm256_set1_ps(DECIBEL_OFFSET));
+
+	// zero out everything below -100 dBFS
+	return _mm256_and_ps(db, _mm256_cmp_ps(power, _mm256_set1_ps(MIN_POWER), _CMP_GE_OQ));
+}
+
+CISTFT_TARGET_AVX2 void powerSmoothDecibelAvx2(const float* real, const float* imag, float* power, float* decibel, std::size_t size, float scale, float smoothing)
+{
+	const __m256 _smoothing = _mm256_set1_ps(smoothing);
+	const __m256 _blend = _mm256_set1_ps(scale * scale * (1.0f - smoothing));
+
+	std::size_t i = 0;
+	for (; i + 8 <= size; i += 8)
+	{
+		const __m256 re = _mm256_loadu_ps(real + i);
+		const __m256 im = _mm256_loadu_ps(imag + i);
+		const __m256 pow = _mm256_add_ps(_mm256_mul_ps(re, re), _mm256_mul_ps(im, im));
+		const __m256 smoothed = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(power + i), _smoothing), _mm256_mul_ps(pow, _blend));
+		_mm256_storeu_ps(power + i, smoothed);
+		_mm256_storeu_ps(decibel + i, powerToDecibelAvx2(smoothed));
+	}
+
+	powerSmoothDecibelScalar(real + i, imag + i, power + i, decibel + i, size - i, scale, smoothing);
+}
+
+CISTFT_TARGET_AVX2 void lookupTableAvx2(const float* in, std::uint32_t* out, std::size_t size, float scale, float offset, const std::uint32_t* table, std::size_t table_size)
+{
+	const __m256 _scale = _mm256_set1_ps(scale);
+	const __m256 _offset = _mm256_set1_ps(offset);
+	const __m256 _last = _mm256_set1_ps(static_cast<float>(table_size - 1));
+	const __m256 _zero = _mm256_setzero_ps();
+	const int* _table = reinterpret_cast<const int*>(table);
+
+	std::size_t i = 0;
+	for (; i + 8 <= size; i += 8)
+	{
+		const __m256 index = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(in + i), _scale), _offset);
+		// max answers the second operand for NaN, so NaN maps to zero
+		const __m256i clamped = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(index, _zero), _last));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_i32gather_epi32(_table, clamped, 4));
+	}
+
+	lookupTableScalar(in + i, out + i, size - i, scale, offset, table, table_size);
+}
+
+CISTFT_TARGET_AVX2 void downmixWindowAvx2(const float* const* channels, std::size_t num_channels, std::size_t size, const float* window, float scale, float* out)
+{
+	const __m256 _scale = _mm256_set1_ps(scale);
+
+	std::size_t i = 0;
+	for (; i + 32 <= size; i += 32)
+	{
+		__m256 sum0 = _mm256_loadu_ps(channels[0] + i);
+		__m256 sum1 = _mm256_loadu_ps(channels[0] + i + 8);
+		__m256 sum2 = _mm256_loadu_ps(channels[0] + i + 16);
+		__m256 sum3 = _mm256_loadu_ps(channels[0] + i + 24);
+		for (std::size_t ch = 1; ch < num_channels; ++ch)
+		{
+			const float* in = channels[ch] + i;
+			sum0 = _mm256_add_ps(sum0, _mm256_loadu_ps(in));
+			sum1 = _mm256_add_ps(sum1, _mm256_loadu_ps(in + 8));
+			sum2 = _mm256_add_ps(sum2, _mm256_loadu_ps(in + 16));
+			sum3 = _mm256_add_ps(sum3, _mm256_loadu_ps(in + 24));
+		}
+
+		sum0 = _mm256_mul_ps(sum0, _scale);
+		sum1 = _mm256_mul_ps(sum1, _scale);
+		sum2 = _mm256_mul_ps(sum2, _scale);
+		sum3 = _mm256_mul_ps(sum3, _scale);
+		if (window)
+		{
+			sum0 = _mm256_mul_ps(sum0, _mm256_loadu_ps(window + i));
+			sum1 = _mm256_mul_ps(sum1, _mm256_loadu_ps(window + i + 8));
+			sum2 = _mm256_mul_ps(sum2, _mm256_loadu_ps(window + i + 16));
+			sum3 = _mm256_mul_ps(sum3, _mm256_loadu_ps(window + i + 24));
+		}
+		_mm256_storeu_ps(out + i, sum0);
+		_mm256_storeu_ps(out + i + 8, sum1);
+		_mm256_storeu_ps(out + i + 16, sum2);
+		_mm256_storeu_ps(out + i + 24, sum3);
+	}
+
+	if (i < size)
+	{
+		downmixWindowTail(channels, num_channels, i, size, window, scale, out);
+	}
+}
+
+CISTFT_TARGET_AVX2 void minMaxAvx2(const float* in, std::size_t size, float& lo, float& hi)
+{
+	std::size_t i = 0;
+	if (size >= 16)
+	{
+		__m256 lo0 = _mm256_loadu_ps(in), hi0 = lo0;
+		__m256 lo1 = _mm256_loadu_ps(in + 8), hi1 = lo1;
+		for (i = 16; i + 16 <= size; i += 16)
+		{
+			const __m256 v0 = _mm256_loadu_ps(in + i);
+			const __m256 v1 = _mm256_loadu_ps(in + i + 8);
+			lo0 = _mm256_min_ps(lo0, v0);
+			hi0 = _mm256_max_ps(hi0, v0);
+			lo1 = _mm256_min_ps(lo1, v1);
+			hi1 = _mm256_max_ps(hi1, v1);
+		}
+
+		float _lo[8], _hi[8];
+		_mm256_storeu_ps(_lo, _mm256_min_ps(lo0, lo1));
+		_mm256_storeu_ps(_hi, _mm256_max_ps(hi0, hi1));
+		for (int k = 0; k < 8; ++k)
+		{
+			if (_lo[k] < lo) lo = _lo[k];
+			if (_hi[k] > hi) hi = _hi[k];
+		}
+	}
+
+	minMaxTail(in, i, size, lo, hi);
+}
+
+bool cpuSupportsAvx2()
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7) return false;
+
+	__cpuid(info, 1);
+	const bool osxsave = (info[2] & (1 << 27)) != 0;
+	const bool avx = (info[2] & (1 << 28)) != 0;
+	if (!osxsave || !avx) return false;
+
+	// make sure the OS saves YMM registers on context switches
+	if ((_xgetbv(0) & 0x6) != 0x6) return false;
+
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+#endif // CISTFT_KERNEL_X86
+
+/*!
+ * \struct KernelTable
+ * \brief picks the widest kernels the running CPU supports, once.
+ */
+struct KernelTable
+{
+	typedef void(*MagnitudeFn)(const float*, const float*, float*, std::size_t, float, float);
+	typedef void(*DecibelFn)(const float*, const float*, float*, float*, std::size_t, float, float);
+	typedef void(*LookupFn)(const float*, std::uint32_t*, std::size_t, float, float, const std::uint32_t*, std::size_t);
+	typedef void(*DownmixFn)(const float* const*, std::size_t, std::size_t, const float*, float, float*);
+	typedef void(*MinMaxFn)(const float*, std::size_t, float&, float&);
+
+	KernelTable()
+		: mMagnitude(&magnitudeSmoothScalar)
+		, mDecibel(&powerSmoothDecibelScalar)
+		, mLookup(&lookupTableScalar)
+		, mDownmix(&downmixWindowScalar)
+		, mMinMax(&minMaxScalar)
+		, mIsaName("scalar")
+	{
+#if defined(CISTFT_KERNEL_X86)
+		if (cpuSupportsAvx2())
+		{
+			mMagnitude = &magnitudeSmoothAvx2;
+			mDecibel = &powerSmoothDecibelAvx2;
+			mLookup = &lookupTableAvx2;
+			mDownmix = &downmixWindowAvx2;
+			mMinMax = &minMaxAvx2;
+			mIsaName = "avx2";
+		}
+		else
+		{
+			mMagnitude = &magnitudeSmoothSse2;
+			mDecibel = &powerSmoothDecibelSse2;
+			mLookup = &lookupTableSse2;
+			mDownmix = &downmixWindowSse2;
+			mMinMax = &minMaxSse2;
+			mIsaName = "sse2";
+		}
+#endif
+	}
+
+	MagnitudeFn		mMagnitude;
+	DecibelFn		mDecibel;
+	LookupFn		mLookup;
+	DownmixFn		mDownmix;
+	MinMaxFn		mMinMax;
+	const char*		mIsaName;
+};
+
+const KernelTable& kernels()
+{
+	static const KernelTable _table;
+	return _table;
+}
+
+} //!namespace
+
+void magnitudeSmooth(const float* real, const float* imag, float* out, std::size_t size, float scale, float smoothing)
+{
+	kernels().mMagnitude(real, imag, out, size, scale, smoothing);
+}
+
+void powerSmoothDecibel(const float* real, const float* imag, float* power, float* decibel, std::size_t size, float scale, float smoothing)
+{
+	kernels().mDecibel(real, imag, power, decibel, size, scale, smoothing);
+}
+
+void lookupTable(const float* in, std::uint32_t* out, std::size_t size, float scale, float offset, const std::uint32_t* table, std::size_t table_size)
+{
+	kernels().mLookup(in, out, size, scale, offset, table, table_size);
+}
+
+void downmixWindow(const float* const* channels, std::size_t num_channels, std::size_t size, const float* window, float scale, float* out)
+{
+	if (num_channels == 0 || size == 0) return;
+	kernels().mDownmix(channels, num_channels, size, window, scale, out);
+}
+
+void minMaxColumns(const float* in, std::size_t size, std::size_t columns, float* mins, float* maxs)
+{
+	if (size == 0) return;
+
+	const auto _min_max = kernels().mMinMax;
+	for (std::size_t column = 0; column < columns; ++column)
+	{
+		const std::size_t begin = std::min(column * size / columns, size - 1);
+		const std::size_t end = std::max((column + 1) * size / columns, begin + 1);
+
+		float lo = in[begin], hi = in[begin];
+		_min_max(in + begin + 1, end - begin - 1, lo, hi);
+		mins[column] = lo;
+		maxs[column] = hi;
+	}
+}
+
+const char* getKernelIsaName()
+{
+	return kernels().mIsaName;
+}
+
+}} //!cistft::dsp
\ No newline at end of file
@@ -1,15 +1,12 @@
 #include "stft_client.h"
-#include "app_globals.h"
-#include "audio_nodes.h"
-#include "recorder_node.h"
+#include "app_config.h"
+#include "recorder.h"
 #include "stft_request.h"
 #include "stft_client_storage.h"
-#include "stft_renderer.h"
-
-#include <cinder/audio/dsp/Fft.h>
-#include <cinder/audio/Buffer.h>
-#include <cinder/CinderMath.h>
+#include "spectrum_kernel.h"
+#include "palette_manager.h"
 
+#include <algorithm>
 #include <mutex>
 #include <thread>
 
@@ -32,14 +29,24 @@ static class ClientResourcesAllocator
 {
 public:
 	void allocate(	const Client::Format& fmt,
-					AppGlobals* globals,
+					const AppConfig& config,
 					ClientResources& local_rsc)
 	{
 		std::lock_guard<std::mutex> _lock(mResourceLock);
-		mPrivateMemory.push_back(std::make_unique<ClientStorage>(fmt, globals));
+		mPrivateMemory.push_back(std::make_unique<ClientStorage>(fmt, config));
 		local_rsc.mPrivateStorage = mPrivateMemory.back().get();
 	}
 
+	void collect(Client::Metrics& metrics)
+	{
+		std::lock_guard<std::mutex> _lock(mResourceLock);
+		for (const auto& storage : mPrivateMemory)
+		{
+			storage->mTransformTime.collect(metrics.mTransformTime);
+			storage->mColorizeTime.collect(metrics.mColorizeTime);
+		}
+	}
+
 private:
 	std::mutex	mResourceLock;
 	/* mind: blown. */
@@ -50,12 +57,73 @@ private:
 
 } //!namespace
 
-Client::Client(work::Manager& m, AppGlobals* g /*= nullptr*/, Format fmt /*= Format()*/)
+Client::Client(work::Manager& m, const AppConfig* config /*= nullptr*/, const audio::Recorder* recorder /*= nullptr*/, RowSink* sink /*= nullptr*/, Format fmt /*= Format()*/)
 	: work::Client(m)
 	, mFormat(fmt)
-	, mGlobals(g)
+	, mConfig(config)
+	, mRecorder(recorder)
+	, mSink(sink)
+	, mHopCost(0.0f)
+	, mQueuedTransforms(0)
+	, mDroppedHops(0)
+	, mLateHops(0)
+	, mDecimatedHops(0)
 {}
 
+work::RequestRef Client::makeRequest(std::uint64_t query_pos, std::size_t num_hops /*= 1*/, std::size_t stride /*= 1*/, std::uint64_t deadline /*= max*/)
+{
+	auto request = mRequestPool.acquire(query_pos, num_hops, stride, deadline);
+	mQueuedTransforms.fetch_add(static_cast<stft::Request*>(request.get())->getNumTransforms(), std::memory_order_relaxed);
+	return request;
+}
+
+std::size_t Client::getNumQueuedTransforms() const
+{
+	return mQueuedTransforms.load(std::memory_order_relaxed);
+}
+
+void Client::dropHops(std::size_t count)
+{
+	mDroppedHops.fetch_add(count, std::memory_order_relaxed);
+}
+
+std::uint64_t Client::getNumDroppedHops() const
+{
+	return mDroppedHops.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Client::getNumLateHops() const
+{
+	return mLateHops.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Client::getNumDecimatedHops() const
+{
+	return mDecimatedHops.load(std::memory_order_relaxed);
+}
+
+namespace {
+//! weight of the newest measurement in the hop cost average
+static float HOP_COST_SMOOTHING = 0.05f;
+} //!namespace
+
+float Client::getHopCost() const
+{
+	return mHopCost.load(std::memory_order_relaxed);
+}
+
+void Client::snapshot(Metrics& metrics) const
+{
+	metrics.mTransformTime.clear();
+	metrics.mColorizeTime.clear();
+	_resources_allocator.collect(metrics);
+
+	metrics.mQueuedTransforms = getNumQueuedTransforms();
+	metrics.mDroppedHops = getNumDroppedHops();
+	metrics.mLateHops = getNumLateHops();
+	metrics.mDecimatedHops = getNumDecimatedHops();
+}
+
 void Client::handle(work::RequestRef req)
 {
 	// Allocate once per thread.
@@ -63,123 +131,117 @@ void Client::handle(work::RequestRef req)
 	if (!_ready)
 	{
 		// pass thread's local storage to the allocator function
-		_resources_allocator.allocate( mFormat, mGlobals, _resources );
+		_resources_allocator.allocate( mFormat, *mConfig, _resources );
 		_ready = true;
 	}
 
+	//! Measure how long hops take, auto concurrency is derived from it
+	const auto started = work::getTimestamp();
+
 	//! Receive the pointer from main thread that contains the audio data position to be processed
 	auto request_ptr	= static_cast<stft::Request*>(req.get());
 	//! Acquire the recorder pointer
-	auto recorder_ptr	= mGlobals->getAudioNodes().getBufferRecorderNode();
-	//! Acquire the renderer pointer
-	auto& renderer_ref	= mGlobals->getThreadRenderer();
-
-	//! Ask the recorder to return back number of samples with size of its window size
-	recorder_ptr->queryBufferWindow(_resources.mPrivateStorage->mCopiedBuffer, request_ptr->getQueryPos());
-	
-	//! window the copied buffer and compute forward FFT transform
-	//! For each channel, if more than one channel...
-	if (_resources.mPrivateStorage->mChannelSize > 1)
-	{
-		// Make sure FFT buffer is all zeros
-		_resources.mPrivateStorage->mFftBuffer.zero();
-		// Naive average of all channels
-		for (size_t ch = 0; ch < _resources.mPrivateStorage->mChannelSize; ch++)
-		{
-			for (size_t i = 0; i < _resources.mPrivateStorage->mWindowSize; i++)
-			{
-				_resources.mPrivateStorage->mFftBuffer[i] += _resources.mPrivateStorage->mCopiedBuffer.getChannel(ch)[i] * _resources.mPrivateStorage->mChannelScale;
-			}
-		}
+	auto recorder_ptr	= mRecorder;
 
-		ci::audio::dsp::mul(	_resources.mPrivateStorage->mFftBuffer.getData(),
-								_resources.mPrivateStorage->mWindowingTable.get(),
-								_resources.mPrivateStorage->mFftBuffer.getData(),
-								_resources.mPrivateStorage->mWindowSize);
-	}
-	else //! If one channel then...
+	//! held until the request is done, the recorder may drop the ring meanwhile
+	const auto ring_ref	= recorder_ptr->getRingBuffer();
+
+	//! the recorder was shut down while the request was queued, nothing left to read
+	if (!ring_ref)
 	{
-		_resources.mPrivateStorage->mFftBuffer.zero();
-		ci::audio::dsp::mul(	_resources.mPrivateStorage->mCopiedBuffer.getData(),
-								_resources.mPrivateStorage->mWindowingTable.get(),
-								_resources.mPrivateStorage->mFftBuffer.getData(),
-								_resources.mPrivateStorage->mWindowSize);
+		mDroppedHops.fetch_add(request_ptr->getNumHops(), std::memory_order_relaxed);
+		mQueuedTransforms.fetch_sub(request_ptr->getNumTransforms(), std::memory_order_relaxed);
+		return;
 	}
 
-	_resources.mPrivateStorage->mFft->forward(&_resources.mPrivateStorage->mFftBuffer, &_resources.mPrivateStorage->mBufferSpectral);
+	const auto hop_size = recorder_ptr->getHopSize();
+	const auto stride = request_ptr->getStride();
 
-	float *real = _resources.mPrivateStorage->mBufferSpectral.getReal();
-	float *imag = _resources.mPrivateStorage->mBufferSpectral.getImag();
+	std::size_t num_transforms = 0;
+	bool has_row = false;
 
-	//! remove Nyquist component
-	//! We don't exactly know what this is but it makes sense because at 0Hz, we're technically a flat line
-	//! and therefore it does not make sense to have a phase shift. a non zero phase shift will produce wrong
-	//! results for sqrt(re^2 + im^2)
-	imag[0] = 0.0f;
-
-	// compute normalized magnitude spectrum
-	for (size_t i = 0; i < _resources.mPrivateStorage->mMagSpectrum.size(); i++)
+	for (std::size_t hop = 0; hop < request_ptr->getNumHops(); ++hop)
 	{
-		const float& re = real[i];
-		const float& im = imag[i];
-
-		// apply a smooth transition from last value to new value
-		_resources.mPrivateStorage->mMagSpectrum[i] =
-			_resources.mPrivateStorage->mMagSpectrum[i] *
-			_resources.mPrivateStorage->mSmoothingFactor +
-			ci::math<float>::sqrt(re * re + im * im) *
-			_resources.mPrivateStorage->mMagnitudeScale * (1 - _resources.mPrivateStorage->mSmoothingFactor);
-
-		// no smoothing
-		//_resources.mPrivateStorage->mMagSpectrum[i] = ci::math<float>::sqrt(re * re + im * im) * magScale;
-	}
+		const auto pos = request_ptr->getQueryPos() + hop * hop_size;
+		const auto deadline = request_ptr->getHopDeadline(hop, hop_size);
 
-	const auto pos = request_ptr->getQueryPos();
-	const auto surface_index = renderer_ref.getSurfaceIndexByQueryPos(pos);
-	const auto index_in_surface = renderer_ref.getIndexInSurfaceByQueryPos(pos);
+		//! the row scrolled off while the request was queued, nobody will see it
+		if (ring_ref->getWritePosition() >= deadline)
+		{
+			mDroppedHops.fetch_add(1, std::memory_order_relaxed);
+			continue;
+		}
 
-	renderer_ref.getSurface(surface_index, pos).fillRow(index_in_surface, _resources.mPrivateStorage->mMagSpectrum);
-}
+		auto& storage = *_resources.mPrivateStorage;
+		bool is_late = false;
 
-Client::Format& Client::Format::windowSize(std::size_t size)
-{
-	mWindowSize = size; return *this;
-}
+		//! decimated hops repeat the last transformed row of this request
+		if (!has_row || hop % stride == 0)
+		{
+			//! one table per hop, the palette may be swapped by the GUI at any time
+			const palette::Manager::TableGuard table;
+			const auto transform_start = work::getTimestamp();
 
-Client::Format& Client::Format::fftSize(std::size_t size)
-{
-	mFftSize = size; return *this;
-}
+			if (!processHop(storage, *ring_ref, pos, table->isDecibel()))
+			{
+				//! samples are gone, leave the row black
+				std::fill(storage.mMagSpectrum.begin(), storage.mMagSpectrum.end(), 0.0f);
+				is_late = true;
+			}
 
-std::size_t Client::Format::getWindowSize() const
-{
-	return mWindowSize;
-}
+			const auto colorize_start = work::getTimestamp();
+			table->colorize(storage.mMagSpectrum.data(), storage.mColorRow.data(), storage.mColorRow.size());
 
-std::size_t Client::Format::getFftSize() const
-{
-	return mFftSize;
-}
+			storage.mTransformTime.record(colorize_start - transform_start);
+			storage.mColorizeTime.record(work::getTimestamp() - colorize_start);
+			has_row = true;
+			++num_transforms;
+		}
+		else
+		{
+			mDecimatedHops.fetch_add(1, std::memory_order_relaxed);
+		}
 
-Client::Format& Client::Format::channels(std::size_t size)
-{
-	mChannels = size;
-	return *this;
-}
+		mSink->commitRow(recorder_ptr->getQueryIndexByQueryPos(pos), storage.mColorRow);
 
-std::size_t Client::Format::getChannelSize() const
-{
-	return mChannels;
-}
+		//! committed, but the samples were lost or the renderer skipped past it already
+		if (is_late || ring_ref->getWritePosition() >= deadline)
+		{
+			mLateHops.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
 
-Client::Format& Client::Format::windowType(ci::audio::dsp::WindowType type)
-{
-	mWindowType = type; return *this;
+	mQueuedTransforms.fetch_sub(request_ptr->getNumTransforms(), std::memory_order_relaxed);
+
+	//! racy on purpose, a lost update only delays the average a little
+	if (num_transforms > 0)
+	{
+		const auto _cost = static_cast<float>((work::getTimestamp() - started) * 1e-9) / num_transforms;
+		const auto _average = mHopCost.load(std::memory_order_relaxed);
+		mHopCost.store(_average > 0.0f ? _average + (_cost - _average) * HOP_COST_SMOOTHING : _cost, std::memory_order_relaxed);
+	}
 }
 
-ci::audio::dsp::WindowType Client::Format::getWindowType() const
+bool Client::processHop(ClientStorage& storage, const audio::RingBuffer& ring, std::uint64_t pos, bool is_decibel)
 {
-	return mWindowType;
+	//! Ask the ring for a window size view, no copies
+	audio::RingBuffer::Window window;
+	if (!ring.acquire(pos, mRecorder->getWindowSize(), window)) return false;
+
+	//! window the recorded samples straight out of the ring
+	for (std::size_t ch = 0; ch < storage.mChannelSize; ++ch)
+	{
+		storage.mFirstSpans[ch] = window.getFirst(ch);
+		storage.mSecondSpans[ch] = window.getSecond(ch);
+	}
+	windowHop(storage, window.getFirstSize(), window.getSecondSize());
+
+	//! the audio thread lapped us while we were reading
+	if (!ring.release(window)) return false;
+
+	//! compute forward transform and the visible spectrum
+	transformHop(storage, is_decibel);
+	return true;
 }
 
 }
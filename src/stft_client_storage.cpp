@@ -1,44 +1,317 @@
 #include "stft_client_storage.h"
-#include "app_globals.h"
 #include "app_config.h"
+#include "spectrum_kernel.h"
 
-#include <cinder/CinderMath.h>
+#include <algorithm>
+#include <cstring>
 
 namespace cistft {
 namespace stft {
 
-ClientStorage::ClientStorage(const Client::Format& fmt, AppGlobals* const globals)
+ClientStorage::ClientStorage(const Client::Format& fmt, const AppConfig& config)
 	: mFftSize(fmt.getFftSize())
-	, mWindowType(fmt.getWindowType())
-	, mWindowSize(fmt.getWindowSize())
 	, mChannelSize(fmt.getChannelSize())
+	, mWindowSize(fmt.getWindowSize())
+	, mWindowType(fmt.getWindowType())
 	, mSmoothingFactor(0.5f)
 {
 	// This makes sure that we are zero padding
-	mFftSize = globals->getAppConfig().getCalculatedFftSize();
+	mFftSize = config.getCalculatedFftSize();
+
+	// Only the bins between high pass and low pass frequencies are ever shown
+	mBinStart = config.getMagnitudeIndexStart();
+	mBinCount = config.getActualViewableBins();
 
-	// The actual FFT processor instance
-	mFft = std::make_unique<ci::audio::dsp::Fft>(mFftSize);
+	// Low pass far below Nyquist, transform every n-th sample of a filtered window
+	mAnalysisSize = mWindowSize;
+	if (fmt.getDecimation() > 1)
+	{
+		mDecimator = std::make_unique<dsp::PolyphaseDecimator>(fmt.getDecimation());
+		mAnalysisSize = mWindowSize / fmt.getDecimation();
+		mDecimatorInput.resize(mAnalysisSize * fmt.getDecimation() + 2 * mDecimator->getPadding(), 0.0f);
+	}
 
-	// The FFT buffer, the one that will be filled AFTER FFT is performed on data
-	mFftBuffer = ci::audio::Buffer(mFftSize, mChannelSize);
+	// Narrow bands are cheaper to evaluate bin by bin than through a full transform
+	if (dsp::GoertzelBank::isCheaperThanFft(mBinCount, mAnalysisSize, mFftSize))
+	{
+		mGoertzelBank = std::make_unique<dsp::GoertzelBank>(mFftSize, mBinStart, mBinCount);
+		mBandReal.resize(mBinCount);
+		mBandImag.resize(mBinCount);
+		mBandInput.resize(mAnalysisSize);
 
-	// Copied buffer. the one that will be filled by raw audio chunks BEFORE FFT
-	mCopiedBuffer = ci::audio::Buffer(mFftSize, mChannelSize);
+		// The Goertzel input, the one that will be filled with windowed samples. No padding needed.
+		mTransformInput = mBandInput.data();
+		mTransformInputSize = mAnalysisSize;
+	}
+	else
+	{
+		// The actual FFT processor instance, engine picked by the user
+		mFft = fft::make_backend(config.getFftBackend(), mFftSize);
 
-	// Intermediate buffer passed to FFT processor
-	mBufferSpectral = ci::audio::BufferSpectral(mFftSize);
+		// The FFT buffer, the one that will be filled with windowed and zero padded samples
+		mTransformInput = mFft->getInput();
+		mTransformInputSize = mFftSize;
+	}
 
-	// The floating point array that contains all the FFT data, will be passed to renderer
-	mMagSpectrum.resize(mFftSize / 2);
+	// The floating point array that contains the visible FFT data, will be passed to renderer
+	mMagSpectrum.resize(mBinCount);
+	mPowSpectrum.resize(mBinCount);
+	mColorRow.resize(mBinCount);
 
-	// Window table.
-	mWindowingTable = ci::audio::makeAlignedArray<float>(mWindowSize);
-	generateWindow(mWindowType, mWindowingTable.get(), mWindowSize);
+	// Channel views of the hop being windowed
+	mFirstSpans.resize(mChannelSize, nullptr);
+	mSecondSpans.resize(mChannelSize, nullptr);
+
+	// Window table, spans the decimated window
+	mWindowingTable.resize(mAnalysisSize);
+	dsp::generateWindow(mWindowType, mWindowingTable.data(), mAnalysisSize);
 
 	// MISC.
-	mMagnitudeScale = 1.0f / mFft->getSize();
+	mMagnitudeScale = 1.0f / mFftSize;
 	mChannelScale	= 1.0f / mChannelSize;
 }
 
+namespace {
+//! filters and decimates the downmixed window in mDecimatorInput into the transform input
+static void _decimate_window(ClientStorage& storage)
+{
+	float* input = storage.mTransformInput;
+
+	storage.mDecimator->process(storage.mDecimatorInput.data(), input, storage.mAnalysisSize, storage.mWindowingTable.data());
+	std::fill(input + storage.mAnalysisSize, input + storage.mTransformInputSize, 0.0f);
+}
+} //!namespace
+
+void windowHop(ClientStorage& storage, std::size_t first_size, std::size_t second_size)
+{
+	const float scale = storage.mChannelSize > 1 ? storage.mChannelScale : 1.0f;
+
+	if (storage.mDecimator)
+	{
+		// average the channels between the paddings, the filter windows on the way out
+		float* mixed = storage.mDecimatorInput.data() + storage.mDecimator->getPadding();
+		const std::size_t count = storage.mAnalysisSize * storage.mDecimator->getFactor();
+		const std::size_t first_count = std::min(first_size, count);
+		const std::size_t second_count = std::min(second_size, count - first_count);
+
+		dsp::downmixWindow(storage.mFirstSpans.data(), storage.mChannelSize, first_count, nullptr, scale, mixed);
+		dsp::downmixWindow(storage.mSecondSpans.data(), storage.mChannelSize, second_count, nullptr, scale, mixed + first_count);
+		std::fill(mixed + first_count + second_count, mixed + count, 0.0f);
+
+		_decimate_window(storage);
+		return;
+	}
+
+	float* input = storage.mTransformInput;
+	const float* table = storage.mWindowingTable.data();
+
+	//! average, window and write every sample once, both sides of the ring wrap
+	dsp::downmixWindow(storage.mFirstSpans.data(), storage.mChannelSize, first_size, table, scale, input);
+	dsp::downmixWindow(storage.mSecondSpans.data(), storage.mChannelSize, second_size, table + first_size, scale, input + first_size);
+
+	// zero padding
+	std::fill(input + first_size + second_size, input + storage.mTransformInputSize, 0.0f);
+}
+
+namespace {
+//! WAV samples are little endian, as is every machine this runs on. Plain loads.
+struct DecodeUnsigned8 { static float get(const unsigned char* p) { return (static_cast<int>(p[0]) - 128) * (1.0f / 128.0f); } };
+struct DecodeInt16 { static float get(const unsigned char* p) { std::int16_t v; std::memcpy(&v, p, 2); return v * (1.0f / 32768.0f); } };
+struct DecodeInt24 { static float get(const unsigned char* p) { return static_cast<std::int32_t>((p[0] << 8) | (p[1] << 16) | (static_cast<std::uint32_t>(p[2]) << 24)) * (1.0f / 2147483648.0f); } };
+struct DecodeInt32 { static float get(const unsigned char* p) { std::int32_t v; std::memcpy(&v, p, 4); return v * (1.0f / 2147483648.0f); } };
+struct DecodeFloat32 { static float get(const unsigned char* p) { float v; std::memcpy(&v, p, 4); return v; } };
+struct DecodeFloat64 { static float get(const unsigned char* p) { double v; std::memcpy(&v, p, 8); return static_cast<float>(v); } };
+
+template<typename Decode, std::size_t SampleBytes>
+static void _window_interleaved(ClientStorage& storage, const unsigned char* frames)
+{
+	float* input = storage.mTransformInput;
+	const float* table = storage.mWindowingTable.data();
+	const std::size_t channels = storage.mChannelSize;
+	const std::size_t window_size = storage.mWindowSize;
+
+	// Make sure FFT buffer is all zeros past the window
+	std::fill(input + window_size, input + storage.mTransformInputSize, 0.0f);
+
+	if (channels > 1)
+	{
+		const float scale = storage.mChannelScale;
+		for (std::size_t i = 0; i < window_size; ++i)
+		{
+			// Naive average of all channels
+			float sum = 0.0f;
+			for (std::size_t ch = 0; ch < channels; ++ch, frames += SampleBytes)
+			{
+				sum += Decode::get(frames);
+			}
+			input[i] = sum * scale * table[i];
+		}
+	}
+	else
+	{
+		for (std::size_t i = 0; i < window_size; ++i, frames += SampleBytes)
+		{
+			input[i] = Decode::get(frames) * table[i];
+		}
+	}
+}
+
+//! same as _window_interleaved, leaves the average between the decimator paddings and decimates it
+template<typename Decode, std::size_t SampleBytes>
+static void _decimate_interleaved(ClientStorage& storage, const unsigned char* frames)
+{
+	float* mixed = storage.mDecimatorInput.data() + storage.mDecimator->getPadding();
+	const std::size_t channels = storage.mChannelSize;
+	const std::size_t count = storage.mAnalysisSize * storage.mDecimator->getFactor();
+	const float scale = channels > 1 ? storage.mChannelScale : 1.0f;
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		float sum = 0.0f;
+		for (std::size_t ch = 0; ch < channels; ++ch, frames += SampleBytes)
+		{
+			sum += Decode::get(frames);
+		}
+		mixed[i] = sum * scale;
+	}
+
+	_decimate_window(storage);
+}
+
+template<typename Decode, std::size_t SampleBytes>
+static void _window_or_decimate(ClientStorage& storage, const unsigned char* frames)
+{
+	if (storage.mDecimator) _decimate_interleaved<Decode, SampleBytes>(storage, frames);
+	else _window_interleaved<Decode, SampleBytes>(storage, frames);
+}
+} //!namespace
+
+void windowInterleavedHop(ClientStorage& storage, const unsigned char* frames, audio::SampleEncoding encoding)
+{
+	// one loop per encoding, the decode is inlined into it
+	switch (encoding)
+	{
+	case audio::SampleEncoding::Unsigned8: _window_or_decimate<DecodeUnsigned8, 1>(storage, frames); break;
+	case audio::SampleEncoding::Int16: _window_or_decimate<DecodeInt16, 2>(storage, frames); break;
+	case audio::SampleEncoding::Int24: _window_or_decimate<DecodeInt24, 3>(storage, frames); break;
+	case audio::SampleEncoding::Int32: _window_or_decimate<DecodeInt32, 4>(storage, frames); break;
+	case audio::SampleEncoding::Float32: _window_or_decimate<DecodeFloat32, 4>(storage, frames); break;
+	case audio::SampleEncoding::Float64: _window_or_decimate<DecodeFloat64, 8>(storage, frames); break;
+	}
+}
+
+void transformHop(ClientStorage& storage, bool is_decibel)
+{
+	float *real = nullptr;
+	float *imag = nullptr;
+
+	if (storage.mGoertzelBank)
+	{
+		//! narrow band, evaluate the visible bins only. Zero padding does not change the result.
+		storage.mGoertzelBank->process(	storage.mTransformInput,
+										storage.mAnalysisSize,
+										storage.mBandReal.data(),
+										storage.mBandImag.data());
+
+		real = storage.mBandReal.data();
+		imag = storage.mBandImag.data();
+	}
+	else
+	{
+		//! backends never report the Nyquist bin, imag[0] is always zero
+		storage.mFft->forward();
+
+		//! skip everything below the high pass frequency
+		real = storage.mFft->getReal() + storage.mBinStart;
+		imag = storage.mFft->getImag() + storage.mBinStart;
+	}
+
+	//! compute normalized magnitude spectrum, smoothed from last value to new value.
+	//! in dB mode the log-domain kernel is used so the palette does not take a log per pixel.
+	if (is_decibel)
+	{
+		dsp::powerSmoothDecibel(real, imag,
+								storage.mPowSpectrum.data(),
+								storage.mMagSpectrum.data(),
+								storage.mMagSpectrum.size(),
+								storage.mMagnitudeScale,
+								storage.mSmoothingFactor);
+	}
+	else
+	{
+		dsp::magnitudeSmooth(	real, imag,
+								storage.mMagSpectrum.data(),
+								storage.mMagSpectrum.size(),
+								storage.mMagnitudeScale,
+								storage.mSmoothingFactor);
+	}
+}
+
+void resetSmoothing(ClientStorage& storage)
+{
+	std::fill(storage.mMagSpectrum.begin(), storage.mMagSpectrum.end(), 0.0f);
+	std::fill(storage.mPowSpectrum.begin(), storage.mPowSpectrum.end(), 0.0f);
+}
+
+// Format is shared with the headless analyzer, keep it out of the Cinder bound client
+
+Client::Format::Format()
+	: mWindowSize(0)
+	, mFftSize(0)
+	, mChannels(1)
+	, mWindowType(dsp::WindowType::Blackman)
+	, mDecimation(1)
+{}
+
+Client::Format& Client::Format::windowSize(std::size_t size)
+{
+	mWindowSize = size; return *this;
+}
+
+Client::Format& Client::Format::fftSize(std::size_t size)
+{
+	mFftSize = size; return *this;
+}
+
+std::size_t Client::Format::getWindowSize() const
+{
+	return mWindowSize;
+}
+
+std::size_t Client::Format::getFftSize() const
+{
+	return mFftSize;
+}
+
+Client::Format& Client::Format::channels(std::size_t size)
+{
+	mChannels = size;
+	return *this;
+}
+
+std::size_t Client::Format::getChannelSize() const
+{
+	return mChannels;
+}
+
+Client::Format& Client::Format::windowType(dsp::WindowType type)
+{
+	mWindowType = type; return *this;
+}
+
+dsp::WindowType Client::Format::getWindowType() const
+{
+	return mWindowType;
+}
+
+Client::Format& Client::Format::decimation(std::size_t factor)
+{
+	mDecimation = factor > 0 ? factor : 1; return *this;
+}
+
+std::size_t Client::Format::getDecimation() const
+{
+	return mDecimation;
+}
+
 }} //!cistft::stft
\ No newline at end of file
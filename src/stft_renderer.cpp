@@ -2,20 +2,32 @@
 #include "app_globals.h"
 #include "audio_nodes.h"
 #include "recorder_node.h"
-#include "scoped_fbo.h"
 #include "app_config.h"
 
 #include <cinder/app/App.h>
 
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
 namespace cistft {
 
 StftRenderer::StftRenderer(AppGlobals& globals)
 	: mGlobals(globals)
 	, mFramesPerSurface(0)
 	, mViewableBins(0)
-	, mLastPopPos(0)
-	, mLastSurfaceLength(0)
-	, mTotalSurfacesLength(0)
+	, mNumSurfaces(0)
+	, mHistoryLength(0)
+	, mNextUploadIndex(0)
+	, mNumUpdatedRows(0)
+	, mUpdateTime(0)
+	, mNumFrames(0)
+	, mUploadedRows(0)
+	, mUploadCalls(0)
+	, mUploadedBytes(0)
+{}
+
+StftRenderer::~StftRenderer()
 {}
 
 void StftRenderer::setup()
@@ -25,201 +37,299 @@ void StftRenderer::setup()
 	mFramesPerSurface = mGlobals.getAppConfig().getSamplesCacheSize();
 	mViewableBins = mGlobals.getAppConfig().getActualViewableBins();
 
-	mNumSurfaces = mGlobals.getAudioNodes().getBufferRecorderNode()->getMaxPossiblePops() / mFramesPerSurface;
-	if (mGlobals.getAudioNodes().getBufferRecorderNode()->getMaxPossiblePops() % mFramesPerSurface != 0)
-		mNumSurfaces += 1;
-
-	const auto _time_span_percentage = mGlobals.getAppConfig().getTimeRange() / mGlobals.getAppConfig().getRecordDuration();
-	mNumSurfaces = static_cast<std::size_t>(_time_span_percentage * mNumSurfaces);
+	mHistoryLength = calculateHistoryLength();
 
-	mSurfaceTexturePool.resize(2 * mNumSurfaces);
+	mNumSurfaces = mHistoryLength / mFramesPerSurface;
+	if (mHistoryLength % mFramesPerSurface != 0)
+		mNumSurfaces += 1;
 
-	mLastSurfaceLength = calculateLastSurfaceLength();
-	mTotalSurfacesLength = calculateTotalSurfacesLength();
+	// two screens worth of staging, workers may run ahead of the uploads
+	mSurfacePool.reset(new std::atomic<std::uint32_t>[2 * mNumSurfaces]);
+	for (std::size_t index = 0; index < 2 * mNumSurfaces; ++index)
+	{
+		mSurfacePool[index] = 0;
+	}
 
-	// I hate APIs with booleans in them :(
-	for (std::size_t index = 0; index < mFrameBuffers.size(); ++index)
+	// one surface per slot, plus one per worker: a worker racing another for
+	// an empty slot holds a surface until it loses and gives it back
+	const auto _num_pooled = 2 * mNumSurfaces + mGlobals.getWorkManager().getNumThreads();
+	mSurfaceStorage.clear();
+	mSurfaceStorage.reserve(_num_pooled);
+	for (std::size_t index = 0; index < _num_pooled; ++index)
 	{
-		mFrameBuffers[index] = ci::gl::Fbo(
-			mViewableBins, //width
-			mTotalSurfacesLength, //height
-			false, // alpha
-			true, // color
-			false); //depth
-
-		mFrameBuffers[index].getTexture().setMinFilter(GL_NEAREST); //disable GPU blur
-		mFrameBuffers[index].getTexture().setMagFilter(GL_NEAREST); //disable GPU blur
+		mSurfaceStorage.emplace_back(new StftSurface(mViewableBins, getFramesPerSurface()));
 	}
+	mFreeSurfaces.reset(static_cast<std::uint32_t>(_num_pooled));
+
+	// one texel row per hop, wraps around vertically
+	auto _format = ci::gl::Texture::Format();
+	_format.setInternalFormat(GL_RGBA8);
+	_format.setWrapT(GL_REPEAT);
+	_format.setMinFilter(GL_NEAREST); //disable GPU blur
+	_format.setMagFilter(GL_NEAREST); //disable GPU blur
+
+	ci::Surface8u _black(mViewableBins, mHistoryLength, true, ci::SurfaceChannelOrder::RGBA);
+	std::memset(_black.getData(), 0, _black.getRowBytes() * _black.getHeight());
+	mRingTexture = ci::gl::Texture::create(_black, _format);
+
+	mUploadBuffer = ci::gl::Vbo(GL_PIXEL_UNPACK_BUFFER);
 }
 
 void StftRenderer::update()
 {
 	if (!mGlobals.getAudioNodes().isRecorderReady()) return;
 
-	for (container_pair& pair : mSurfaceTexturePool)
-	{
-		if (pair.first && pair.first->allRowsTouched())
-		{
-			if (pair.second)
-			{
-				pair.second->update(*pair.first);
-			}
-			else
-			{
-				pair.second = ci::gl::Texture::create(*pair.first);
-				pair.second->setMinFilter(GL_NEAREST); //disable GPU blur
-				pair.second->setMagFilter(GL_NEAREST); //disable GPU blur
-			}
+	const auto _start = work::getTimestamp();
 
-			pair.first.reset();
-		}
+	const auto _skipped = skipStaleRows();
+	if (_skipped > 0)
+	{
+		clearRingTexture();
 	}
+
+	mNumUpdatedRows = _skipped + uploadCommittedRows();
+
+	mUpdateTime = work::getTimestamp() - _start;
 }
 
 void StftRenderer::draw()
 {
 	if (!mGlobals.getAudioNodes().isRecorderReady()) return;
 
-	{ //enter FBO scope
-		const auto _active_fbo = getActiveFramebuffer();
-		ScopedFramebuffer _scope(mFrameBuffers[_active_fbo]);
+	const auto _start = work::getTimestamp();
 
-		ci::gl::clear();
+	drawHistory();
 
-		for (std::size_t index = _active_fbo * mNumSurfaces; index < (_active_fbo + 1) * mNumSurfaces; ++index)
-		{
-			ci::gl::pushMatrices();
-			ci::gl::translate(0.0f, (index % mNumSurfaces) * static_cast<float>(getFramesPerSurface()));
+	mFrameTime.record(mUpdateTime + work::getTimestamp() - _start);
+	mUpdateTime = 0;
+	++mNumFrames;
+}
 
-			if (mSurfaceTexturePool[index].first)
-			{
-				// draw surface
-				ci::gl::draw(*mSurfaceTexturePool[index].first);
-			}
-			else if (mSurfaceTexturePool[index].second)
-			{
-				// draw texture
-				ci::gl::draw(mSurfaceTexturePool[index].second);
-			}
+std::size_t StftRenderer::getNumUpdatedRows() const
+{
+	return mNumUpdatedRows;
+}
 
-			ci::gl::popMatrices();
-		}
-	}
+void StftRenderer::snapshot(Metrics& metrics) const
+{
+	metrics.mFrameTime.clear();
+	mFrameTime.collect(metrics.mFrameTime);
 
-	drawFramebuffers(calculateActiveFboOffset());
+	metrics.mNumFrames = mNumFrames;
+	metrics.mUploadedRows = mUploadedRows;
+	metrics.mUploadCalls = mUploadCalls;
+	metrics.mUploadedBytes = mUploadedBytes;
 }
 
-StftSurface& StftRenderer::getSurface(int index, int pop_pos)
+std::size_t StftRenderer::uploadCommittedRows()
 {
-	const auto _moded_index = index % (2 * mNumSurfaces);
-	// if surface does not exist
-	if (!mSurfaceTexturePool[_moded_index].first)
+	const auto _row_bytes = mViewableBins * sizeof(std::uint32_t);
+	std::uint8_t* _mapped = nullptr;
+	std::size_t _num_rows = 0;
+
+	// rows go out in hop order, stop at the first one still being computed
+	while (_num_rows < mHistoryLength)
 	{
-		// lock and construct the surface
-		std::lock_guard<std::mutex> _lock(mPoolLock);
-		if (!mSurfaceTexturePool[_moded_index].first) //double check
+		const auto _index = getSurfaceIndexByPopIndex(mNextUploadIndex);
+		const auto _row = static_cast<int>(mNextUploadIndex % mFramesPerSurface);
+		auto _surface = getSurfaceBySlot(_index);
+
+		if (!_surface || !_surface->isRowCommitted(_row, mNextUploadIndex)) break;
+
+		if (!_mapped)
 		{
-			if (_moded_index != mNumSurfaces - 1 || _moded_index != 2 * (mNumSurfaces - 1))
-			{
-				mSurfaceTexturePool[_moded_index].first = std::make_unique<StftSurface>(mViewableBins, mLastSurfaceLength, mGlobals.getAppConfig().getMagnitudeIndexStart());
-			}
-			else
+			// orphan last frame's storage so mapping does not wait on the GPU
+			mUploadBuffer.bind();
+			mUploadBuffer.bufferData(mHistoryLength * _row_bytes, nullptr, GL_STREAM_DRAW);
+			_mapped = mUploadBuffer.map(GL_WRITE_ONLY);
+
+			if (!_mapped)
 			{
-				mSurfaceTexturePool[_moded_index].first = std::make_unique<StftSurface>(mViewableBins, getFramesPerSurface(), mGlobals.getAppConfig().getMagnitudeIndexStart());
+				mUploadBuffer.unbind();
+				return 0;
 			}
 		}
+
+		std::memcpy(_mapped + _num_rows * _row_bytes, _surface->getRowPointer(_row), _row_bytes);
+		++_num_rows;
+		++mNextUploadIndex;
+
+		// the last row of this surface is out, the staging slot can be reused
+		if (_row == static_cast<int>(mFramesPerSurface) - 1)
+		{
+			releaseSurface(_index);
+		}
 	}
-	
-	mLastPopPos = pop_pos; //no lock needed, atomic
-	return *(mSurfaceTexturePool[_moded_index].first);
+
+	if (!_mapped) return 0;
+
+	mUploadBuffer.unmap();
+
+	// the new rows are consecutive in the ring, one call per run: two at most, when they wrap
+	mRingTexture->bind();
+	const auto _first_index = mNextUploadIndex - _num_rows;
+	for (std::size_t row = 0; row < _num_rows;)
+	{
+		const auto _ring_row = static_cast<std::size_t>((_first_index + row) % mHistoryLength);
+		const auto _run = std::min(_num_rows - row, mHistoryLength - _ring_row);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, static_cast<GLint>(_ring_row),
+			static_cast<GLsizei>(mViewableBins), static_cast<GLsizei>(_run),
+			GL_RGBA, GL_UNSIGNED_BYTE,
+			reinterpret_cast<const GLvoid*>(row * _row_bytes)); // offset into the unpack buffer
+		row += _run;
+		++mUploadCalls;
+	}
+	mRingTexture->unbind();
+
+	mUploadBuffer.unbind();
+
+	mUploadedRows += _num_rows;
+	mUploadedBytes += _num_rows * _row_bytes;
+
+	return _num_rows;
 }
 
-std::size_t StftRenderer::getFramesPerSurface() const
+std::uint64_t StftRenderer::getOldestVisiblePopIndex() const
 {
-	return mFramesPerSurface;
+	const auto _recorded = mGlobals.getAudioNodes().getBufferRecorderNode()->getRecorder().getNumRecordedPops();
+	return _recorded > mHistoryLength ? _recorded - mHistoryLength : 0;
 }
 
-std::size_t StftRenderer::getSurfaceIndexByQueryPos(std::size_t pos) const
+std::size_t StftRenderer::skipStaleRows()
 {
-	const auto pop_index = mGlobals.getAudioNodes().getBufferRecorderNode()->getQueryIndexByQueryPos(pos);
-	return (pop_index / getFramesPerSurface()) % (2 * mNumSurfaces);
+	const auto _oldest = getOldestVisiblePopIndex();
+	if (mNextUploadIndex >= _oldest) return 0;
+
+	// staging surfaces are left alone, a worker may still be writing a dropped row.
+	// their stale rows never match a newer hop, see StftSurface::isRowCommitted
+	const auto _skipped = static_cast<std::size_t>(_oldest - mNextUploadIndex);
+	mNextUploadIndex = _oldest;
+	return _skipped;
 }
 
-std::size_t StftRenderer::getIndexInSurfaceByQueryPos(std::size_t pos) const
+void StftRenderer::clearRingTexture()
 {
-	const auto pop_index = mGlobals.getAudioNodes().getBufferRecorderNode()->getQueryIndexByQueryPos(pos);
-	return pop_index % getFramesPerSurface();
+	const auto _ring_bytes = mHistoryLength * mViewableBins * sizeof(std::uint32_t);
+
+	mUploadBuffer.bind();
+	mUploadBuffer.bufferData(_ring_bytes, nullptr, GL_STREAM_DRAW);
+	if (auto _mapped = mUploadBuffer.map(GL_WRITE_ONLY))
+	{
+		std::memset(_mapped, 0, _ring_bytes);
+		mUploadBuffer.unmap();
+
+		mRingTexture->bind();
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0,
+			static_cast<GLsizei>(mViewableBins), static_cast<GLsizei>(mHistoryLength),
+			GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		mRingTexture->unbind();
+
+		++mUploadCalls;
+		mUploadedBytes += _ring_bytes;
+	}
+	mUploadBuffer.unbind();
 }
 
-std::size_t StftRenderer::calculateLastSurfaceLength() const
+StftSurface* StftRenderer::getSurfaceBySlot(std::size_t index) const
 {
-	const auto _time_span_percentage = mGlobals.getAppConfig().getTimeRange() / mGlobals.getAppConfig().getRecordDuration();
-	const auto _max_pops = mGlobals.getAudioNodes().getBufferRecorderNode()->getMaxPossiblePops();
-	const auto _pops_per_fbo = static_cast<std::size_t>(_time_span_percentage * _max_pops);
-	const auto _max_num_pops_in_surfaces = mNumSurfaces * mFramesPerSurface;
-	const auto _actual_minus_real_diff = _max_num_pops_in_surfaces - _pops_per_fbo;
-	return getFramesPerSurface() - _actual_minus_real_diff;
+	const auto _link = mSurfacePool[index].load(std::memory_order_acquire);
+	return _link ? mSurfaceStorage[_link - 1].get() : nullptr;
 }
 
-std::size_t StftRenderer::calculateTotalSurfacesLength() const
+void StftRenderer::releaseSurface(std::size_t index)
 {
-	const auto _time_span_percentage = mGlobals.getAppConfig().getTimeRange() / mGlobals.getAppConfig().getRecordDuration();
-	const auto _max_pops = mGlobals.getAudioNodes().getBufferRecorderNode()->getMaxPossiblePops();
-	const auto _pops_per_fbo = static_cast<std::size_t>(_time_span_percentage * _max_pops);
-	const auto _max_num_pops_in_surfaces = mNumSurfaces * mFramesPerSurface;
-	const auto _actual_minus_real_diff = _max_num_pops_in_surfaces - _pops_per_fbo;
-	return (mNumSurfaces * mFramesPerSurface) - _actual_minus_real_diff;
+	if (!mSurfacePool) return;
+
+	// stale rows stay in the surface, their tags never match a newer hop
+	const auto _link = mSurfacePool[index].exchange(0, std::memory_order_acq_rel);
+	if (_link) mFreeSurfaces.push(_link - 1);
 }
 
-void StftRenderer::drawFramebuffer(ci::gl::Fbo& fbo, float shift_right /*= 0.0f*/, float shift_up /*= 0.0f*/)
+StftSurface& StftRenderer::getSurface(int index)
 {
-	ci::gl::pushMatrices();
+	auto _link = mSurfacePool[index].load(std::memory_order_acquire);
+	// if the slot is empty
+	if (!_link)
+	{
+		// take a pooled surface, the pool covers every slot plus every worker
+		std::uint32_t _pooled = 0;
+		while (!mFreeSurfaces.pop(_pooled))
+		{
+			std::this_thread::yield();
+		}
 
-	ci::gl::translate(ci::app::getWindowWidth() + shift_right, ci::app::getWindowHeight() + shift_up);
-	ci::gl::rotate(ci::Vec3f(180.0f, 0, 90.0f));
-	ci::gl::scale(
-		static_cast<float>(ci::app::getWindowHeight()) / fbo.getWidth(),
-		static_cast<float>(ci::app::getWindowWidth()) / fbo.getHeight());
-	ci::gl::draw(fbo.getTexture());
+		// another worker may have filled the slot meanwhile, keep its surface
+		if (mSurfacePool[index].compare_exchange_strong(_link, _pooled + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			_link = _pooled + 1;
+		}
+		else
+		{
+			mFreeSurfaces.push(_pooled);
+		}
+	}
 
-	ci::gl::popMatrices();
+	return *mSurfaceStorage[_link - 1];
+}
+
+void StftRenderer::commitRow(std::uint64_t pop_index, const std::vector<std::uint32_t>& colors)
+{
+	auto& _surface = getSurface(static_cast<int>(getSurfaceIndexByPopIndex(pop_index)));
+	_surface.fillRow(static_cast<int>(pop_index % getFramesPerSurface()), pop_index, colors);
+}
+
+std::size_t StftRenderer::getFramesPerSurface() const
+{
+	return mFramesPerSurface;
 }
 
-void StftRenderer::drawFramebuffers(float shift_right /*= 0.0f*/, float shift_up /*= 0.0f*/)
-{	
-	const auto _active_fbo = getActiveFramebuffer();
-	const auto _inactive_fbo = (_active_fbo == 1 ? 0 : 1);
+std::size_t StftRenderer::getSurfaceIndexByPopIndex(std::uint64_t pop_index) const
+{
+	// the timeline never wraps, the staging pool does
+	return static_cast<std::size_t>((pop_index / getFramesPerSurface()) % (2 * mNumSurfaces));
+}
 
-	drawFramebuffer(mFrameBuffers[_active_fbo], shift_right);
-	drawFramebuffer(mFrameBuffers[_inactive_fbo], shift_right - ci::app::getWindowWidth());
+std::size_t StftRenderer::getSurfaceIndexByQueryPos(std::uint64_t pos) const
+{
+	return getSurfaceIndexByPopIndex(mGlobals.getAudioNodes().getBufferRecorderNode()->getRecorder().getQueryIndexByQueryPos(pos));
 }
 
-std::size_t StftRenderer::getActiveFramebuffer() const
+std::size_t StftRenderer::getIndexInSurfaceByQueryPos(std::uint64_t pos) const
 {
-	return (getSurfaceIndexByQueryPos(mLastPopPos) / mNumSurfaces);
+	const auto pop_index = mGlobals.getAudioNodes().getBufferRecorderNode()->getRecorder().getQueryIndexByQueryPos(pos);
+	return static_cast<std::size_t>(pop_index % getFramesPerSurface());
 }
 
-float StftRenderer::calculateActiveFboOffset() const
+std::uint64_t StftRenderer::getDeadlineByQueryPos(std::uint64_t pos) const
 {
-	// get current record position (copying the atomic to be safe)
-	const int _current_write_pos = mLastPopPos;
-	// get the index of last active surface for drawing
-	int _current_surface_index = getSurfaceIndexByQueryPos(_current_write_pos);
-	if (_current_surface_index >= static_cast<int>(mNumSurfaces))
-	{
-		_current_surface_index = _current_surface_index % mNumSurfaces;
-	}
-	// number of samples that will be empty drawn (last surface)
-	// get last thread-reported pop position and divide it over max pops possible
-	const int _current_index_in_surface = getIndexInSurfaceByQueryPos(_current_write_pos);
-	// How far thread manager has filled this surface approximately?
-	const int _filled_length = _current_surface_index * mFramesPerSurface + _current_index_in_surface;
-	// How much more is left?
-	const int _unfilled_length = mTotalSurfacesLength - _filled_length;
-	// Scale factor to window
-	const float _window_to_fbo_scale = static_cast<float>(ci::app::getWindowWidth()) / mTotalSurfacesLength;
-	
-	return _window_to_fbo_scale * _unfilled_length;
+	// row p stays on screen while fewer than p + history length + 1 windows are recorded
+	const auto& recorder_ref = mGlobals.getAudioNodes().getBufferRecorderNode()->getRecorder();
+	return pos + mHistoryLength * recorder_ref.getHopSize() + recorder_ref.getWindowSize();
+}
+
+std::size_t StftRenderer::calculateHistoryLength() const
+{
+	// number of pops that fit in one screen
+	const auto _pops_per_screen = mGlobals.getAppConfig().getTimeSpanInSamples() / mGlobals.getAppConfig().getHopDurationInSamples();
+	return _pops_per_screen > 0 ? static_cast<std::size_t>(_pops_per_screen) : 1;
+}
+
+void StftRenderer::drawHistory()
+{
+	// oldest uploaded row on the left, newest on the right. GL_REPEAT wraps the ring.
+	const auto _oldest_row = static_cast<std::int32_t>(mNextUploadIndex % mHistoryLength);
+	const auto _source = ci::Area(0, _oldest_row, mViewableBins, _oldest_row + mHistoryLength);
+
+	ci::gl::pushMatrices();
+
+	ci::gl::translate(static_cast<float>(ci::app::getWindowWidth()), static_cast<float>(ci::app::getWindowHeight()));
+	ci::gl::rotate(ci::Vec3f(180.0f, 0, 90.0f));
+	ci::gl::scale(
+		static_cast<float>(ci::app::getWindowHeight()) / mViewableBins,
+		static_cast<float>(ci::app::getWindowWidth()) / mHistoryLength);
+	ci::gl::draw(*mRingTexture, _source, ci::Rectf(0.0f, 0.0f, static_cast<float>(mViewableBins), static_cast<float>(mHistoryLength)));
+
+	ci::gl::popMatrices();
 }
 
 } //!cistft
\ No newline at end of file
@@ -1,35 +1,39 @@
 #include "stft_surface.h"
-#include "palette_manager.h"
+
+#include <algorithm>
+#include <cstring>
 
 namespace cistft {
 
-StftSurface::StftSurface(int width, int height, int fft_vector_index)
-	: ci::Surface32f(width, height, false)
-	, mFftVectorStartIndex(fft_vector_index)
-{}
+StftSurface::StftSurface(int width, int height)
+	: ci::Surface8u(width, height, true, ci::SurfaceChannelOrder::RGBA)
+	, mCommittedRows(new std::atomic<std::uint64_t>[height])
+{
+	for (int row = 0; row < height; ++row)
+	{
+		mCommittedRows[row] = 0;
+	}
+
+	// fault every page in now rather than on a worker's first write
+	std::memset(getData(), 0, getRowBytes() * height);
+}
 
-void StftSurface::fillRow(int row, const std::vector<float>& data)
+void StftSurface::fillRow(int row, std::uint64_t pop_index, const std::vector<std::uint32_t>& colors)
 {
-	std::lock_guard<std::mutex> _lock(mWriteLock);
-	processRow(row, data);
-	mTouchedRows++;
+	processRow(row, colors);
+	// release: the row's pixels happen before the renderer sees the tag
+	mCommittedRows[row].store(pop_index + 1, std::memory_order_release);
 }
 
-void StftSurface::processRow(int row, const std::vector<float>& spectrum)
+void StftSurface::processRow(int row, const std::vector<std::uint32_t>& colors)
 {
-	auto surface_iter = getIter();
-	while (surface_iter.mY != row) {
-		surface_iter.line(); //seek row
-	}
+	const auto _count = std::min<std::size_t>(colors.size(), getWidth());
+	std::memcpy(getRowPointer(row), colors.data(), _count * sizeof(std::uint32_t));
+}
 
-	//! color logic goes here
-	while (surface_iter.pixel())
-	{
-		auto c = palette::Manager::instance().getActivePaletteColor(spectrum[surface_iter.mX + mFftVectorStartIndex]);
-		surface_iter.r() = c.r;
-		surface_iter.g() = c.g;
-		surface_iter.b() = c.b;
-	}
+std::uint32_t* StftSurface::getRowPointer(int row)
+{
+	return reinterpret_cast<std::uint32_t*>(getData() + row * getRowBytes());
 }
 
 } //!cistft
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include "thread_util.h"
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+#include <thread>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+#endif
+
+namespace cistft {
+namespace thread {
+
+void setCurrentThreadName(const std::string& name)
+{
+#if defined(_WIN32)
+	// SetThreadDescription only exists on Windows 10 1607 and later
+	typedef HRESULT(WINAPI *SetThreadDescriptionFn)(HANDLE, PCWSTR);
+	static const auto _set_description = reinterpret_cast<SetThreadDescriptionFn>(
+		::GetProcAddress(::GetModuleHandleW(L"kernel32.dll"), "SetThreadDescription"));
+
+	if (_set_description)
+	{
+		const std::wstring _wide(name.begin(), name.end());
+		_set_description(::GetCurrentThread(), _wide.c_str());
+	}
+#elif defined(__APPLE__)
+	pthread_setname_np(name.c_str());
+#elif defined(__linux__)
+	// the kernel limits names to 15 characters
+	pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+#else
+	(void)name;
+#endif
+}
+
+bool setCurrentThreadAffinity(const std::vector<int>& cpus)
+{
+	if (cpus.empty()) return false;
+
+#if defined(_WIN32)
+	DWORD_PTR _mask = 0;
+	for (const auto cpu : cpus)
+	{
+		if (cpu >= 0 && cpu < static_cast<int>(sizeof(DWORD_PTR) * 8))
+			_mask |= DWORD_PTR(1) << cpu;
+	}
+	return _mask != 0 && ::SetThreadAffinityMask(::GetCurrentThread(), _mask) != 0;
+#elif defined(__linux__)
+	cpu_set_t _set;
+	CPU_ZERO(&_set);
+	for (const auto cpu : cpus)
+	{
+		if (cpu >= 0 && cpu < CPU_SETSIZE)
+			CPU_SET(cpu, &_set);
+	}
+	return CPU_COUNT(&_set) > 0 && pthread_setaffinity_np(pthread_self(), sizeof(_set), &_set) == 0;
+#else
+	// macOS only has affinity hints, nothing to pin with
+	return false;
+#endif
+}
+
+int getNumCpus()
+{
+	const auto _count = static_cast<int>(std::thread::hardware_concurrency());
+	return _count > 0 ? _count : 1;
+}
+
+bool parseCpuList(const std::string& text, std::vector<int>& cpus)
+{
+	std::vector<int> _parsed;
+	std::stringstream _stream(text);
+	std::string _item;
+
+	while (std::getline(_stream, _item, ','))
+	{
+		_item.erase(std::remove_if(_item.begin(), _item.end(), ::isspace), _item.end());
+		if (_item.empty()) continue;
+
+		int _first = 0, _last = 0;
+		char _dash = 0;
+		std::stringstream _range(_item);
+
+		if (!(_range >> _first)) return false;
+		if (_range >> _dash)
+		{
+			if (_dash != '-' || !(_range >> _last)) return false;
+		}
+		else
+		{
+			_last = _first;
+		}
+
+		if (_first < 0 || _last < _first) return false;
+		for (int cpu = _first; cpu <= _last; ++cpu) _parsed.push_back(cpu);
+	}
+
+	std::sort(_parsed.begin(), _parsed.end());
+	_parsed.erase(std::unique(_parsed.begin(), _parsed.end()), _parsed.end());
+	cpus.swap(_parsed);
+	return true;
+}
+
+std::string formatCpuList(const std::vector<int>& cpus)
+{
+	std::stringstream _stream;
+	for (std::size_t index = 0; index < cpus.size();)
+	{
+		// collapse consecutive CPUs into ranges
+		auto _end = index;
+		while (_end + 1 < cpus.size() && cpus[_end + 1] == cpus[_end] + 1) ++_end;
+
+		if (index > 0) _stream << ',';
+		_stream << cpus[index];
+		if (_end > index) _stream << '-' << cpus[_end];
+
+		index = _end + 1;
+	}
+	return _stream.str();
+}
+
+}} //!cistft::thread
\ No newline at end of file
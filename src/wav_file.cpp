@@ -0,0 +1,225 @@
+#include "wav_file.h"
+
+#include <cstring>
+
+#if defined(_WIN32)
+#	define NOMINMAX
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace cistft {
+namespace audio {
+
+namespace {
+static const std::uint16_t FORMAT_PCM = 0x0001;
+static const std::uint16_t FORMAT_IEEE_FLOAT = 0x0003;
+static const std::uint16_t FORMAT_EXTENSIBLE = 0xFFFE;
+
+//! RIFF is little endian regardless of the machine
+static std::uint16_t _read_u16(const unsigned char* p)
+{
+	return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+}
+
+static std::uint32_t _read_u32(const unsigned char* p)
+{
+	return	static_cast<std::uint32_t>(p[0]) |
+			(static_cast<std::uint32_t>(p[1]) << 8) |
+			(static_cast<std::uint32_t>(p[2]) << 16) |
+			(static_cast<std::uint32_t>(p[3]) << 24);
+}
+} //!namespace
+
+std::size_t getSampleBytes(SampleEncoding encoding)
+{
+	switch (encoding)
+	{
+	case SampleEncoding::Unsigned8: return 1;
+	case SampleEncoding::Int16: return 2;
+	case SampleEncoding::Int24: return 3;
+	case SampleEncoding::Float64: return 8;
+	default: return 4;
+	}
+}
+
+WavFile::WavFile()
+	: mMapping(nullptr)
+	, mMappingSize(0)
+	, mFileHandle(nullptr)
+	, mMappingHandle(nullptr)
+	, mData(nullptr)
+	, mNumChannels(0)
+	, mNumFrames(0)
+	, mFrameBytes(0)
+	, mSampleRate(0)
+	, mEncoding(SampleEncoding::Int16)
+{}
+
+WavFile::~WavFile()
+{
+	close();
+}
+
+float WavFile::getDuration() const
+{
+	return mSampleRate > 0 ? static_cast<float>(mNumFrames) / mSampleRate : 0.0f;
+}
+
+void WavFile::close()
+{
+	unmap();
+	mData = nullptr;
+	mNumChannels = mNumFrames = mFrameBytes = 0;
+	mSampleRate = 0;
+}
+
+bool WavFile::fail(const std::string& error)
+{
+	close();
+	mError = error;
+	return false;
+}
+
+#if defined(_WIN32)
+bool WavFile::map(const std::string& path)
+{
+	HANDLE _file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (_file == INVALID_HANDLE_VALUE) return false;
+	mFileHandle = _file;
+
+	LARGE_INTEGER _size;
+	if (!::GetFileSizeEx(_file, &_size) || _size.QuadPart == 0) return false;
+	mMappingSize = static_cast<std::size_t>(_size.QuadPart);
+
+	mMappingHandle = ::CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mMappingHandle) return false;
+
+	mMapping = static_cast<const unsigned char*>(::MapViewOfFile(mMappingHandle, FILE_MAP_READ, 0, 0, 0));
+	return mMapping != nullptr;
+}
+
+void WavFile::unmap()
+{
+	if (mMapping) ::UnmapViewOfFile(mMapping);
+	if (mMappingHandle) ::CloseHandle(mMappingHandle);
+	if (mFileHandle) ::CloseHandle(mFileHandle);
+	mMapping = nullptr;
+	mMappingHandle = mFileHandle = nullptr;
+	mMappingSize = 0;
+}
+#else
+bool WavFile::map(const std::string& path)
+{
+	const int _fd = ::open(path.c_str(), O_RDONLY);
+	if (_fd < 0) return false;
+
+	struct stat _stat;
+	if (::fstat(_fd, &_stat) != 0 || _stat.st_size == 0)
+	{
+		::close(_fd);
+		return false;
+	}
+	mMappingSize = static_cast<std::size_t>(_stat.st_size);
+
+	// the mapping keeps the file alive, the descriptor is not needed anymore
+	void* _mapping = ::mmap(nullptr, mMappingSize, PROT_READ, MAP_PRIVATE, _fd, 0);
+	::close(_fd);
+	if (_mapping == MAP_FAILED) return false;
+
+	// hops are read front to back, let the kernel read ahead and drop what is behind
+	::madvise(_mapping, mMappingSize, MADV_SEQUENTIAL);
+	mMapping = static_cast<const unsigned char*>(_mapping);
+	return true;
+}
+
+void WavFile::unmap()
+{
+	if (mMapping) ::munmap(const_cast<unsigned char*>(mMapping), mMappingSize);
+	mMapping = nullptr;
+	mMappingSize = 0;
+}
+#endif
+
+bool WavFile::open(const std::string& path)
+{
+	close();
+	if (!map(path)) return fail("cannot map " + path);
+
+	const unsigned char* _cursor = mMapping;
+	const unsigned char* const _end = mMapping + mMappingSize;
+
+	if (mMappingSize < 12 ||
+		std::memcmp(_cursor, "RIFF", 4) != 0 ||
+		std::memcmp(_cursor + 8, "WAVE", 4) != 0)
+	{
+		return fail(path + " is not a RIFF WAVE file");
+	}
+	_cursor += 12;
+
+	bool _has_format = false;
+
+	// walk the chunks until the samples, everything but fmt is skipped
+	while (_end - _cursor >= 8)
+	{
+		const unsigned char* _chunk = _cursor;
+		const std::size_t _chunk_size = _read_u32(_chunk + 4);
+		const std::size_t _available = static_cast<std::size_t>(_end - _chunk) - 8;
+		_cursor += 8;
+
+		if (std::memcmp(_chunk, "fmt ", 4) == 0)
+		{
+			if (_chunk_size < 16 || _chunk_size > _available) return fail(path + " has a broken fmt chunk");
+
+			std::uint16_t _format = _read_u16(_cursor);
+			mNumChannels = _read_u16(_cursor + 2);
+			mSampleRate = static_cast<int>(_read_u32(_cursor + 4));
+			const std::size_t _bits = _read_u16(_cursor + 14);
+
+			// the actual encoding hides in the first two bytes of the sub format GUID
+			if (_format == FORMAT_EXTENSIBLE)
+			{
+				if (_chunk_size < 26) return fail(path + " has a broken extensible fmt chunk");
+				_format = _read_u16(_cursor + 24);
+			}
+
+			if (_format == FORMAT_PCM && _bits == 8) mEncoding = SampleEncoding::Unsigned8;
+			else if (_format == FORMAT_PCM && _bits == 16) mEncoding = SampleEncoding::Int16;
+			else if (_format == FORMAT_PCM && _bits == 24) mEncoding = SampleEncoding::Int24;
+			else if (_format == FORMAT_PCM && _bits == 32) mEncoding = SampleEncoding::Int32;
+			else if (_format == FORMAT_IEEE_FLOAT && _bits == 32) mEncoding = SampleEncoding::Float32;
+			else if (_format == FORMAT_IEEE_FLOAT && _bits == 64) mEncoding = SampleEncoding::Float64;
+			else return fail(path + " is neither 8/16/24/32-bit PCM nor 32/64-bit IEEE float");
+
+			if (mNumChannels == 0 || mSampleRate <= 0) return fail(path + " has no channels or no sample rate");
+
+			mFrameBytes = getSampleBytes(mEncoding) * mNumChannels;
+			_has_format = true;
+		}
+		else if (std::memcmp(_chunk, "data", 4) == 0)
+		{
+			if (!_has_format) return fail(path + " has samples before its fmt chunk");
+
+			// files that were cut short, or outgrew the 32-bit size field, keep whatever is on the disk
+			const std::size_t _data_size = (_chunk_size == 0xFFFFFFFF || _chunk_size > _available) ? _available : _chunk_size;
+
+			mData = _cursor;
+			mNumFrames = _data_size / mFrameBytes;
+			mError.clear();
+			return true;
+		}
+
+		// chunks are word aligned
+		const std::size_t _skip = _chunk_size + (_chunk_size & 1);
+		if (_skip > _available) break;
+		_cursor += _skip;
+	}
+
+	return fail(path + " has no data chunk");
+}
+
+}} //!cistft::audio
\ No newline at end of file
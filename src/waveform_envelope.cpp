@@ -0,0 +1,129 @@
+#include "waveform_envelope.h"
+#include "spectrum_kernel.h"
+
+#include <algorithm>
+
+namespace cistft {
+namespace audio {
+
+namespace {
+//! whole buckets reduced per pass over a write, bounds the audio thread scratch
+static std::size_t BLOCK_BUCKETS = 256;
+} //!namespace
+
+WaveformEnvelope::WaveformEnvelope(std::size_t window_size)
+	: mWindowSize(std::max<std::size_t>(window_size, 1))
+	, mNumChannels(0)
+	, mPendingFrames(0)
+	, mBlockCapacity(0)
+{
+	mBucketSize = (mWindowSize + MAX_BUCKETS - 1) / MAX_BUCKETS;
+	mNumBuckets = (mWindowSize + mBucketSize - 1) / mBucketSize;
+}
+
+void WaveformEnvelope::initialize(std::size_t num_channels, std::size_t frames_per_block)
+{
+	const auto _channels = 2 * num_channels;
+
+	mNumChannels = num_channels;
+	mBlockCapacity = std::min(frames_per_block / mBucketSize + 1, BLOCK_BUCKETS);
+	// a window plus a write in flight, see RingBuffer::isIntact
+	mBuckets = std::make_unique<RingBuffer>(mNumBuckets + mBlockCapacity, _channels);
+	mPending.assign(_channels, 0.0f);
+	mPendingFrames = 0;
+	mBlock.assign(_channels * mBlockCapacity, 0.0f);
+}
+
+void WaveformEnvelope::uninitialize()
+{
+	mBuckets.reset();
+}
+
+std::uint64_t WaveformEnvelope::getNumRecordedBuckets() const
+{
+	return mBuckets ? mBuckets->getWritePosition() : 0;
+}
+
+void WaveformEnvelope::write(const float* data, std::size_t frames, std::size_t channel_stride)
+{
+	std::size_t frame = 0;
+
+	while (frame < frames)
+	{
+		const auto _whole = std::min((frames - frame) / mBucketSize, mBlockCapacity);
+		if (mPendingFrames > 0 || _whole == 0)
+		{
+			// top up the bucket straddling two writes
+			const auto _count = std::min(mBucketSize - mPendingFrames, frames - frame);
+			accumulate(data, channel_stride, frame, _count);
+			frame += _count;
+			continue;
+		}
+
+		for (std::size_t ch = 0; ch < mNumChannels; ++ch)
+		{
+			dsp::minMaxColumns(data + ch * channel_stride + frame, _whole * mBucketSize, _whole,
+				mBlock.data() + 2 * ch * mBlockCapacity,
+				mBlock.data() + (2 * ch + 1) * mBlockCapacity);
+		}
+		mBuckets->write(mBlock.data(), _whole, mBlockCapacity);
+		frame += _whole * mBucketSize;
+	}
+}
+
+void WaveformEnvelope::accumulate(const float* data, std::size_t channel_stride, std::size_t frame, std::size_t count)
+{
+	for (std::size_t ch = 0; ch < mNumChannels; ++ch)
+	{
+		float lo, hi;
+		dsp::minMaxColumns(data + ch * channel_stride + frame, count, 1, &lo, &hi);
+
+		auto& _lo = mPending[2 * ch];
+		auto& _hi = mPending[2 * ch + 1];
+		_lo = mPendingFrames == 0 ? lo : std::min(_lo, lo);
+		_hi = mPendingFrames == 0 ? hi : std::max(_hi, hi);
+	}
+
+	mPendingFrames += count;
+	if (mPendingFrames == mBucketSize)
+	{
+		mBuckets->write(mPending.data(), 1, 1);
+		mPendingFrames = 0;
+	}
+}
+
+bool WaveformEnvelope::getColumns(std::size_t columns, std::vector<float>& mins, std::vector<float>& maxs)
+{
+	if (!mBuckets || columns == 0) return false;
+
+	const auto _written = mBuckets->getWritePosition();
+	const auto _count = static_cast<std::size_t>(std::min<std::uint64_t>(_written, mNumBuckets));
+	if (_count == 0) return false;
+
+	RingBuffer::Window _window;
+	if (!mBuckets->acquire(_written - _count, _count, _window)) return false;
+
+	const auto _channels = mBuckets->getNumChannels();
+	mEnvelope.resize(_channels * _count);
+	for (std::size_t ch = 0; ch < _channels; ++ch)
+	{
+		auto _out = mEnvelope.begin() + ch * _count;
+		_out = std::copy(_window.getFirst(ch), _window.getFirst(ch) + _window.getFirstSize(), _out);
+		std::copy(_window.getSecond(ch), _window.getSecond(ch) + _window.getSecondSize(), _out);
+	}
+
+	// lapped while copying, keep the last frame's columns
+	if (!mBuckets->release(_window)) return false;
+
+	mins.resize(mNumChannels * columns);
+	maxs.resize(mNumChannels * columns);
+	mDiscarded.resize(columns);
+	for (std::size_t ch = 0; ch < mNumChannels; ++ch)
+	{
+		dsp::minMaxColumns(mEnvelope.data() + 2 * ch * _count, _count, columns, mins.data() + ch * columns, mDiscarded.data());
+		dsp::minMaxColumns(mEnvelope.data() + (2 * ch + 1) * _count, _count, columns, mDiscarded.data(), maxs.data() + ch * columns);
+	}
+	return true;
+}
+
+}} //!cistft::audio
\ No newline at end of file
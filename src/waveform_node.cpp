@@ -0,0 +1,32 @@
+#include "waveform_node.h"
+
+namespace cistft {
+namespace audio {
+
+WaveformNode::WaveformNode(std::size_t window_size)
+	: inherited(Format())
+	, mEnvelope(window_size)
+{}
+
+void WaveformNode::initialize()
+{
+	mEnvelope.initialize(getNumChannels(), getFramesPerBlock());
+}
+
+void WaveformNode::uninitialize()
+{
+	mEnvelope.uninitialize();
+}
+
+void WaveformNode::process(ci::audio::Buffer* buffer)
+{
+	// Cinder buffers are planar, one channel after another
+	mEnvelope.write(buffer->getData(), buffer->getNumFrames(), buffer->getNumFrames());
+}
+
+bool WaveformNode::getColumns(std::size_t columns, std::vector<float>& mins, std::vector<float>& maxs)
+{
+	return mEnvelope.getColumns(columns, mins, maxs);
+}
+
+}} //!cistft::audio
\ No newline at end of file
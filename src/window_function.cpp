@@ -0,0 +1,53 @@
+#include "window_function.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace cistft {
+namespace dsp {
+
+namespace {
+static const double TWO_PI = 6.283185307179586;
+} //!namespace
+
+void generateWindow(WindowType type, float* window, std::size_t size)
+{
+	if (size == 0) return;
+
+	// symmetric windows, both ends are part of the window
+	const double _step = size > 1 ? 1.0 / static_cast<double>(size - 1) : 0.0;
+
+	switch (type)
+	{
+	case WindowType::Blackman:
+	{
+		const double _alpha = 0.16;
+		const double _a0 = 0.5 * (1.0 - _alpha);
+		const double _a1 = 0.5;
+		const double _a2 = 0.5 * _alpha;
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			const double _x = i * _step;
+			window[i] = static_cast<float>(_a0 - _a1 * std::cos(TWO_PI * _x) + _a2 * std::cos(2.0 * TWO_PI * _x));
+		}
+		break;
+	}
+	case WindowType::Hamming:
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			window[i] = static_cast<float>(0.54 - 0.46 * std::cos(TWO_PI * i * _step));
+		}
+		break;
+	case WindowType::Hann:
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			window[i] = static_cast<float>(0.5 * (1.0 - std::cos(TWO_PI * i * _step)));
+		}
+		break;
+	default:
+		std::fill(window, window + size, 1.0f);
+		break;
+	}
+}
+
+}} //!cistft::dsp
\ No newline at end of file
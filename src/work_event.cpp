@@ -0,0 +1,48 @@
+#include "work_event.h"
+
+namespace cistft {
+namespace work {
+
+namespace {
+static const std::uint64_t WAITER = 1;
+static const std::uint64_t EPOCH = std::uint64_t(1) << 32;
+static const std::uint64_t WAITER_MASK = EPOCH - 1;
+} //!namespace
+
+std::uint32_t EventCount::prepareWait()
+{
+	const auto _state = mState.fetch_add(WAITER, std::memory_order_seq_cst);
+	return static_cast<std::uint32_t>(_state >> 32);
+}
+
+void EventCount::cancelWait()
+{
+	mState.fetch_sub(WAITER, std::memory_order_seq_cst);
+}
+
+void EventCount::commitWait(std::uint32_t key)
+{
+	std::unique_lock<std::mutex> _lock(mLock);
+	while (static_cast<std::uint32_t>(mState.load(std::memory_order_seq_cst) >> 32) == key)
+	{
+		mCondition.wait(_lock);
+	}
+	mState.fetch_sub(WAITER, std::memory_order_seq_cst);
+}
+
+void EventCount::notify(bool all /*= false*/)
+{
+	// pairs with the seq_cst increment in prepareWait
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if ((mState.load(std::memory_order_relaxed) & WAITER_MASK) == 0) return;
+
+	{
+		std::lock_guard<std::mutex> _lock(mLock);
+		mState.fetch_add(EPOCH, std::memory_order_seq_cst);
+	}
+
+	if (all) mCondition.notify_all();
+	else mCondition.notify_one();
+}
+
+}} //!cistft::work
\ No newline at end of file
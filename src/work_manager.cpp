@@ -1,26 +1,90 @@
 #include "work_manager.h"
 #include "work_client.h"
 #include "work_request.h"
+#include "work_pool.h"
+#include "thread_util.h"
+
+#include <algorithm>
+#include <string>
 
 namespace cistft {
 namespace work {
 
-Manager::Manager(std::size_t num_threads /*= 4*/)
-	: mWorker(mIoService)
+namespace {
+//! upper bound of tasks a worker moves from the injection queue at once
+static std::size_t MAX_INJECTED_BATCH = 32;
+//! capacity of every worker deque
+static std::size_t DEQUE_CAPACITY = 1024;
+
+//! the manager and index of the worker running on this thread, if any
+thread_local static const void* _current_manager = nullptr;
+thread_local static std::size_t _current_index = 0;
+//! xorshift state used to pick steal victims
+thread_local static std::uint32_t _victim_seed = 0;
+} //!namespace
+
+void RequestDeleter::operator()(Request* request) const
+{
+	// the client may only die after the request is back in its pool
+	ClientRef _client = std::move(request->mClient);
+
+	if (request->mPool)
+		request->mPool->recycle(request);
+	else
+		delete request;
+}
+
+Manager::Manager(std::size_t num_threads /*= 4*/, const std::vector<int>& cpus /*= std::vector<int>()*/)
+	: mInjectionHead(nullptr)
+	, mInjectionTail(nullptr)
+	, mInjectionSize(0)
+	, mConcurrency(num_threads)
+	, mStopping(false)
+	, mNumThreads(num_threads)
+	, mStartedAt(getTimestamp())
 {
-	for (auto count = num_threads; count > 0; --count)
+	for (std::size_t index = 0; index < num_threads; ++index)
 	{
-		mThreadPool.create_thread(boost::bind(&boost::asio::io_service::run, &mIoService));
+		mWorkers.push_back(std::unique_ptr<Worker>(new Worker(DEQUE_CAPACITY)));
+	}
+
+	// start the threads once every deque exists, they steal from each other
+	for (std::size_t index = 0; index < num_threads; ++index)
+	{
+		mWorkers[index]->mThread = std::thread(&Manager::workerLoop, this, index, cpus);
 	}
 }
 
 Manager::~Manager()
 {
-	mIoService.stop();
-	mThreadPool.join_all();
+	{
+		std::lock_guard<std::mutex> _lock(mConcurrencyLock);
+		mStopping = true;
+	}
+	mConcurrencyChanged.notify_all();
+	mIdleWorkers.notify(true);
+
+	for (auto& worker : mWorkers)
+	{
+		if (worker->mThread.joinable())
+			worker->mThread.join();
+	}
+
+	// nobody runs these anymore
+	for (auto& worker : mWorkers)
+	{
+		while (auto task = worker->mDeque.pop())
+		{
+			RequestRef _discarded(task);
+		}
+	}
+	while (auto task = popInjectedLocked())
+	{
+		RequestRef _discarded(task);
+	}
 }
 
-void Manager::run(std::shared_ptr< Client > requester, std::unique_ptr< Request > request)
+void Manager::run(std::shared_ptr< Client > requester, std::unique_ptr< Request, RequestDeleter > request)
 {
 	if (requester && request)
 	{
@@ -29,10 +93,228 @@ void Manager::run(std::shared_ptr< Client > requester, std::unique_ptr< Request
 	}
 }
 
-void Manager::post(const std::shared_ptr< Client >& requester, std::unique_ptr< Request >& request)
+void Manager::post(const std::shared_ptr< Client >& requester, std::unique_ptr< Request, RequestDeleter >& request)
 {
-	if (requester && request) //HACK ALERT: this is due to lack of official support of moving unique_ptr's inside a lambda!
-		mIoService.post(std::bind([=](std::unique_ptr< Request >& w){ run(requester, std::move(w)); }, std::move(request)));
+	if (!requester || !request) return;
+
+	request->mClient = requester;
+	request->mPostedAt = getTimestamp();
+	auto task = request.release();
+
+	// workers posting more work keep it to themselves, others may still steal it
+	if (_current_manager == this && mWorkers[_current_index]->mDeque.push(task))
+	{
+		mIdleWorkers.notify();
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> _lock(mInjectionLock);
+		task->mNext = nullptr;
+		if (mInjectionTail) mInjectionTail->mNext = task;
+		else mInjectionHead = task;
+		mInjectionTail = task;
+		mInjectionSize.fetch_add(1, std::memory_order_release);
+	}
+	mIdleWorkers.notify();
+}
+
+std::size_t Manager::getNumThreads() const
+{
+	return mNumThreads;
+}
+
+void Manager::setConcurrency(std::size_t num_active)
+{
+	if (num_active < 1) num_active = 1;
+	if (num_active > mNumThreads) num_active = mNumThreads;
+	if (num_active == mConcurrency) return;
+
+	{
+		std::lock_guard<std::mutex> _lock(mConcurrencyLock);
+		mConcurrency = num_active;
+	}
+	mConcurrencyChanged.notify_all();
+}
+
+std::size_t Manager::getConcurrency() const
+{
+	return mConcurrency;
+}
+
+void Manager::parkInactive(std::size_t index)
+{
+	// this worker may have been woken for a request, hand the wake up over
+	mIdleWorkers.notify();
+
+	std::unique_lock<std::mutex> _lock(mConcurrencyLock);
+	while (!mStopping && index >= mConcurrency)
+	{
+		mConcurrencyChanged.wait(_lock);
+	}
+}
+
+void Manager::workerLoop(std::size_t index, std::vector<int> cpus)
+{
+	_current_manager = this;
+	_current_index = index;
+	_victim_seed = static_cast<std::uint32_t>(index * 2654435761u + 1);
+
+	thread::setCurrentThreadName("cistft-worker-" + std::to_string(index));
+	if (!cpus.empty()) thread::setCurrentThreadAffinity(cpus);
+
+	while (!mStopping)
+	{
+		// workers above the concurrency limit leave their deque to thieves
+		if (index >= mConcurrency.load(std::memory_order_relaxed))
+		{
+			parkInactive(index);
+			continue;
+		}
+
+		if (auto task = findTask(index))
+		{
+			execute(index, task);
+			continue;
+		}
+
+		// announce we are about to sleep, then look once more so a post
+		// that raced with us is never missed
+		const auto _key = mIdleWorkers.prepareWait();
+
+		if (mStopping)
+		{
+			mIdleWorkers.cancelWait();
+			break;
+		}
+
+		if (auto task = findTask(index))
+		{
+			mIdleWorkers.cancelWait();
+			execute(index, task);
+			continue;
+		}
+
+		mIdleWorkers.commitWait(_key);
+	}
+}
+
+Request* Manager::findTask(std::size_t index)
+{
+	if (auto task = mWorkers[index]->mDeque.pop()) return task;
+	if (auto task = popInjected(index)) return task;
+	return stealTask(index);
+}
+
+Request* Manager::popInjected(std::size_t index)
+{
+	if (mInjectionSize.load(std::memory_order_acquire) == 0) return nullptr;
+
+	Request* first = nullptr;
+	std::size_t _moved = 0;
+	{
+		std::lock_guard<std::mutex> _lock(mInjectionLock);
+
+		// take a fair share, the rest of the batch is left for thieves
+		auto _batch = mInjectionSize.load(std::memory_order_relaxed) / mNumThreads + 1;
+		if (_batch > MAX_INJECTED_BATCH) _batch = MAX_INJECTED_BATCH;
+
+		first = popInjectedLocked();
+		if (!first) return nullptr;
+
+		auto& _deque = mWorkers[index]->mDeque;
+		while (--_batch > 0 && mInjectionHead && _deque.push(mInjectionHead))
+		{
+			popInjectedLocked();
+			++_moved;
+		}
+	}
+
+	// there is more work around than this worker can do right now
+	if (_moved > 0) mIdleWorkers.notify();
+	return first;
+}
+
+Request* Manager::popInjectedLocked()
+{
+	Request* task = mInjectionHead;
+	if (!task) return nullptr;
+
+	mInjectionHead = task->mNext;
+	if (!mInjectionHead) mInjectionTail = nullptr;
+	task->mNext = nullptr;
+
+	mInjectionSize.fetch_sub(1, std::memory_order_relaxed);
+	return task;
+}
+
+Request* Manager::stealTask(std::size_t index)
+{
+	if (mNumThreads < 2) return nullptr;
+
+	_victim_seed ^= _victim_seed << 13;
+	_victim_seed ^= _victim_seed >> 17;
+	_victim_seed ^= _victim_seed << 5;
+
+	const auto _start = _victim_seed % mNumThreads;
+	for (std::size_t offset = 0; offset < mNumThreads; ++offset)
+	{
+		const auto _victim = (_start + offset) % mNumThreads;
+		if (_victim == index) continue;
+
+		if (auto task = mWorkers[_victim]->mDeque.steal()) return task;
+	}
+
+	return nullptr;
+}
+
+void Manager::execute(std::size_t index, Request* task)
+{
+	auto& _worker = *mWorkers[index];
+	const auto _started = getTimestamp();
+	_worker.mWaitTime.record(_started > task->mPostedAt ? _started - task->mPostedAt : 0);
+
+	{
+		// the request keeps its client alive until it is destroyed
+		Client* _client = task->mClient.get();
+		RequestRef _request(task);
+
+		_request->run(); //run request
+		_client->handle(std::move(_request)); //call client for recycling
+	}
+
+	// single writer, see Histogram::record
+	const auto _service = getTimestamp() - _started;
+	_worker.mServiceTime.record(_service);
+	_worker.mBusyTime.store(_worker.mBusyTime.load(std::memory_order_relaxed) + _service, std::memory_order_relaxed);
+}
+
+void Manager::snapshot(Metrics& metrics) const
+{
+	const auto _now = getTimestamp();
+	const auto _since = metrics.mTakenAt != 0 ? metrics.mTakenAt : mStartedAt;
+	const auto _elapsed = static_cast<double>(_now > _since ? _now - _since : 1);
+
+	metrics.mWaitTime.clear();
+	metrics.mServiceTime.clear();
+	metrics.mQueueDepth = mInjectionSize.load(std::memory_order_relaxed);
+	metrics.mBusyRatio.resize(mNumThreads, 0.0f);
+	metrics.mBusyTime.resize(mNumThreads, 0);
+
+	for (std::size_t index = 0; index < mNumThreads; ++index)
+	{
+		const auto& _worker = *mWorkers[index];
+		_worker.mWaitTime.collect(metrics.mWaitTime);
+		_worker.mServiceTime.collect(metrics.mServiceTime);
+		metrics.mQueueDepth += _worker.mDeque.size();
+
+		const auto _busy = _worker.mBusyTime.load(std::memory_order_relaxed);
+		const auto _ratio = (_busy - std::min(_busy, metrics.mBusyTime[index])) / _elapsed;
+		metrics.mBusyRatio[index] = static_cast<float>(std::min(1.0, _ratio));
+		metrics.mBusyTime[index] = _busy;
+	}
+
+	metrics.mTakenAt = _now;
 }
 
 }} //!cistft::work
\ No newline at end of file
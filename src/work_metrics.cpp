@@ -0,0 +1,187 @@
+#include "work_metrics.h"
+
+#if defined(_WIN32)
+#	define NOMINMAX
+#	include <windows.h>
+#else
+#	include <chrono>
+#	include <sys/resource.h>
+#endif
+
+#include <algorithm>
+
+namespace cistft {
+namespace work {
+
+std::uint64_t getTimestamp()
+{
+#if defined(_WIN32)
+	static const auto _frequency = []
+	{
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+		return static_cast<std::uint64_t>(frequency.QuadPart);
+	}();
+
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter(&counter);
+
+	// split to keep the multiplication from overflowing
+	const auto _ticks = static_cast<std::uint64_t>(counter.QuadPart);
+	return (_ticks / _frequency) * 1000000000ull + (_ticks % _frequency) * 1000000000ull / _frequency;
+#else
+	return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+std::uint64_t getProcessCpuTime()
+{
+#if defined(_WIN32)
+	FILETIME creation, exited, kernel, user;
+	if (!GetProcessTimes(GetCurrentProcess(), &creation, &exited, &kernel, &user)) return 0;
+
+	// FILETIMEs count 100 ns ticks
+	const auto _ticks = (static_cast<std::uint64_t>(kernel.dwHighDateTime) << 32 | kernel.dwLowDateTime)
+		+ (static_cast<std::uint64_t>(user.dwHighDateTime) << 32 | user.dwLowDateTime);
+	return _ticks * 100;
+#else
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+
+	const auto _micros = (static_cast<std::uint64_t>(usage.ru_utime.tv_sec) + usage.ru_stime.tv_sec) * 1000000ull
+		+ usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+	return _micros * 1000;
+#endif
+}
+
+namespace {
+
+//! answers the index of the highest set bit, value must not be zero
+static std::size_t highestBit(std::uint64_t value)
+{
+#if defined(_MSC_VER) && defined(_WIN64)
+	unsigned long index;
+	_BitScanReverse64(&index, value);
+	return index;
+#elif defined(_MSC_VER)
+	unsigned long index;
+	if (_BitScanReverse(&index, static_cast<unsigned long>(value >> 32))) return index + 32;
+	_BitScanReverse(&index, static_cast<unsigned long>(value));
+	return index;
+#else
+	return 63 - __builtin_clzll(value);
+#endif
+}
+
+} //!namespace
+
+HistogramSnapshot::HistogramSnapshot()
+	: mCounts(Histogram::NUM_BUCKETS, 0)
+	, mSum(0)
+{}
+
+void HistogramSnapshot::clear()
+{
+	std::fill(mCounts.begin(), mCounts.end(), 0);
+	mSum = 0;
+}
+
+void HistogramSnapshot::subtract(const HistogramSnapshot& earlier)
+{
+	for (std::size_t index = 0; index < mCounts.size(); ++index)
+	{
+		mCounts[index] -= std::min(mCounts[index], earlier.mCounts[index]);
+	}
+	mSum -= std::min(mSum, earlier.mSum);
+}
+
+std::uint64_t HistogramSnapshot::getCount() const
+{
+	std::uint64_t _count = 0;
+	for (auto count : mCounts) _count += count;
+	return _count;
+}
+
+double HistogramSnapshot::getMean() const
+{
+	const auto _count = getCount();
+	return _count > 0 ? static_cast<double>(mSum) / _count : 0.0;
+}
+
+std::uint64_t HistogramSnapshot::getPercentile(double percentile) const
+{
+	const auto _count = getCount();
+	if (_count == 0) return 0;
+
+	const auto _clamped = std::max(0.0, std::min(100.0, percentile));
+	const auto _rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(_clamped / 100.0 * _count + 0.5));
+
+	std::uint64_t _seen = 0;
+	for (std::size_t index = 0; index < mCounts.size(); ++index)
+	{
+		_seen += mCounts[index];
+		if (_seen >= _rank) return Histogram::getBucketUpperBound(index);
+	}
+
+	return getMax();
+}
+
+std::uint64_t HistogramSnapshot::getMax() const
+{
+	for (std::size_t index = mCounts.size(); index > 0; --index)
+	{
+		if (mCounts[index - 1] != 0) return Histogram::getBucketUpperBound(index - 1);
+	}
+	return 0;
+}
+
+Histogram::Histogram()
+	: mSum(0)
+{
+	for (auto& count : mCounts)
+	{
+		count.store(0, std::memory_order_relaxed);
+	}
+}
+
+void Histogram::record(std::uint64_t value)
+{
+	// single writer, a plain increment is enough and readers never see a torn value
+	auto& _count = mCounts[getBucketIndex(value)];
+	_count.store(_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	mSum.store(mSum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+void Histogram::collect(HistogramSnapshot& snapshot) const
+{
+	for (std::size_t index = 0; index < NUM_BUCKETS; ++index)
+	{
+		snapshot.mCounts[index] += mCounts[index].load(std::memory_order_relaxed);
+	}
+	snapshot.mSum += mSum.load(std::memory_order_relaxed);
+}
+
+std::size_t Histogram::getBucketIndex(std::uint64_t value)
+{
+	// the first two octaves are exact, one bucket per value
+	if (value < 2 * SUB_BUCKETS) return static_cast<std::size_t>(value);
+
+	const auto _exponent = highestBit(value);
+	if (_exponent > MAX_EXPONENT) return NUM_BUCKETS - 1;
+
+	const auto _sub_bucket = static_cast<std::size_t>(value >> (_exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+	return (_exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + _sub_bucket;
+}
+
+std::uint64_t Histogram::getBucketUpperBound(std::size_t index)
+{
+	if (index < 2 * SUB_BUCKETS) return index;
+
+	const auto _exponent = index / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+	const auto _sub_bucket = index % SUB_BUCKETS;
+	const auto _width = std::uint64_t(1) << (_exponent - SUB_BUCKET_BITS);
+	return (SUB_BUCKETS + _sub_bucket) * _width + _width - 1;
+}
+
+}} //!cistft::work
\ No newline at end of file
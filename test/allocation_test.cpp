@@ -0,0 +1,292 @@
+#include "test_util.h"
+
+#include "app_config.h"
+#include "recorder.h"
+#include "signal_generator.h"
+#include "stft_client.h"
+#include "work_client.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#	include <malloc.h>
+#endif
+
+using namespace cistft;
+
+#if defined(_MSC_VER)
+#	define TEST_NOINLINE __declspec(noinline)
+#else
+#	define TEST_NOINLINE __attribute__((noinline))
+#endif
+
+namespace {
+//! every global operator new of the process, any thread
+static std::atomic<std::uint64_t> _num_allocations(0);
+
+static void* _allocate(std::size_t size) noexcept
+{
+	_num_allocations.fetch_add(1, std::memory_order_relaxed);
+	return std::malloc(size ? size : 1);
+}
+
+#if defined(__cpp_aligned_new)
+static void* _allocate_aligned(std::size_t size, std::align_val_t alignment) noexcept
+{
+	_num_allocations.fetch_add(1, std::memory_order_relaxed);
+#	if defined(_WIN32)
+	return _aligned_malloc(size ? size : 1, static_cast<std::size_t>(alignment));
+#	else
+	void* ptr = nullptr;
+	return posix_memalign(&ptr, static_cast<std::size_t>(alignment), size ? size : 1) == 0 ? ptr : nullptr;
+#	endif
+}
+
+static void _free_aligned(void* ptr) noexcept
+{
+#	if defined(_WIN32)
+	_aligned_free(ptr);
+#	else
+	std::free(ptr);
+#	endif
+}
+#endif // __cpp_aligned_new
+} //!namespace
+
+// the whole replaceable set, so nothing reaches the library allocator behind the counter's back.
+// all out of line, GCC warns when one side is inlined and it sees malloc() or free() meet operator new or delete
+TEST_NOINLINE void* operator new(std::size_t size)
+{
+	if (void* ptr = _allocate(size)) return ptr;
+	throw std::bad_alloc();
+}
+
+TEST_NOINLINE void* operator new[](std::size_t size)
+{
+	if (void* ptr = _allocate(size)) return ptr;
+	throw std::bad_alloc();
+}
+
+TEST_NOINLINE void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return _allocate(size); }
+TEST_NOINLINE void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return _allocate(size); }
+
+TEST_NOINLINE void operator delete(void* ptr) noexcept { std::free(ptr); }
+TEST_NOINLINE void operator delete[](void* ptr) noexcept { std::free(ptr); }
+TEST_NOINLINE void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+TEST_NOINLINE void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+TEST_NOINLINE void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+TEST_NOINLINE void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+#if defined(__cpp_aligned_new)
+TEST_NOINLINE void* operator new(std::size_t size, std::align_val_t alignment)
+{
+	if (void* ptr = _allocate_aligned(size, alignment)) return ptr;
+	throw std::bad_alloc();
+}
+
+TEST_NOINLINE void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+	if (void* ptr = _allocate_aligned(size, alignment)) return ptr;
+	throw std::bad_alloc();
+}
+
+TEST_NOINLINE void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return _allocate_aligned(size, alignment); }
+TEST_NOINLINE void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return _allocate_aligned(size, alignment); }
+
+TEST_NOINLINE void operator delete(void* ptr, std::align_val_t) noexcept { _free_aligned(ptr); }
+TEST_NOINLINE void operator delete[](void* ptr, std::align_val_t) noexcept { _free_aligned(ptr); }
+TEST_NOINLINE void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { _free_aligned(ptr); }
+TEST_NOINLINE void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { _free_aligned(ptr); }
+TEST_NOINLINE void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { _free_aligned(ptr); }
+TEST_NOINLINE void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { _free_aligned(ptr); }
+#endif // __cpp_aligned_new
+
+namespace {
+//! the audio callback block
+static const std::size_t BLOCK_FRAMES = 512;
+static const std::size_t NUM_CHANNELS = 2;
+static const int SAMPLE_RATE = 44100;
+//! warm up, then the run that has to stay off the heap
+static const std::size_t WARM_UP_SECONDS = 10;
+static const std::size_t STEADY_SECONDS = 600;
+//! the synthetic audio thread is faster than real time, it waits above this many queued transforms
+static const std::size_t MAX_QUEUED_TRANSFORMS = 32;
+//! hops per request, AudioNodes::calculateBatchSize lands here when the workers keep up
+static const std::size_t BATCH_HOPS = 4;
+//! more requests than can be alive below the throttle: the queued ones plus those still being recycled
+static const std::size_t WARM_UP_REQUESTS = 2 * MAX_QUEUED_TRANSFORMS;
+
+/*!
+ * \class RowCounter
+ * \brief stands in for StftRenderer behind stft::Client, counts the committed
+ * rows and the workers that committed them.
+ */
+class RowCounter : public stft::Client::RowSink
+{
+public:
+	RowCounter() : mNumRows(0), mNumThreads(0) {}
+
+	void commitRow(std::uint64_t, const std::vector<std::uint32_t>&) override
+	{
+		thread_local static bool _seen = false;
+		if (!_seen)
+		{
+			_seen = true;
+			mNumThreads.fetch_add(1, std::memory_order_relaxed);
+		}
+		mNumRows.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	std::uint64_t	getNumRows() const { return mNumRows.load(); }
+	std::size_t		getNumThreads() const { return mNumThreads.load(); }
+
+private:
+	std::atomic<std::uint64_t>	mNumRows;
+	std::atomic<std::size_t>	mNumThreads;
+};
+
+/*!
+ * \class Timeline
+ * \brief the audio callback and AudioNodes::update on one thread: records a
+ * block, pops every complete window and posts them to the client in batches.
+ */
+class Timeline
+{
+public:
+	Timeline(audio::Recorder& recorder, stft::Client& client, std::size_t history_length)
+		: mRecorder(recorder)
+		, mClient(client)
+		, mGenerator(audio::SignalGenerator::Format().signal(audio::SignalType::PinkNoise).channels(NUM_CHANNELS).sampleRate(SAMPLE_RATE))
+		, mBlock(BLOCK_FRAMES * NUM_CHANNELS)
+		, mHistoryLength(history_length)
+		, mLastPos(0)
+		, mNumPosted(0)
+	{}
+
+	//! \brief posts count requests at once for the newest hop, the request pool grows to hold them all.
+	void burst(std::size_t count)
+	{
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			post(mLastPos, 1);
+		}
+		drain();
+	}
+
+	void run(std::size_t seconds)
+	{
+		const auto _hop_size = mRecorder.getHopSize();
+		const auto _end = mRecorder.getWritePosition() + static_cast<std::uint64_t>(seconds) * SAMPLE_RATE;
+		while (mRecorder.getWritePosition() < _end)
+		{
+			while (mClient.getNumQueuedTransforms() >= MAX_QUEUED_TRANSFORMS) std::this_thread::yield();
+
+			mGenerator.generate(mBlock.data(), BLOCK_FRAMES, BLOCK_FRAMES, 1);
+			mRecorder.write(mBlock.data(), BLOCK_FRAMES, BLOCK_FRAMES);
+
+			std::uint64_t _first_pos = 0;
+			auto _remaining = mRecorder.popBufferWindows(_first_pos, mRecorder.getNumPendingPops());
+			if (_remaining > 0) mLastPos = _first_pos + (_remaining - 1) * _hop_size;
+
+			while (_remaining > 0)
+			{
+				const auto _batch_hops = std::min(BATCH_HOPS, _remaining);
+				_remaining -= _batch_hops;
+				post(_first_pos + _remaining * _hop_size, _batch_hops);
+			}
+		}
+		drain();
+	}
+
+	std::uint64_t getNumPosted() const { return mNumPosted; }
+
+private:
+	void post(std::uint64_t query_pos, std::size_t num_hops)
+	{
+		// same deadline as StftRenderer::getDeadlineByQueryPos
+		const auto _deadline = query_pos + mHistoryLength * mRecorder.getHopSize() + mRecorder.getWindowSize();
+		auto _request = mClient.makeRequest(query_pos, num_hops, 1, _deadline);
+		mClient.request(_request);
+		mNumPosted += num_hops;
+	}
+
+	void drain() const
+	{
+		while (mClient.getNumQueuedTransforms() > 0) std::this_thread::yield();
+	}
+
+private:
+	audio::Recorder&			mRecorder;
+	stft::Client&				mClient;
+	audio::SignalGenerator		mGenerator;
+	std::vector<float>			mBlock;
+	std::size_t					mHistoryLength;
+	std::uint64_t				mLastPos;
+	std::uint64_t				mNumPosted;
+};
+} //!namespace
+
+/*!
+ * runs ten minutes of synthetic audio through the steady state request path,
+ * Recorder -> pooled stft::Request -> work::Manager -> stft::Client::handle -> row sink,
+ * and checks global operator new is not called once everything is warmed up.
+ */
+int main()
+{
+	// the counter has to see allocations in the first place
+	const auto _before = _num_allocations.load();
+	::operator delete(::operator new(sizeof(int))); // a new-expression may be elided
+	if (!CISTFT_CHECK(_num_allocations.load() == _before + 1)) return 1;
+
+	AppConfig _config;
+	_config.fftBackend(fft::BackendType::Portable);
+	_config.sampleRate(SAMPLE_RATE);
+	_config.setup();
+
+	// sized and popped the way RecorderNode does it
+	audio::Recorder _recorder(_config);
+	_recorder.initialize(NUM_CHANNELS);
+
+	const auto _format = stft::Client::Format()
+		.channels(NUM_CHANNELS)
+		.fftSize(_config.getCalculatedFftSize())
+		.windowSize(_config.getWindowDurationInSamples())
+		.decimation(_config.getDecimationFactor());
+
+	RowCounter _rows;
+	work::Manager _manager(2);
+	auto _client = std::static_pointer_cast<stft::Client>(work::make_client<stft::Client>(_manager, &_config, &_recorder, &_rows, _format));
+
+	// same history as StftRenderer::calculateHistoryLength
+	const auto _history_length = std::max<std::size_t>(1, _config.getTimeSpanInSamples() / _recorder.getHopSize());
+	Timeline _timeline(_recorder, *_client, _history_length);
+
+	// until every worker built its storage, then the pool grows past what the throttle lets through
+	for (std::size_t second = 0; second < STEADY_SECONDS && _rows.getNumThreads() < _manager.getNumThreads(); second += WARM_UP_SECONDS)
+	{
+		_timeline.run(WARM_UP_SECONDS);
+	}
+	CISTFT_CHECK(_rows.getNumThreads() == _manager.getNumThreads());
+	_timeline.burst(WARM_UP_REQUESTS);
+
+	const auto _warm_allocations = _num_allocations.load();
+	_timeline.run(STEADY_SECONDS);
+	const auto _steady_allocations = _num_allocations.load() - _warm_allocations;
+
+	CISTFT_CHECK(_steady_allocations == 0);
+	CISTFT_CHECK(_rows.getNumRows() == _timeline.getNumPosted());
+	CISTFT_CHECK(_client->getNumDroppedHops() == 0);
+	CISTFT_CHECK(_client->getNumLateHops() == 0);
+
+	std::printf("%llu hops, %llu allocations in %zu s of steady state, %d failures\n",
+		static_cast<unsigned long long>(_rows.getNumRows()), static_cast<unsigned long long>(_steady_allocations),
+		STEADY_SECONDS, test::getNumFailures());
+	return test::getNumFailures() == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "test_util.h"
+
+#include "app_config.h"
+#include "recorder.h"
+#include "signal_generator.h"
+#include "stft_client.h"
+#include "stft_request.h"
+#include "work_client.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace cistft;
+
+namespace {
+static const int SAMPLE_RATE = 44100;
+//! hops in one request, all of them past the first one used to wrap the default deadline
+static const std::size_t NUM_HOPS = 16;
+
+/*!
+ * \class RowLog
+ * \brief stands in for StftRenderer behind stft::Client, counts the rows committed per hop.
+ */
+class RowLog : public stft::Client::RowSink
+{
+public:
+	explicit RowLog(std::size_t num_hops) : mCommits(num_hops, 0), mNumStray(0) {}
+
+	void commitRow(std::uint64_t pop_index, const std::vector<std::uint32_t>&) override
+	{
+		std::lock_guard<std::mutex> _lock(mLock);
+		if (pop_index < mCommits.size()) ++mCommits[static_cast<std::size_t>(pop_index)];
+		else ++mNumStray;
+	}
+
+	void clear()
+	{
+		std::lock_guard<std::mutex> _lock(mLock);
+		std::fill(mCommits.begin(), mCommits.end(), 0);
+		mNumStray = 0;
+	}
+
+	//! answers whether every hop was committed exactly once and nothing else was
+	bool isEachOnce()
+	{
+		std::lock_guard<std::mutex> _lock(mLock);
+		for (auto count : mCommits) if (count != 1) return false;
+		return mNumStray == 0;
+	}
+
+	std::size_t getNumRows()
+	{
+		std::lock_guard<std::mutex> _lock(mLock);
+		std::size_t _rows = mNumStray;
+		for (auto count : mCommits) _rows += count;
+		return _rows;
+	}
+
+private:
+	std::mutex			mLock;
+	std::vector<int>	mCommits;
+	std::size_t			mNumStray;
+};
+
+static void _post_and_wait(stft::Client& client, work::RequestRef request)
+{
+	client.request(request);
+	while (client.getNumQueuedTransforms() > 0) std::this_thread::yield();
+}
+} //!namespace
+
+/*!
+ * posts multi-hop requests through stft::Client, with and without a deadline,
+ * and checks which hops reach the row sink.
+ */
+int main()
+{
+	// the deadline of later hops saturates instead of wrapping
+	const auto _max = std::numeric_limits<std::uint64_t>::max();
+	CISTFT_CHECK(stft::Request(0, NUM_HOPS).getHopDeadline(NUM_HOPS - 1, 441) == _max);
+	CISTFT_CHECK(stft::Request(0, NUM_HOPS, 1, _max - 441).getHopDeadline(1, 441) == _max);
+	CISTFT_CHECK(stft::Request(0, NUM_HOPS, 1, _max - 441).getHopDeadline(2, 441) == _max);
+	CISTFT_CHECK(stft::Request(0, NUM_HOPS, 1, 1000).getHopDeadline(2, 441) == 1882);
+
+	AppConfig _config;
+	_config.fftBackend(fft::BackendType::Portable);
+	_config.sampleRate(SAMPLE_RATE);
+	_config.setup();
+
+	audio::Recorder _recorder(_config);
+	_recorder.initialize(1);
+
+	// every hop of the request recorded, well inside the ring
+	const auto _frames = _recorder.getWindowSize() + (NUM_HOPS - 1) * _recorder.getHopSize();
+	std::vector<float> _block(_frames);
+	audio::SignalGenerator _generator(audio::SignalGenerator::Format().signal(audio::SignalType::PinkNoise).channels(1).sampleRate(SAMPLE_RATE));
+	_generator.generate(_block.data(), _frames, _frames, 1);
+	_recorder.write(_block.data(), _frames, _frames);
+
+	std::uint64_t _first_pos = 0;
+	CISTFT_CHECK(_recorder.popBufferWindows(_first_pos, _recorder.getNumPendingPops()) == NUM_HOPS);
+	CISTFT_CHECK(_first_pos == 0);
+
+	const auto _format = stft::Client::Format()
+		.channels(1)
+		.fftSize(_config.getCalculatedFftSize())
+		.windowSize(_config.getWindowDurationInSamples())
+		.decimation(_config.getDecimationFactor());
+
+	RowLog _rows(NUM_HOPS);
+	work::Manager _manager(2);
+	auto _client = std::static_pointer_cast<stft::Client>(work::make_client<stft::Client>(_manager, &_config, &_recorder, &_rows, _format));
+
+	// no deadline, every hop is produced
+	_post_and_wait(*_client, _client->makeRequest(_first_pos, NUM_HOPS));
+	CISTFT_CHECK(_rows.isEachOnce());
+	CISTFT_CHECK(_client->getNumDroppedHops() == 0);
+	CISTFT_CHECK(_client->getNumLateHops() == 0);
+
+	// a deadline the recorder already passed, every hop is dropped
+	_rows.clear();
+	_post_and_wait(*_client, _client->makeRequest(_first_pos, NUM_HOPS, 1, 1));
+	CISTFT_CHECK(_rows.getNumRows() == 0);
+	CISTFT_CHECK(_client->getNumDroppedHops() == NUM_HOPS);
+
+	std::printf("%zu hops per request, %llu dropped, %d failures\n",
+		NUM_HOPS, static_cast<unsigned long long>(_client->getNumDroppedHops()), test::getNumFailures());
+	return test::getNumFailures() == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include "test_util.h"
+
+#include "spectrum_kernel.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace cistft;
+
+namespace {
+//! past every vector width and its tail, plus the default 44.1 kHz window
+static const std::size_t SIZES[] = { 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 882, 1764 };
+static const std::size_t CHANNEL_COUNTS[] = { 1, 2, 3, 5, 6, 8, 32 };
+//! written after the last sample, downmixWindow must leave it alone
+static const float GUARD = 12345.0f;
+
+//! stft::windowHop before the fused kernel: zero, accumulate every channel scaled, window
+static void _downmix_legacy(const float* const* channels, std::size_t num_channels, std::size_t size, const float* window, float scale, float* input)
+{
+	std::fill(input, input + size, 0.0f);
+
+	if (num_channels > 1)
+	{
+		for (std::size_t ch = 0; ch < num_channels; ch++)
+		{
+			for (std::size_t i = 0; i < size; i++)
+			{
+				input[i] += channels[ch][i] * scale;
+			}
+		}
+
+		if (!window) return;
+		for (std::size_t i = 0; i < size; i++)
+		{
+			input[i] *= window[i];
+		}
+	}
+	else
+	{
+		for (std::size_t i = 0; i < size; i++)
+		{
+			input[i] = window ? channels[0][i] * window[i] : channels[0][i];
+		}
+	}
+}
+
+//! \brief answers true if num is a power of two, scaling by 1 / num is exact then.
+static bool _is_power_of_two(std::size_t num)
+{
+	return (num & (num - 1)) == 0;
+}
+} //!namespace
+
+/*!
+ * checks dsp::downmixWindow against the three pass loop it replaced in
+ * stft::windowHop, for every channel count, with and without a window, over
+ * sizes around each kernel's vector width and on unaligned buffers. Where the
+ * channel scale is a power of two the result has to be bit identical, otherwise
+ * within the rounding of scaling each channel before or after the sum.
+ */
+int main()
+{
+	std::mt19937 _random(1);
+	std::uniform_real_distribution<float> _sample(-1.0f, 1.0f);
+
+	std::size_t _num_compared = 0;
+	for (auto num_channels : CHANNEL_COUNTS)
+	{
+		const float _scale = num_channels > 1 ? 1.0f / num_channels : 1.0f;
+
+		for (auto size : SIZES)
+		{
+			// one past the start, off the vector alignment like the second side of a ring wrap
+			std::vector<std::vector<float>> _samples(num_channels, std::vector<float>(size + 1));
+			std::vector<const float*> _channels(num_channels);
+			for (std::size_t ch = 0; ch < num_channels; ++ch)
+			{
+				for (auto& sample : _samples[ch]) sample = _sample(_random);
+				_channels[ch] = _samples[ch].data() + 1;
+			}
+
+			std::vector<float> _window(size + 1);
+			for (std::size_t i = 0; i < _window.size(); ++i) _window[i] = 0.5f - 0.5f * std::cos(6.2831853f * i / size);
+
+			for (int windowed = 0; windowed < 2; ++windowed)
+			{
+				const float* window = windowed ? _window.data() + 1 : nullptr;
+
+				std::vector<float> _legacy(size + 2, GUARD), _fused(size + 2, GUARD);
+				_downmix_legacy(_channels.data(), num_channels, size, window, _scale, _legacy.data() + 1);
+				dsp::downmixWindow(_channels.data(), num_channels, size, window, _scale, _fused.data() + 1);
+
+				CISTFT_CHECK(_fused.front() == GUARD && _fused.back() == GUARD);
+
+				for (std::size_t i = 1; i <= size; ++i)
+				{
+					if (_is_power_of_two(num_channels))
+					{
+						if (!CISTFT_CHECK(_fused[i] == _legacy[i]))
+						{
+							std::fprintf(stderr, "  %zu channels, size %zu, %s, sample %zu: %.9g != %.9g\n",
+								num_channels, size, windowed ? "window" : "no window", i - 1, _fused[i], _legacy[i]);
+							break;
+						}
+						continue;
+					}
+
+					// each sum rounds once per channel, each scaled channel once more, on samples of at most 1
+					float _bound = num_channels * 2 * FLT_EPSILON;
+					if (window) _bound *= std::fabs(window[i - 1]);
+					if (!CISTFT_CHECK(std::fabs(_fused[i] - _legacy[i]) <= _bound))
+					{
+						std::fprintf(stderr, "  %zu channels, size %zu, %s, sample %zu: %.9g vs %.9g\n",
+							num_channels, size, windowed ? "window" : "no window", i - 1, _fused[i], _legacy[i]);
+						break;
+					}
+				}
+				++_num_compared;
+			}
+		}
+	}
+
+	// nothing to do, nothing written
+	float _untouched = GUARD;
+	const float* _none[] = { nullptr };
+	dsp::downmixWindow(_none, 1, 0, nullptr, 1.0f, &_untouched);
+	dsp::downmixWindow(_none, 0, 16, nullptr, 1.0f, &_untouched);
+	CISTFT_CHECK(_untouched == GUARD);
+
+	std::printf("%zu hops compared, %s kernels, %d failures\n", _num_compared, dsp::getKernelIsaName(), test::getNumFailures());
+	return test::getNumFailures() == 0 ? 0 : 1;
+}
\ No newline at end of file
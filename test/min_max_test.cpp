@@ -0,0 +1,178 @@
+#include "test_util.h"
+
+#include "spectrum_kernel.h"
+#include "waveform_envelope.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace cistft;
+
+namespace {
+//! monitor windows from a few milliseconds to a minute at 48 kHz
+static const std::size_t WINDOW_SIZES[] = { 1, 100, 1024, 4095, 4097, 5000, 48000, 2880000 };
+//! pixel columns, fewer and more than the buckets of most windows
+static const std::size_t COLUMNS[] = { 1, 3, 700, 1900, 5000 };
+//! stereo, so the ring's channel pairs are exercised
+static const std::size_t NUM_CHANNELS = 2;
+//! the Cinder default, WaveformNode passes getFramesPerBlock
+static const std::size_t FRAMES_PER_BLOCK = 512;
+//! the most buckets one write keeps in flight, see WaveformEnvelope::initialize
+static const std::size_t MAX_BLOCK_BUCKETS = 256;
+
+/*!
+ * \brief answers the min/max of the samples column covers, the way
+ * dsp::minMaxColumns documents it: [c * size / columns, (c + 1) * size / columns),
+ * or the sample the column falls on when that is empty.
+ */
+static void _reference(const float* in, std::size_t size, std::size_t columns, std::size_t column, float& lo, float& hi)
+{
+	const std::size_t begin = column * size / columns;
+	const std::size_t end = (column + 1) * size / columns;
+	if (begin == end)
+	{
+		lo = hi = in[begin];
+		return;
+	}
+	lo = *std::min_element(in + begin, in + end);
+	hi = *std::max_element(in + begin, in + end);
+}
+
+//! \brief checks minMaxColumns against the reference, answers false on the first mismatch.
+static bool _check_columns(const std::vector<float>& in, std::size_t columns)
+{
+	std::vector<float> _mins(columns + 1, -9.0f), _maxs(columns + 1, -9.0f);
+	dsp::minMaxColumns(in.data(), in.size(), columns, _mins.data(), _maxs.data());
+
+	for (std::size_t column = 0; column < columns; ++column)
+	{
+		float lo, hi;
+		_reference(in.data(), in.size(), columns, column, lo, hi);
+		if (!CISTFT_CHECK(_mins[column] == lo && _maxs[column] == hi))
+		{
+			std::fprintf(stderr, "  size %zu, %zu columns, column %zu: %g %g, expected %g %g\n",
+				in.size(), columns, column, _mins[column], _maxs[column], lo, hi);
+			return false;
+		}
+	}
+	// exactly columns values written
+	return CISTFT_CHECK(_mins[columns] == -9.0f && _maxs[columns] == -9.0f);
+}
+
+} //!namespace
+
+/*!
+ * compares dsp::minMaxColumns, and the WaveformEnvelope that WaveformNode runs,
+ * with brute force over the raw samples: more columns than samples, columns of
+ * uneven width, buckets straddling two writes, columns straddling buckets and
+ * windows across the end of the bucket ring.
+ */
+int main()
+{
+	std::mt19937 _random(1);
+	std::uniform_real_distribution<float> _sample(-1.0f, 1.0f);
+	std::uniform_int_distribution<std::size_t> _block_frames(1, 1500);
+
+	// the kernel, every size around the vector widths and a few beyond
+	std::size_t _num_kernel = 0;
+	for (std::size_t size = 1; size <= 200 && test::getNumFailures() == 0; ++size)
+	{
+		std::vector<float> _in(size);
+		for (auto& sample : _in) sample = _sample(_random);
+
+		for (std::size_t columns = 1; columns <= 2 * size + 3; ++columns, ++_num_kernel)
+		{
+			if (!_check_columns(_in, columns)) break;
+		}
+	}
+	for (std::size_t size : { 1000, 4096, 48000, 1440000 })
+	{
+		std::vector<float> _in(size);
+		for (auto& sample : _in) sample = _sample(_random);
+		for (auto columns : COLUMNS)
+		{
+			_check_columns(_in, columns);
+			++_num_kernel;
+		}
+	}
+
+	// nothing to reduce, nothing written
+	float _untouched = -9.0f;
+	dsp::minMaxColumns(&_untouched, 0, 1, &_untouched, &_untouched);
+	CISTFT_CHECK(_untouched == -9.0f);
+
+	// the envelope, fed blocks of random length the way audio callbacks arrive
+	std::size_t _num_envelope = 0;
+	for (auto window_size : WINDOW_SIZES)
+	{
+		audio::WaveformEnvelope _envelope(window_size);
+		const auto _bucket_size = _envelope.getBucketSize();
+		std::vector<float> _mins, _maxs;
+
+		// nothing to read before initialize
+		CISTFT_CHECK(!_envelope.getColumns(1, _mins, _maxs));
+		_envelope.initialize(NUM_CHANNELS, FRAMES_PER_BLOCK);
+
+		std::vector<std::vector<float>> _samples(NUM_CHANNELS);
+		std::vector<float> _block;
+
+		// past the end of the ring, it holds a window plus a write in flight
+		const auto _end = _envelope.getNumBuckets() + MAX_BLOCK_BUCKETS + 100;
+		while (_envelope.getNumRecordedBuckets() < _end && test::getNumFailures() == 0)
+		{
+			// planar like a Cinder buffer, one channel after another
+			const auto _frames = std::min<std::size_t>(_block_frames(_random) * (1 + window_size / 50000), 120000);
+			_block.resize(NUM_CHANNELS * _frames);
+			for (auto& sample : _block) sample = _sample(_random);
+			for (std::size_t ch = 0; ch < NUM_CHANNELS; ++ch)
+			{
+				_samples[ch].insert(_samples[ch].end(), _block.begin() + ch * _frames, _block.begin() + (ch + 1) * _frames);
+			}
+			_envelope.write(_block.data(), _frames, _frames);
+
+			// every complete bucket recorded, the one being filled not yet
+			const auto _recorded = static_cast<std::size_t>(_envelope.getNumRecordedBuckets());
+			if (!CISTFT_CHECK(_recorded == _samples[0].size() / _bucket_size)) break;
+
+			// no column until the first bucket is complete
+			const auto _has_columns = _envelope.getColumns(COLUMNS[_num_envelope % (sizeof(COLUMNS) / sizeof(COLUMNS[0]))], _mins, _maxs);
+			if (!CISTFT_CHECK(_has_columns == (_recorded > 0)) || !_has_columns) continue;
+			const auto _columns = _mins.size() / NUM_CHANNELS;
+
+			// column c covers the samples of its buckets, the last getNumBuckets complete ones
+			const auto _count = std::min(_recorded, _envelope.getNumBuckets());
+			bool _matched = true;
+			for (std::size_t ch = 0; ch < NUM_CHANNELS && _matched; ++ch)
+			{
+				const auto _window = _samples[ch].data() + (_recorded - _count) * _bucket_size;
+				for (std::size_t column = 0; column < _columns; ++column)
+				{
+					const std::size_t begin = column * _count / _columns;
+					const std::size_t end = std::max((column + 1) * _count / _columns, begin + 1);
+					const auto lo = *std::min_element(_window + begin * _bucket_size, _window + end * _bucket_size);
+					const auto hi = *std::max_element(_window + begin * _bucket_size, _window + end * _bucket_size);
+					const auto index = ch * _columns + column;
+
+					if (!CISTFT_CHECK(_mins[index] == lo && _maxs[index] == hi))
+					{
+						std::fprintf(stderr, "  window %zu, bucket %zu, channel %zu, %zu columns, column %zu: %g %g, expected %g %g\n",
+							window_size, _bucket_size, ch, _columns, column, _mins[index], _maxs[index], lo, hi);
+						_matched = false;
+						break;
+					}
+				}
+			}
+			++_num_envelope;
+		}
+
+		// nothing to read once uninitialized
+		_envelope.uninitialize();
+		CISTFT_CHECK(!_envelope.getColumns(1, _mins, _maxs));
+	}
+
+	std::printf("%zu kernel reductions, %zu envelopes compared, %s kernels, %d failures\n",
+		_num_kernel, _num_envelope, dsp::getKernelIsaName(), test::getNumFailures());
+	return test::getNumFailures() == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+# runs an hour of generated signal through cistft-cli and checks every hop made it into the output
+# usage: cmake -DCLI=<path to cistft-cli> -DOUTPUT=<raw file> -P soak_cli.cmake
+
+SET (SECONDS 3600)
+SET (SAMPLE_RATE 8000)
+
+EXECUTE_PROCESS(
+	COMMAND "${CLI}" -o "${OUTPUT}" -f raw --hop 0.02 --signal linear_chirp
+		--signal-seconds ${SECONDS} --sample-rate ${SAMPLE_RATE} --signal-high 3000
+	RESULT_VARIABLE _result
+	ERROR_VARIABLE _log
+)
+
+IF (NOT _result EQUAL 0)
+MESSAGE(FATAL_ERROR "cistft-cli failed (${_result}):\n${_log}")
+ENDIF (NOT _result EQUAL 0)
+
+# the tool reports its window and hop sizes, and how many hops and bins it wrote
+STRING(REGEX MATCH "window ([0-9]+), hop ([0-9]+)" _match "${_log}")
+SET (_window ${CMAKE_MATCH_1})
+SET (_hop ${CMAKE_MATCH_2})
+STRING(REGEX MATCH "([0-9]+) hops x ([0-9]+) bins" _match "${_log}")
+SET (_hops ${CMAKE_MATCH_1})
+SET (_bins ${CMAKE_MATCH_2})
+
+IF (NOT _window OR NOT _hop OR NOT _hops OR NOT _bins)
+MESSAGE(FATAL_ERROR "unexpected cistft-cli output:\n${_log}")
+ENDIF (NOT _window OR NOT _hop OR NOT _hops OR NOT _bins)
+
+# every hop whose window fits in the signal, exactly once
+MATH(EXPR _expected_hops "(${SECONDS} * ${SAMPLE_RATE} - ${_window}) / ${_hop} + 1")
+IF (NOT _hops EQUAL _expected_hops)
+MESSAGE(FATAL_ERROR "${_hops} hops analyzed, expected ${_expected_hops}")
+ENDIF (NOT _hops EQUAL _expected_hops)
+
+# one float32 per bin per hop, nothing more, nothing less
+FILE(SIZE "${OUTPUT}" _size)
+MATH(EXPR _expected_size "${_hops} * ${_bins} * 4")
+IF (NOT _size EQUAL _expected_size)
+MESSAGE(FATAL_ERROR "${OUTPUT} has ${_size} bytes, expected ${_expected_size}")
+ENDIF (NOT _size EQUAL _expected_size)
+
+FILE(REMOVE "${OUTPUT}")
+MESSAGE(STATUS "${_hops} hops x ${_bins} bins")
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "test_util.h"
+
+#include "app_config.h"
+#include "recorder.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+using namespace cistft;
+
+namespace {
+//! past the 32 bit frame index, about 27 hours at 44.1 kHz
+static const std::uint64_t DEFAULT_FRAMES = (1ull << 32) + (1ull << 20);
+//! the audio callback block and the default sample rate, window and hop come from AppConfig
+static const std::size_t BLOCK_FRAMES = 512;
+static const int SAMPLE_RATE = 44100;
+
+//! the sample at an absolute frame index. Integers below 2^24 are exact floats
+inline float _sample_at(std::uint64_t pos)
+{
+	return static_cast<float>(pos & 0xFFFFFF);
+}
+} //!namespace
+
+/*!
+ * drives the Recorder of RecorderNode, sized by a default config, through
+ * more than 2^32 frames the way the audio callback writes it and
+ * AudioNodes::update pops hops out of it. Checks every hop is popped and
+ * read exactly once, in order and intact, wherever its window straddles
+ * the end of the ring.
+ * usage: cistft-test-soak [frames]
+ */
+int main(int argc, char** argv)
+{
+	const auto _frames = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : DEFAULT_FRAMES;
+
+	AppConfig _config;
+	_config.sampleRate(SAMPLE_RATE);
+	_config.setup();
+
+	audio::Recorder _recorder(_config);
+	_recorder.initialize(1);
+	const auto _ring = _recorder.getRingBuffer();
+
+	const auto _window_size = _recorder.getWindowSize();
+	const auto _hop_size = _recorder.getHopSize();
+	std::vector<float> _block(BLOCK_FRAMES);
+
+	std::uint64_t _written = 0;
+	std::uint64_t _next_hop = 0;	// position of the next hop to pop
+	std::uint64_t _num_hops = 0;
+	std::uint64_t _num_straddling = 0;
+
+	while (_written < _frames && test::getNumFailures() == 0)
+	{
+		for (std::size_t i = 0; i < BLOCK_FRAMES; ++i) _block[i] = _sample_at(_written + i);
+		_recorder.write(_block.data(), BLOCK_FRAMES, BLOCK_FRAMES);
+		_written += BLOCK_FRAMES;
+
+		if (!CISTFT_CHECK(_recorder.getWritePosition() == _written)) break;
+
+		// every hop whose window is complete, the way AudioNodes::update pops them
+		std::uint64_t _first_pos = 0;
+		const auto _num_pops = _recorder.popBufferWindows(_first_pos, _recorder.getNumPendingPops());
+		if (_num_pops > 0 && !CISTFT_CHECK(_first_pos == _next_hop)) break;
+		CISTFT_CHECK(_recorder.getNumPendingPops() == 0);
+
+		for (std::size_t pop = 0; pop < _num_pops; ++pop)
+		{
+			audio::RingBuffer::Window _window;
+			if (!CISTFT_CHECK(_ring->acquire(_next_hop, _window_size, _window))) break;
+
+			CISTFT_CHECK(_window.getPosition() == _next_hop);
+			CISTFT_CHECK(_window.getSize() == _window_size);
+			CISTFT_CHECK(_window.getFirst(0)[0] == _sample_at(_next_hop));
+
+			if (_window.getSecondSize() > 0)
+			{
+				++_num_straddling;
+				CISTFT_CHECK(_window.getFirst(0)[_window.getFirstSize() - 1] == _sample_at(_next_hop + _window.getFirstSize() - 1));
+				CISTFT_CHECK(_window.getSecond(0)[0] == _sample_at(_next_hop + _window.getFirstSize()));
+				CISTFT_CHECK(_window.getSecond(0)[_window.getSecondSize() - 1] == _sample_at(_next_hop + _window_size - 1));
+			}
+			else
+			{
+				CISTFT_CHECK(_window.getFirst(0)[_window_size - 1] == _sample_at(_next_hop + _window_size - 1));
+			}
+
+			CISTFT_CHECK(_ring->release(_window));
+
+			_next_hop += _hop_size;
+			++_num_hops;
+		}
+	}
+
+	// exactly the hops that fit in what was written, none dropped, none twice
+	CISTFT_CHECK(_num_hops == (_written - _window_size) / _hop_size + 1);
+	CISTFT_CHECK(_num_hops == _recorder.getNumRecordedPops());
+	CISTFT_CHECK(_num_straddling > 0);
+	CISTFT_CHECK(_ring->getNumOverruns() == 0);
+
+	// the graph shutting down drops the recorder's ring, not the one a worker still holds
+	_recorder.uninitialize();
+	CISTFT_CHECK(!_recorder.getRingBuffer());
+	CISTFT_CHECK(_recorder.getWritePosition() == 0);
+	CISTFT_CHECK(_ring->getWritePosition() == _written);
+
+	std::printf("%llu frames, %llu hops of %zu every %zu in a %zu frame ring, %llu across its end, %d failures\n",
+		static_cast<unsigned long long>(_written), static_cast<unsigned long long>(_num_hops), _window_size, _hop_size,
+		_ring->getCapacity(), static_cast<unsigned long long>(_num_straddling), test::getNumFailures());
+	return test::getNumFailures() == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+#ifndef CISTFT_TEST_TEST_UTIL_H_
+#define CISTFT_TEST_TEST_UTIL_H_
+
+#include <cstdio>
+
+namespace cistft {
+namespace test {
+
+//! \brief answers the number of failed checks so far, main returns it.
+inline int& getNumFailures()
+{
+	static int _failures = 0;
+	return _failures;
+}
+
+//! \brief prints a failed check, CISTFT_CHECK calls it.
+inline bool check(bool passed, const char* expression, const char* file, int line)
+{
+	if (!passed)
+	{
+		std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+		++getNumFailures();
+	}
+	return passed;
+}
+
+}} // !namespace cistft::test
+
+//! \brief checks a condition, keeps going if it fails. Answers the condition.
+#define CISTFT_CHECK(expression) ::cistft::test::check(!!(expression), #expression, __FILE__, __LINE__)
+
+#endif // !CISTFT_TEST_TEST_UTIL_H_
\ No newline at end of file